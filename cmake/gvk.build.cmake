@@ -8,6 +8,7 @@ include(CTest)
 find_package(Git REQUIRED)
 
 set(gvkBuildModuleDirectory "${CMAKE_CURRENT_LIST_DIR}")
+set(gvkXmlManifestCacheDirectory "${CMAKE_BINARY_DIR}/gvk-xml-manifest-cache/")
 
 function(gvk_create_file_group files)
     set_property(GLOBAL PROPERTY USE_FOLDERS ON)
@@ -70,6 +71,9 @@ endfunction()
 
 function(gvk_add_code_generator)
     cmake_parse_arguments(ARGS "" "TARGET;FOLDER" "LINK_LIBRARIES;INCLUDE_DIRECTORIES;INCLUDE_FILES;SOURCE_FILES;INPUT_FILES;OUTPUT_FILES;COMPILE_DEFINITIONS" ${ARGN})
+    # NOTE : Code generators share a cache of the gvk::xml::Manifest parsed from
+    #   vk.xml so vk.xml is only parsed once per change, see gvk::xml::load_manifest()
+    list(APPEND ARGS_COMPILE_DEFINITIONS GVK_XML_MANIFEST_CACHE_DIRECTORY="${gvkXmlManifestCacheDirectory}")
     gvk_add_executable(
         TARGET               ${ARGS_TARGET}
         FOLDER              "${ARGS_FOLDER}"
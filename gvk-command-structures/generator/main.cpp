@@ -95,10 +95,8 @@ gvk::xml::Enumeration get_command_structure_type_enumeration(const gvk::xml::Man
 
 int main(int, const char*[])
 {
-    tinyxml2::XMLDocument xmlDocument;
-    auto xmlResult = xmlDocument.LoadFile(GVK_XML_FILE_PATH);
-    if (xmlResult == tinyxml2::XML_SUCCESS) {
-        gvk::xml::Manifest manifest(xmlDocument);
+    gvk::xml::Manifest manifest;
+    if (gvk::xml::load_manifest(GVK_XML_FILE_PATH, GVK_XML_MANIFEST_CACHE_DIRECTORY, manifest)) {
         gvk::cppgen::ApiElementCollectionInfo apiElements { };
         apiElements.name = "command";
         apiElements.headerGuard = "gvk_command_structures_h";
@@ -128,29 +126,32 @@ int main(int, const char*[])
             "GvkCommandStructureGetAccelerationStructureBuildSizesKHR",
             "GvkCommandStructureGetPhysicalDeviceXlibPresentationSupportKHR",
         };
-        gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(apiElements);
-        gvk::cppgen::EnumerationToStringGenerator::generate(apiElements);
-        gvk::cppgen::ExecuteCommandStructureGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
-        gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureEnumerateHandlesGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements);
-        gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements, "gvk-command-structures/detail/make-tuple-manual.hpp");
-        gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements);
-
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetDeviceProcAddr");
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetInstanceProcAddr");
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryWin32HandlePropertiesKHR");
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetFenceWin32HandleKHR");
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryRemoteAddressNV");
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryWin32HandleKHR");
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryWin32HandleNV");
-        apiElements.manuallyImplemented.insert("GvkCommandStructureGetSemaphoreWin32HandleKHR");
-        gvk::cppgen::StructureCerealizationGenerator::generate(manifest, apiElements, "gvk-command-structures/detail/cerealization-manual.hpp");
-        gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements, "gvk-command-structures/detail/cerealization-manual.hpp");
-        gvk::cppgen::StructureDeserializationGenerator::generate(apiElements);
-        gvk::cppgen::StructureSerializationGenerator::generate(apiElements);
+        gvk::cppgen::ParallelGenerator generators;
+        generators.add([&]() { gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::EnumerationToStringGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::ExecuteCommandStructureGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureEnumerateHandlesGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements, "gvk-command-structures/detail/make-tuple-manual.hpp"); });
+        generators.add([&]() { gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements); });
+
+        auto serializationApiElements = apiElements;
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetDeviceProcAddr");
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetInstanceProcAddr");
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryWin32HandlePropertiesKHR");
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetFenceWin32HandleKHR");
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryRemoteAddressNV");
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryWin32HandleKHR");
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetMemoryWin32HandleNV");
+        serializationApiElements.manuallyImplemented.insert("GvkCommandStructureGetSemaphoreWin32HandleKHR");
+        generators.add([&]() { gvk::cppgen::StructureCerealizationGenerator::generate(manifest, serializationApiElements, "gvk-command-structures/detail/cerealization-manual.hpp"); });
+        generators.add([&]() { gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, serializationApiElements, "gvk-command-structures/detail/cerealization-manual.hpp"); });
+        generators.add([&]() { gvk::cppgen::StructureDeserializationGenerator::generate(serializationApiElements); });
+        generators.add([&]() { gvk::cppgen::StructureSerializationGenerator::generate(serializationApiElements); });
+        generators.wait();
     }
     return 0;
 }
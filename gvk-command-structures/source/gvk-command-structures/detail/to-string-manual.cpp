@@ -136,7 +136,7 @@ void print<GvkCommandStructureCmdPushConstants>(Printer& printer, const GvkComma
             printer.print_flags<VkShaderStageFlagBits>("stageFlags", obj.stageFlags);
             printer.print_field("offset", obj.offset);
             printer.print_field("size", obj.size);
-            printer.print_array("pValues", obj.size, (const uint8_t*)obj.pValues);
+            printer.print_blob("pValues", obj.size, (const uint8_t*)obj.pValues);
         }
     );
 }
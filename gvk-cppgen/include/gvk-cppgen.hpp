@@ -36,6 +36,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-cppgen/header-guard-generator.hpp"
 #include "gvk-cppgen/module-generator.hpp"
 #include "gvk-cppgen/namespace-generator.hpp"
+#include "gvk-cppgen/parallel-generator.hpp"
 #include "gvk-cppgen/structure-cerealization-generator.hpp"
 #include "gvk-cppgen/structure-comparison-operators-generator.hpp"
 #include "gvk-cppgen/structure-create-copy-generator.hpp"
@@ -44,6 +45,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-cppgen/structure-destroy-copy-generator.hpp"
 #include "gvk-cppgen/structure-enumerate-handles-generator.hpp"
 #include "gvk-cppgen/structure-get-stype-generator.hpp"
+#include "gvk-cppgen/structure-hash-generator.hpp"
 #include "gvk-cppgen/structure-make-tuple-generator.hpp"
 #include "gvk-cppgen/structure-serialization-generator.hpp"
 #include "gvk-cppgen/structure-to-string-generator.hpp"
@@ -0,0 +1,60 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace gvk {
+namespace cppgen {
+
+// NOTE : ParallelGenerator runs added generators on a pool of threads when wait()
+//  is called.  Generators must not share any mutable state and must each write
+//  distinct files; objects captured by reference must not be modified after the
+//  generators that reference them are added and must outlive the call to wait().
+//  If a generator throws, the first exception is rethrown from wait() after all
+//  generators have completed.  The destructor waits on generators that haven't
+//  run yet, but reports rather than rethrows their exceptions.
+class ParallelGenerator final
+{
+public:
+    ParallelGenerator(uint32_t threadCount = 0);
+    ~ParallelGenerator();
+    void add(std::function<void()> generator);
+    void wait();
+
+private:
+    uint32_t mThreadCount{ };
+    std::vector<std::function<void()>> mGenerators;
+
+    ParallelGenerator(const ParallelGenerator&) = delete;
+    ParallelGenerator& operator=(const ParallelGenerator&) = delete;
+};
+
+} // namespace cppgen
+} // namespace gvk
@@ -28,6 +28,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cassert>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <system_error>
+#include <thread>
 
 namespace gvk {
 namespace cppgen {
@@ -41,15 +46,49 @@ FileGenerator::FileGenerator(const std::filesystem::path& filePath, const std::s
     }
 }
 
+// NOTE : Generated files are only replaced when their content changes so that
+//  regenerating doesn't update timestamps and trigger rebuilds of translation
+//  units whose generated dependencies are unchanged.  The size of an existing
+//  file is checked before reading it so most changed files are never read.
+//  Files are read and written in binary mode so sizes compare consistently.
+static bool file_content_matches(const std::filesystem::path& filePath, const std::string& content)
+{
+    std::error_code errorCode;
+    auto fileSize = std::filesystem::file_size(filePath, errorCode);
+    if (errorCode || fileSize != content.size()) {
+        return false;
+    }
+    std::ifstream file(filePath, std::ios::binary);
+    std::string fileContent(std::istreambuf_iterator<char>(file), { });
+    return fileContent == content;
+}
+
+static std::string get_temp_file_token()
+{
+    static const auto ProcessToken = std::random_device()();
+    auto threadToken = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return std::to_string(ProcessToken) + "." + std::to_string(threadToken);
+}
+
 FileGenerator::~FileGenerator()
 {
     assert(!mFilePath.empty());
     std::filesystem::create_directories(mFilePath.parent_path());
     auto content = str();
-    std::ifstream file(mFilePath);
-    if (content != std::string(std::istreambuf_iterator<char>(file), { })) {
-        file.close();
-        std::ofstream(mFilePath) << content;
+    if (!file_content_matches(mFilePath, content)) {
+        // NOTE : Content is written to a temporary file that's renamed into place so
+        //  an interrupted generator never leaves a partially written file behind.
+        //  The temporary file name is unique per process and thread so concurrent
+        //  generators writing the same file don't write to the same temporary file.
+        auto tempFilePath = mFilePath;
+        tempFilePath += "." + get_temp_file_token() + ".tmp";
+        std::ofstream(tempFilePath, std::ios::binary) << content;
+        std::error_code errorCode;
+        std::filesystem::rename(tempFilePath, mFilePath, errorCode);
+        if (errorCode) {
+            std::filesystem::remove(tempFilePath, errorCode);
+            std::ofstream(mFilePath, std::ios::binary) << content;
+        }
     }
 }
 
@@ -0,0 +1,98 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-cppgen/parallel-generator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace gvk {
+namespace cppgen {
+
+ParallelGenerator::ParallelGenerator(uint32_t threadCount)
+    : mThreadCount { threadCount ? threadCount : std::max(std::thread::hardware_concurrency(), 1u) }
+{
+}
+
+ParallelGenerator::~ParallelGenerator()
+{
+    // NOTE : Exceptions can't propagate out of the destructor, call wait() before
+    //  the ParallelGenerator is destroyed to handle generator failures.
+    try {
+        wait();
+    } catch (const std::exception& e) {
+        std::cerr << "gvk::cppgen::ParallelGenerator : " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "gvk::cppgen::ParallelGenerator : Unknown exception" << std::endl;
+    }
+}
+
+void ParallelGenerator::add(std::function<void()> generator)
+{
+    mGenerators.push_back(std::move(generator));
+}
+
+void ParallelGenerator::wait()
+{
+    auto generators = std::move(mGenerators);
+    mGenerators.clear();
+    std::atomic_size_t generatorIndex { 0 };
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+    auto processGenerators = [&]()
+    {
+        for (auto i = generatorIndex++; i < generators.size(); i = generatorIndex++) {
+            try {
+                generators[i]();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    auto threadCount = std::min((size_t)mThreadCount, generators.size());
+    for (size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(processGenerators);
+    }
+    processGenerators();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+} // namespace cppgen
+} // namespace gvk
@@ -31,6 +31,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-cppgen/utilities.hpp"
 #include "gvk-string.hpp"
 
+#include <set>
+#include <string>
+
 namespace gvk {
 namespace cppgen {
 
@@ -154,6 +157,85 @@ protected:
     }
 };
 
+static bool get_binary_cerealizable_size(const xml::Manifest& manifest, const std::set<std::string>& manuallyImplemented, const xml::Structure& structure, std::string& size)
+{
+    static const std::set<std::string> sPrimitiveTypes {
+        "char",
+        "double",
+        "float",
+        "int8_t",
+        "int16_t",
+        "int32_t",
+        "int64_t",
+        "size_t",
+        "uint8_t",
+        "uint16_t",
+        "uint32_t",
+        "uint64_t",
+        "VkBool32",
+        "VkDeviceAddress",
+        "VkDeviceSize",
+        "VkSampleMask",
+    };
+    if (structure.isUnion || structure.members.empty() || manuallyImplemented.count(structure.name)) {
+        return false;
+    }
+    size.clear();
+    for (const auto& member : structure.members) {
+        if (member.flags & (xml::Pointer | xml::Void | xml::Function) || member.bitField || member.name == "pNext") {
+            return false;
+        }
+        if (!get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards).empty()) {
+            return false;
+        }
+        auto length = member.flags & xml::Static ? member.length : std::string();
+        const auto& structureItr = manifest.structures.find(member.unqualifiedType);
+        if (structureItr != manifest.structures.end()) {
+            auto memberStructureItr = structureItr;
+            if (!memberStructureItr->second.alias.empty()) {
+                memberStructureItr = manifest.structures.find(memberStructureItr->second.alias);
+                if (memberStructureItr == manifest.structures.end()) {
+                    return false;
+                }
+            }
+            std::string memberSize;
+            if (!get_binary_cerealizable_size(manifest, manuallyImplemented, memberStructureItr->second, memberSize)) {
+                return false;
+            }
+            if (!length.empty()) {
+                memberSize = "(" + memberSize + ") * (sizeof(" + member.unqualifiedType + length + ") / sizeof(" + member.unqualifiedType + "))";
+            }
+            size += (size.empty() ? std::string() : " + ") + memberSize;
+        } else if (
+            sPrimitiveTypes.count(member.unqualifiedType) ||
+            manifest.enumerations.count(member.unqualifiedType) ||
+            (string::starts_with(member.unqualifiedType, "Vk") && string::contains(member.unqualifiedType, "Flags"))) {
+            size += (size.empty() ? std::string() : " + ") + "sizeof(" + member.unqualifiedType + length + ")";
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void generate_binary_cerealizable_specializations(FileGenerator& file, const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
+{
+    NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+    for (const auto& structure : apiElements.structures) {
+        std::string size;
+        if (structure.alias.empty() && get_binary_cerealizable_size(manifest, apiElements.manuallyImplemented, structure, size)) {
+            file << std::endl;
+            CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+            file << "template <>" << std::endl;
+            file << "struct BinaryCerealizable<" << structure.name << ">" << std::endl;
+            file << "    : std::integral_constant<bool, sizeof(" << structure.name << ") == " << size << ">" << std::endl;
+            file << "{" << std::endl;
+            file << "};" << std::endl;
+        }
+    }
+    file << std::endl;
+}
+
 void StructureCerealizationGenerator::generate(
     const xml::Manifest& manifest,
     const ApiElementCollectionInfo& apiElements,
@@ -172,6 +254,8 @@ void StructureCerealizationGenerator::generate(
         file << "#include \"" << manualImplementationInclude << "\"" << std::endl;
     }
     file << std::endl;
+    generate_binary_cerealizable_specializations(file, manifest, apiElements);
+    file << std::endl;
     NamespaceGenerator namespaceGenerator(file, "cereal");
     for (const auto& structure : apiElements.structures) {
         if (structure.alias.empty() && !apiElements.manuallyImplemented.count(structure.name)) {
@@ -155,6 +155,126 @@ protected:
     }
 };
 
+class StructureMemberCopySizeGenerator final
+    : public BasicStructureMemberProcessorGenerator
+{
+protected:
+    std::string generate_pnext_processor() const override final
+    {
+        return "size += get_pnext_copy_size(obj.pNext);";
+    }
+
+    std::string generate_void_pointer_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_function_pointer_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_dynamic_handle_array_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(gvk::detail::get_count(obj.{memberLength}), obj.{memberName});";
+    }
+
+    std::string generate_dynamic_structure_array_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(gvk::detail::get_count(obj.{memberLength}), obj.{memberName});";
+    }
+
+    std::string generate_dynamic_enumeration_array_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(gvk::detail::get_count(obj.{memberLength}), obj.{memberName});";
+    }
+
+    std::string generate_dynamic_string_processor() const override final
+    {
+        return "size += get_dynamic_string_copy_size(obj.{memberName});";
+    }
+
+    std::string generate_dynamic_string_array_processor() const override final
+    {
+        return "size += get_dynamic_string_array_copy_size(gvk::detail::get_count(obj.{memberLength}), obj.{memberName});";
+    }
+
+    std::string generate_dynamic_primitive_array_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(gvk::detail::get_count(obj.{memberLength}), obj.{memberName});";
+    }
+
+    std::string generate_handle_pointer_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(1, obj.{memberName});";
+    }
+
+    std::string generate_structure_pointer_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(1, obj.{memberName});";
+    }
+
+    std::string generate_enumeration_pointer_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(1, obj.{memberName});";
+    }
+
+    std::string generate_primitive_pointer_processor() const override final
+    {
+        return "size += get_dynamic_array_copy_size(1, obj.{memberName});";
+    }
+
+    std::string generate_static_handle_array_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_static_structure_array_processor() const override final
+    {
+        return "size += get_static_array_copy_size<{memberLength}>(obj.{memberName});";
+    }
+
+    std::string generate_static_enumeration_array_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_static_string_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_static_primitive_array_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_handle_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_structure_processor() const override final
+    {
+        return "size += get_structure_copy_size(obj.{memberName});";
+    }
+
+    std::string generate_enumeration_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_flags_processor() const override final
+    {
+        return std::string();
+    }
+
+    std::string generate_primitive_processor() const override final
+    {
+        return std::string();
+    }
+};
+
 void StructureCreateCopyGenerator::generate(const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
 {
     ModuleGenerator module(
@@ -180,6 +300,7 @@ void StructureCreateCopyGenerator::generate_header(FileGenerator& file, const Ap
     for (const auto& structure : apiElements.structures) {
         CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
         file << string::replace("template <> {structureType} create_structure_copy<{structureType}>(const {structureType}& obj, const VkAllocationCallbacks* pAllocator);", "{structureType}", structure.name) << std::endl;
+        file << string::replace("template <> size_t get_structure_copy_size<{structureType}>(const {structureType}& obj);", "{structureType}", structure.name) << std::endl;
     }
     file << std::endl;
 }
@@ -210,6 +331,21 @@ void StructureCreateCopyGenerator::generate_source(FileGenerator& file, const xm
             }
             file << "    return result;" << std::endl;
             file << "}" << std::endl;
+            file << std::endl;
+            file << string::replace("template <> size_t get_structure_copy_size<{structureType}>(const {structureType}& obj)", "{structureType}", structure.name) << std::endl;
+            file << "{" << std::endl;
+            file << "    (void)obj;" << std::endl;
+            file << "    size_t size = 0;" << std::endl;
+            for (size_t i = 0; i < structure.members.size(); ++i) {
+                const auto& member = structure.members[i];
+                CompileGuardGenerator memberCompileGuardGenerator(file, get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards));
+                auto source = StructureMemberCopySizeGenerator().generate(manifest, member);
+                if (!source.empty()) {
+                    file << "    " << source << std::endl;
+                }
+            }
+            file << "    return size;" << std::endl;
+            file << "}" << std::endl;
         }
     }
     file << std::endl;
@@ -164,6 +164,7 @@ void StructureDecerealizationGenerator::generate(
     file << "#include \"gvk-defines.hpp\"" << std::endl;
     file << "#include \"gvk-structures/detail/cerealization-utilities.hpp\"" << std::endl;
     file << "#include \"gvk-structures/generated/decerealize-pnext.hpp\"" << std::endl;
+    file << "#include \"" << apiElements.includePrefix << apiElements.name << "-structure-cerealization.hpp" << "\"" << std::endl;
     if (!manualImplementationInclude.empty()) {
         file << "#include \"" << manualImplementationInclude << "\"" << std::endl;
     }
@@ -56,10 +56,14 @@ void StructureDeserializationGenerator::generate_header(FileGenerator& file, con
     file << "#include <iosfwd>" << std::endl;
     file << std::endl;
     gvk::cppgen::NamespaceGenerator namespaceGenerator(file, "gvk");
+    file << "namespace detail {" << std::endl;
+    file << "class MappedBinaryInputArchive;" << std::endl;
+    file << "} // namespace detail" << std::endl;
     file << std::endl;
     for (const auto& structure : apiElements.structures) {
         CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
         file << string::replace("void deserialize(std::istream& istrm, const VkAllocationCallbacks* pAllocator, Auto<{structureType}>& obj);", "{structureType}", structure.name) << std::endl;
+        file << string::replace("void deserialize(detail::MappedBinaryInputArchive& archive, Auto<{structureType}>& obj);", "{structureType}", structure.name) << std::endl;
     }
     file << std::endl;
 }
@@ -84,10 +88,14 @@ void StructureDeserializationGenerator::generate_source(FileGenerator& file, con
             strStrm << "void deserialize(std::istream& istrm, const VkAllocationCallbacks* pAllocator, Auto<{structureType}>& obj)" << std::endl;
             strStrm << "{"                                                                                                          << std::endl;
             strStrm << "    assert(!pAllocator && \"TODO : VkAllocationCallbacks need to be hooked up in gvk::Auto <>\");"          << std::endl;
-            strStrm << "    obj.reset();"                                                                                           << std::endl;
+            strStrm << "    (void)pAllocator;"                                                                                      << std::endl;
             strStrm << "    cereal::BinaryInputArchive archive(istrm);"                                                             << std::endl;
-            strStrm << "    detail::tlpDecerealizationAllocator = detail::validate_allocation_callbacks(pAllocator);"               << std::endl;
-            strStrm << "    archive(const_cast<{structureType}&>(*obj));"                                                           << std::endl;
+            strStrm << "    obj.reset(detail::decerealize_structure_arena_copy<{structureType}>(archive));"                        << std::endl;
+            strStrm << "}"                                                                                                          << std::endl;
+            strStrm << std::endl;
+            strStrm << "void deserialize(detail::MappedBinaryInputArchive& archive, Auto<{structureType}>& obj)"                   << std::endl;
+            strStrm << "{"                                                                                                          << std::endl;
+            strStrm << "    obj.reset(detail::decerealize_structure_arena_copy<{structureType}>(archive));"                        << std::endl;
             strStrm << "}"                                                                                                          << std::endl;
             file << string::replace(strStrm.str(), "{structureType}", structure.name);
         }
@@ -0,0 +1,397 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-cppgen/structure-hash-generator.hpp"
+#include "gvk-cppgen/basic-structure-member-processor-generator.hpp"
+#include "gvk-cppgen/compile-guard-generator.hpp"
+#include "gvk-cppgen/module-generator.hpp"
+#include "gvk-cppgen/namespace-generator.hpp"
+#include "gvk-cppgen/utilities.hpp"
+#include "gvk-string.hpp"
+
+#include <sstream>
+
+namespace gvk {
+namespace cppgen {
+
+class StructureMemberHashGenerator final
+    : public BasicStructureMemberProcessorGenerator
+{
+protected:
+    std::string generate_pnext_processor() const override final
+    {
+        return "seed = detail::hash_pnext(obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_void_pointer_processor() const override final
+    {
+        return "seed = detail::hash_value((uint64_t)obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_function_pointer_processor() const override final
+    {
+        return "seed = detail::hash_value((uint64_t)obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_dynamic_handle_array_processor() const override final
+    {
+        return "seed = detail::hash_handle_array(gvk::detail::get_count(obj.{memberLength}), obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_dynamic_structure_array_processor() const override final
+    {
+        return "seed = detail::hash_array(gvk::detail::get_count(obj.{memberLength}), obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_dynamic_enumeration_array_processor() const override final
+    {
+        return "seed = detail::hash_array(gvk::detail::get_count(obj.{memberLength}), obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_dynamic_string_processor() const override final
+    {
+        return "seed = detail::hash_string(obj.{memberName}, seed);";
+    }
+
+    std::string generate_dynamic_string_array_processor() const override final
+    {
+        return "seed = detail::hash_string_array(gvk::detail::get_count(obj.{memberLength}), obj.{memberName}, seed);";
+    }
+
+    std::string generate_dynamic_primitive_array_processor() const override final
+    {
+        return "seed = detail::hash_array(gvk::detail::get_count(obj.{memberLength}), obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_handle_pointer_processor() const override final
+    {
+        return "seed = detail::hash_handle_array(1, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_structure_pointer_processor() const override final
+    {
+        return "seed = detail::hash_array(1, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_enumeration_pointer_processor() const override final
+    {
+        return "seed = detail::hash_array(1, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_primitive_pointer_processor() const override final
+    {
+        return "seed = detail::hash_array(1, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_static_handle_array_processor() const override final
+    {
+        return "seed = detail::hash_handle_array({memberLength}, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_static_structure_array_processor() const override final
+    {
+        return "seed = detail::hash_array({memberLength}, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_static_enumeration_array_processor() const override final
+    {
+        return "seed = detail::hash_array({memberLength}, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_static_string_processor() const override final
+    {
+        return "seed = detail::hash_array({memberLength}, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_static_primitive_array_processor() const override final
+    {
+        return "seed = detail::hash_array({memberLength}, obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_handle_processor() const override final
+    {
+        return "seed = detail::hash_handle(obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_structure_processor() const override final
+    {
+        return "seed = hash(obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_enumeration_processor() const override final
+    {
+        return "seed = detail::hash_value(obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_flags_processor() const override final
+    {
+        return "seed = detail::hash_value(obj.{memberName}, seed, flags);";
+    }
+
+    std::string generate_primitive_processor() const override final
+    {
+        return "seed = detail::hash_value(obj.{memberName}, seed, flags);";
+    }
+};
+
+class StructureMemberEqualGenerator final
+    : public BasicStructureMemberProcessorGenerator
+{
+protected:
+    std::string generate_pnext_processor() const override final
+    {
+        return "if (!detail::equal_pnext(lhs.{memberName}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_void_pointer_processor() const override final
+    {
+        return "if (!detail::equal_value((uint64_t)lhs.{memberName}, (uint64_t)rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_function_pointer_processor() const override final
+    {
+        return "if (!detail::equal_value((uint64_t)lhs.{memberName}, (uint64_t)rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_dynamic_handle_array_processor() const override final
+    {
+        return "if (!detail::equal_handle_array(gvk::detail::get_count(lhs.{memberLength}), lhs.{memberName}, gvk::detail::get_count(rhs.{memberLength}), rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_dynamic_structure_array_processor() const override final
+    {
+        return "if (!detail::equal_array(gvk::detail::get_count(lhs.{memberLength}), lhs.{memberName}, gvk::detail::get_count(rhs.{memberLength}), rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_dynamic_enumeration_array_processor() const override final
+    {
+        return "if (!detail::equal_array(gvk::detail::get_count(lhs.{memberLength}), lhs.{memberName}, gvk::detail::get_count(rhs.{memberLength}), rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_dynamic_string_processor() const override final
+    {
+        return "if (!detail::equal_string(lhs.{memberName}, rhs.{memberName})) { return false; }";
+    }
+
+    std::string generate_dynamic_string_array_processor() const override final
+    {
+        return "if (!detail::equal_string_array(gvk::detail::get_count(lhs.{memberLength}), lhs.{memberName}, gvk::detail::get_count(rhs.{memberLength}), rhs.{memberName})) { return false; }";
+    }
+
+    std::string generate_dynamic_primitive_array_processor() const override final
+    {
+        return "if (!detail::equal_array(gvk::detail::get_count(lhs.{memberLength}), lhs.{memberName}, gvk::detail::get_count(rhs.{memberLength}), rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_handle_pointer_processor() const override final
+    {
+        return "if (!detail::equal_handle_array(1, lhs.{memberName}, 1, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_structure_pointer_processor() const override final
+    {
+        return "if (!detail::equal_array(1, lhs.{memberName}, 1, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_enumeration_pointer_processor() const override final
+    {
+        return "if (!detail::equal_array(1, lhs.{memberName}, 1, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_primitive_pointer_processor() const override final
+    {
+        return "if (!detail::equal_array(1, lhs.{memberName}, 1, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_static_handle_array_processor() const override final
+    {
+        return "if (!detail::equal_handle_array({memberLength}, lhs.{memberName}, {memberLength}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_static_structure_array_processor() const override final
+    {
+        return "if (!detail::equal_array({memberLength}, lhs.{memberName}, {memberLength}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_static_enumeration_array_processor() const override final
+    {
+        return "if (!detail::equal_array({memberLength}, lhs.{memberName}, {memberLength}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_static_string_processor() const override final
+    {
+        return "if (!detail::equal_array({memberLength}, lhs.{memberName}, {memberLength}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_static_primitive_array_processor() const override final
+    {
+        return "if (!detail::equal_array({memberLength}, lhs.{memberName}, {memberLength}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_handle_processor() const override final
+    {
+        return "if (!detail::equal_handle(lhs.{memberName}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_structure_processor() const override final
+    {
+        return "if (!equal(lhs.{memberName}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_enumeration_processor() const override final
+    {
+        return "if (!detail::equal_value(lhs.{memberName}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_flags_processor() const override final
+    {
+        return "if (!detail::equal_value(lhs.{memberName}, rhs.{memberName}, flags)) { return false; }";
+    }
+
+    std::string generate_primitive_processor() const override final
+    {
+        return "if (!detail::equal_value(lhs.{memberName}, rhs.{memberName}, flags)) { return false; }";
+    }
+};
+
+void StructureHashGenerator::generate(const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
+{
+    ModuleGenerator module(
+        apiElements.includePath,
+        apiElements.includePrefix,
+        apiElements.sourcePath,
+        apiElements.name + "-structure-hash"
+    );
+    generate_header(module.header, apiElements);
+    generate_source(module.source, manifest, apiElements);
+}
+
+void StructureHashGenerator::generate_header(FileGenerator& file, const ApiElementCollectionInfo& apiElements)
+{
+    file << "#include \"gvk-defines.hpp\"" << std::endl;
+    for (const auto& include : apiElements.headerIncludes) {
+        file << "#include \"" << include << "\"" << std::endl;
+    }
+    file << "#include \"gvk-structures/detail/hash-flags.hpp\"" << std::endl;
+    file << std::endl;
+    file << "#include <cstdint>" << std::endl;
+    file << "#include <functional>" << std::endl;
+    file << std::endl;
+    {
+        NamespaceGenerator namespaceGenerator(file, "gvk");
+        file << std::endl;
+        for (const auto& structure : apiElements.structures) {
+            if (structure.alias.empty()) {
+                CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+                file << string::replace("uint64_t hash(const {structureName}& obj, uint64_t seed = 0, HashFlags flags = 0);", "{structureName}", structure.name) << std::endl;
+                file << string::replace("bool equal(const {structureName}& lhs, const {structureName}& rhs, HashFlags flags = 0);", "{structureName}", structure.name) << std::endl;
+            }
+        }
+        file << std::endl;
+    }
+    file << std::endl;
+    NamespaceGenerator namespaceGenerator(file, "std");
+    for (const auto& structure : apiElements.structures) {
+        if (structure.alias.empty()) {
+            file << std::endl;
+            CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+            file << string::replace(
+R"(template <>
+struct hash<{structureName}>
+{
+    inline size_t operator()(const {structureName}& obj) const
+    {
+        return (size_t)gvk::hash(obj);
+    }
+};)", "{structureName}", structure.name) << std::endl;
+        }
+    }
+    file << std::endl;
+}
+
+void StructureHashGenerator::generate_source(FileGenerator& file, const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
+{
+    for (const auto& include : apiElements.sourceIncludes) {
+        file << "#include \"" << include << "\"" << std::endl;
+    }
+    file << "#include \"" << apiElements.includePrefix << apiElements.name << "-structure-make-tuple.hpp" << "\"" << std::endl;
+    file << "#include \"gvk-structures/detail/get-count.hpp\"" << std::endl;
+    file << "#include \"gvk-structures/detail/hash-utilities.hpp\"" << std::endl;
+    file << std::endl;
+    NamespaceGenerator namespaceGenerator(file, "gvk");
+    for (const auto& structure : apiElements.structures) {
+        if (!structure.alias.empty()) {
+            continue;
+        }
+        file << std::endl;
+        CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+        file << string::replace("uint64_t hash(const {structureName}& obj, uint64_t seed, HashFlags flags)", "{structureName}", structure.name) << std::endl;
+        file << "{" << std::endl;
+        if (apiElements.manuallyImplemented.count(structure.name)) {
+            // NOTE : Structures with manually implemented make_tuple() overloads are
+            //  hashed via their tuple so that hashing stays consistent with the
+            //  comparison operators for special case members and unions.
+            file << "    return detail::hash_tuple(gvk::make_tuple(obj), seed, flags);" << std::endl;
+        } else {
+            std::stringstream strStrm;
+            for (const auto& member : structure.members) {
+                CompileGuardGenerator memberCompileGuardGenerator(strStrm, get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards));
+                strStrm << "    " << StructureMemberHashGenerator().generate(manifest, member) << std::endl;
+            }
+            if (!string::contains(strStrm.str(), "flags")) {
+                file << "    (void)flags;" << std::endl;
+            }
+            file << strStrm.str();
+            file << "    return seed;" << std::endl;
+        }
+        file << "}" << std::endl;
+        file << std::endl;
+
+        // NOTE : equal() walks the same members as hash() so that structures that
+        //  compare equal with a given HashFlags always hash equal with it.
+        file << string::replace("bool equal(const {structureName}& lhs, const {structureName}& rhs, HashFlags flags)", "{structureName}", structure.name) << std::endl;
+        file << "{" << std::endl;
+        if (apiElements.manuallyImplemented.count(structure.name)) {
+            file << "    return detail::equal_tuple(gvk::make_tuple(lhs), gvk::make_tuple(rhs), flags);" << std::endl;
+        } else {
+            std::stringstream strStrm;
+            for (const auto& member : structure.members) {
+                CompileGuardGenerator memberCompileGuardGenerator(strStrm, get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards));
+                strStrm << "    " << StructureMemberEqualGenerator().generate(manifest, member) << std::endl;
+            }
+            if (!string::contains(strStrm.str(), "flags)")) {
+                file << "    (void)flags;" << std::endl;
+            }
+            file << strStrm.str();
+            file << "    return true;" << std::endl;
+        }
+        file << "}" << std::endl;
+    }
+    file << std::endl;
+}
+
+} // namespace cppgen
+} // namespace gvk
@@ -32,6 +32,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-cppgen/utilities.hpp"
 #include "gvk-string.hpp"
 
+#include <algorithm>
+#include <cctype>
+
 namespace gvk {
 namespace cppgen {
 
@@ -81,7 +84,7 @@ protected:
 
     std::string generate_dynamic_primitive_array_processor() const override final
     {
-        return "printer.print_array(\"{memberName}\", gvk::detail::get_count(obj.{memberLength}), obj.{memberName});";
+        return "printer.print_blob(\"{memberName}\", gvk::detail::get_count(obj.{memberLength}), obj.{memberName});";
     }
 
     std::string generate_handle_pointer_processor() const override final
@@ -155,6 +158,19 @@ protected:
     }
 };
 
+static bool is_sized_void_pointer(const xml::Parameter& member)
+{
+    // NOTE : void pointers with a simple length (ie. VkSpecializationInfo::pData)
+    //  are printed as blobs of bytes.  Lengths that are expressions are left to
+    //  manual implementations.
+    return
+        member.flags & xml::Pointer &&
+        member.flags & xml::Void &&
+        !(member.flags & xml::Function) &&
+        !member.length.empty() &&
+        std::all_of(member.length.begin(), member.length.end(), [](char c) { return isalnum((unsigned char)c) || c == '_'; });
+}
+
 void StructureToStringGenerator::generate(const xml::Manifest& manifest, const ApiElementCollectionInfo& apiElements)
 {
     ModuleGenerator module(
@@ -206,7 +222,14 @@ void StructureToStringGenerator::generate_source(FileGenerator& file, const xml:
             for (size_t i = 0; i < structure.members.size(); ++i) {
                 const auto& member = structure.members[i];
                 CompileGuardGenerator memberCompileGuardGenerator(file, get_inner_scope_compile_guards(structure.compileGuards, member.compileGuards));
-                file << "            " << StructureMemberToStringGenerator().generate(manifest, member) << std::endl;
+                if (is_sized_void_pointer(member)) {
+                    file << "            " << string::replace("printer.print_blob(\"{memberName}\", gvk::detail::get_count(obj.{memberLength}), (const uint8_t*)obj.{memberName});", {
+                        { "{memberName}", member.name },
+                        { "{memberLength}", member.length },
+                    }) << std::endl;
+                } else {
+                    file << "            " << StructureMemberToStringGenerator().generate(manifest, member) << std::endl;
+                }
             }
             file << "        }" << std::endl;
             file << "    );" << std::endl;
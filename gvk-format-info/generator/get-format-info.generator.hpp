@@ -28,6 +28,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-cppgen.hpp"
 
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace gvk {
 namespace cppgen {
 
@@ -36,16 +41,270 @@ class GetFormatInfoGenerator final
 public:
     static void generate(const xml::Manifest& manifest)
     {
-        FileGenerator file(GVK_FORMAT_INFO_GENERATED_SOURCE_PATH "/get-format-info.cpp");
+        generate_format_info_tables(manifest);
+        generate_get_format_info_switch(manifest);
+    }
+
+private:
+    struct TableRange final
+    {
+        int64_t firstFormat{ };
+        int64_t formatCount{ };
+        int64_t firstIndex{ };
+    };
+
+    static std::map<int64_t, const xml::Format*> get_formats_by_value(const xml::Manifest& manifest)
+    {
+        std::map<int64_t, const xml::Format*> formats;
+        auto itr = manifest.enumerations.find("VkFormat");
+        assert(itr != manifest.enumerations.end());
+        for (const auto& enumerator : itr->second.enumerators) {
+            auto formatItr = manifest.formats.find(enumerator.name);
+            if (formatItr != manifest.formats.end() && enumerator.alias.empty() && !enumerator.value.empty()) {
+                formats[string::to_number<int64_t>(enumerator.value)] = &formatItr->second;
+            }
+        }
+        return formats;
+    }
+
+    static std::vector<TableRange> get_table_ranges(const std::map<int64_t, const xml::Format*>& formats)
+    {
+        // NOTE : Core VkFormat values are dense from 0, so they're covered by a
+        //  single range that includes VK_FORMAT_UNDEFINED...VK_FORMAT_UNDEFINED
+        //  doesn't have a <format> entry so its table entry is zero initialized
+        //  and is used for any value that isn't in a range.  Extension VkFormat
+        //  values get one range per extension number spanning the lowest to the
+        //  highest value the extension adds.
+        std::vector<TableRange> tableRanges(1);
+        for (const auto& formatItr : formats) {
+            auto value = formatItr.first;
+            if (value < xml::Enumerator::ExtensionBaseValue) {
+                tableRanges.front().formatCount = std::max(tableRanges.front().formatCount, value + 1);
+            } else {
+                auto extensionBlock = (value - xml::Enumerator::ExtensionBaseValue) / xml::Enumerator::ExtensionRangeSize;
+                auto& tableRange = tableRanges.back();
+                auto tableRangeBlock = (tableRange.firstFormat - xml::Enumerator::ExtensionBaseValue) / xml::Enumerator::ExtensionRangeSize;
+                if (tableRanges.size() == 1 || tableRangeBlock != extensionBlock) {
+                    tableRanges.push_back(TableRange{ value, 1, 0 });
+                } else {
+                    tableRange.formatCount = value - tableRange.firstFormat + 1;
+                }
+            }
+        }
+        for (size_t i = 1; i < tableRanges.size(); ++i) {
+            tableRanges[i].firstIndex = tableRanges[i - 1].firstIndex + tableRanges[i - 1].formatCount;
+        }
+        return tableRanges;
+    }
+
+    static std::string get_numeric_format(const xml::Format& format)
+    {
+        std::string numericFormat = "UNDEFINED";
+        if (!format.components.empty()) {
+            numericFormat = format.components.front().numericFormat;
+            for (const auto& component : format.components) {
+                if (component.numericFormat != numericFormat) {
+                    numericFormat = "UNDEFINED";
+                    break;
+                }
+            }
+        }
+        return "GVK_NUMERIC_FORMAT_" + numericFormat;
+    }
+
+    static std::string get_compression_type(const xml::Format& format)
+    {
+        return "GVK_FORMAT_COMPRESSION_TYPE_" + (!format.compressionType.empty() ? string::replace(format.compressionType, " ", "_") : "NONE");
+    }
+
+    static std::string get_format_class(const std::string& formatClass)
+    {
+        return "GVK_FORMAT_CLASS_" + string::to_upper(string::replace(formatClass, "-", "_"));
+    }
+
+    static std::string get_image_aspect_flags(const xml::Format& format)
+    {
+        bool color = false;
+        bool depth = false;
+        bool stencil = false;
+        for (const auto& component : format.components) {
+            color |= component.name == "A" || component.name == "R" || component.name == "G" || component.name == "B";
+            depth |= component.name == "D";
+            stencil |= component.name == "S";
+        }
+        std::string imageAspectFlags;
+        if (color) {
+            imageAspectFlags += "VK_IMAGE_ASPECT_COLOR_BIT";
+        }
+        if (depth) {
+            imageAspectFlags += std::string(!imageAspectFlags.empty() ? " | " : "") + "VK_IMAGE_ASPECT_DEPTH_BIT";
+        }
+        if (stencil) {
+            imageAspectFlags += std::string(!imageAspectFlags.empty() ? " | " : "") + "VK_IMAGE_ASPECT_STENCIL_BIT";
+        }
+        return !imageAspectFlags.empty() ? imageAspectFlags : "VK_IMAGE_ASPECT_NONE";
+    }
+
+    static uint32_t get_bits_per_texel(const xml::Format& format)
+    {
+        return format.packed ? format.packed : format.texelsPerBlock ? format.blockSize * 8 / format.texelsPerBlock : 0;
+    }
+
+    static void generate_format_info_tables(const xml::Manifest& manifest)
+    {
+        auto formats = get_formats_by_value(manifest);
+        auto tableRanges = get_table_ranges(formats);
+        const auto& lastTableRange = tableRanges.back();
+        auto entryCount = lastTableRange.firstIndex + lastTableRange.formatCount;
+        std::vector<const xml::Format*> entries((size_t)entryCount);
+        for (const auto& tableRange : tableRanges) {
+            for (int64_t i = 0; i < tableRange.formatCount; ++i) {
+                auto formatItr = formats.find(tableRange.firstFormat + i);
+                entries[(size_t)(tableRange.firstIndex + i)] = formatItr != formats.end() ? formatItr->second : nullptr;
+            }
+        }
+
+        FileGenerator file(GVK_FORMAT_INFO_GENERATED_INCLUDE_PATH "/format-info-tables.hpp");
+        file << "#include \"gvk-defines.hpp\"" << std::endl;
+        file << "#include \"gvk-format-info/generated/format-info.h\"" << std::endl;
         file << std::endl;
-        file << "#include \"gvk-format-info.hpp\"" << std::endl;
+        file << "#include <cstdint>" << std::endl;
+        file << std::endl;
+        NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+        file << std::endl;
+
+        file << "struct FormatInfoTableRange" << std::endl;
+        file << "{" << std::endl;
+        file << "    int64_t firstFormat;" << std::endl;
+        file << "    uint32_t formatCount;" << std::endl;
+        file << "    uint32_t firstIndex;" << std::endl;
+        file << "};" << std::endl;
+        file << std::endl;
+        file << "inline constexpr FormatInfoTableRange FormatInfoTableRanges[] {" << std::endl;
+        for (const auto& tableRange : tableRanges) {
+            file << "    FormatInfoTableRange { " << tableRange.firstFormat << ", " << tableRange.formatCount << ", " << tableRange.firstIndex << " }," << std::endl;
+        }
+        file << "};" << std::endl;
+        file << std::endl;
+        file << "inline constexpr uint32_t FormatInfoTableSize { " << entryCount << " };" << std::endl;
+        file << std::endl;
+        file << "inline constexpr uint32_t get_format_info_index(VkFormat format)" << std::endl;
+        file << "{" << std::endl;
+        file << "    for (const auto& range : FormatInfoTableRanges) {" << std::endl;
+        file << "        if (range.firstFormat <= (int64_t)format && (int64_t)format < range.firstFormat + range.formatCount) {" << std::endl;
+        file << "            return range.firstIndex + (uint32_t)((int64_t)format - range.firstFormat);" << std::endl;
+        file << "        }" << std::endl;
+        file << "    }" << std::endl;
+        file << "    return 0;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+
+        // NOTE : Classes, planes, and components for all formats are packed into
+        //  shared arrays that GvkFormatInfo entries point into.  Each array gets a
+        //  zero initialized trailing element so that it's never empty.
+        std::vector<size_t> classOffsets(entries.size());
+        std::vector<size_t> planeOffsets(entries.size());
+        std::vector<size_t> componentOffsets(entries.size());
+        file << "inline constexpr GvkFormatClass FormatInfoClasses[] {" << std::endl;
+        size_t offset = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            classOffsets[i] = offset;
+            if (entries[i]) {
+                for (const auto& formatClass : entries[i]->classes) {
+                    file << "    " << get_format_class(formatClass) << "," << std::endl;
+                }
+                offset += entries[i]->classes.size();
+            }
+        }
+        file << "    GVK_FORMAT_CLASS_UNDEFINED," << std::endl;
+        file << "};" << std::endl;
+        file << std::endl;
+        file << "inline constexpr GvkFormatPlaneInfo FormatInfoPlanes[] {" << std::endl;
+        offset = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            planeOffsets[i] = offset;
+            if (entries[i]) {
+                for (const auto& plane : entries[i]->planes) {
+                    file << "    GvkFormatPlaneInfo { " << plane.index << ", " << plane.widthDivisor << ", " << plane.heightDivisor << ", " << plane.compatible << " }," << std::endl;
+                }
+                offset += entries[i]->planes.size();
+            }
+        }
+        file << "    GvkFormatPlaneInfo { }," << std::endl;
+        file << "};" << std::endl;
+        file << std::endl;
+        file << "inline constexpr GvkFormatComponentInfo FormatInfoComponents[] {" << std::endl;
+        offset = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            componentOffsets[i] = offset;
+            if (entries[i]) {
+                for (const auto& component : entries[i]->components) {
+                    file << "    GvkFormatComponentInfo { GVK_FORMAT_COMPONENT_NAME_" << component.name << ", " << component.bits << ", GVK_NUMERIC_FORMAT_" << component.numericFormat << ", " << component.planeIndex << " }," << std::endl;
+                }
+                offset += entries[i]->components.size();
+            }
+        }
+        file << "    GvkFormatComponentInfo { }," << std::endl;
+        file << "};" << std::endl;
+        file << std::endl;
+
+        file << "inline constexpr GvkFormatInfo FormatInfos[] {" << std::endl;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (entries[i]) {
+                const auto& format = *entries[i];
+                file << "    /* " << format.name << " */" << std::endl;
+                file << "    GvkFormatInfo {" << std::endl;
+                file << "        /* blockSize         */ " << format.blockSize << "," << std::endl;
+                file << "        /* texelsPerBlock    */ " << format.texelsPerBlock << "," << std::endl;
+                file << "        /* chroma            */ " << format.chroma << "," << std::endl;
+                file << "        /* packed            */ " << format.packed << "," << std::endl;
+                file << "        /* blockExtent       */ { " << format.blockExtent[0] << ", " << format.blockExtent[1] << ", " << format.blockExtent[2] << " }," << std::endl;
+                file << "        /* compressionType   */ " << get_compression_type(format) << "," << std::endl;
+                file << "        /* numericFormat     */ " << get_numeric_format(format) << "," << std::endl;
+                file << "        /* pSpirvImageFormat */ " << (!format.spirvImageFormat.empty() ? "\"" + format.spirvImageFormat + "\"" : "nullptr") << "," << std::endl;
+                file << "        /* classCount        */ " << format.classes.size() << "," << std::endl;
+                file << "        /* pClasses          */ " << (!format.classes.empty() ? "FormatInfoClasses + " + std::to_string(classOffsets[i]) : "nullptr") << "," << std::endl;
+                file << "        /* planeCount        */ " << format.planes.size() << "," << std::endl;
+                file << "        /* pPlanes           */ " << (!format.planes.empty() ? "FormatInfoPlanes + " + std::to_string(planeOffsets[i]) : "nullptr") << "," << std::endl;
+                file << "        /* componentCount    */ " << format.components.size() << "," << std::endl;
+                file << "        /* pComponents       */ " << (!format.components.empty() ? "FormatInfoComponents + " + std::to_string(componentOffsets[i]) : "nullptr") << "," << std::endl;
+                file << "    }," << std::endl;
+            } else {
+                file << "    GvkFormatInfo { }," << std::endl;
+            }
+        }
+        file << "};" << std::endl;
+        file << std::endl;
+
+        file << "inline constexpr VkImageAspectFlags FormatInfoImageAspectFlags[] {" << std::endl;
+        for (auto pFormat : entries) {
+            file << "    " << (pFormat ? get_image_aspect_flags(*pFormat) : "VK_IMAGE_ASPECT_NONE") << "," << std::endl;
+        }
+        file << "};" << std::endl;
+        file << std::endl;
+
+        file << "inline constexpr uint32_t FormatInfoBitsPerTexel[] {" << std::endl;
+        for (auto pFormat : entries) {
+            file << "    " << (pFormat ? get_bits_per_texel(*pFormat) : 0) << "," << std::endl;
+        }
+        file << "};" << std::endl;
+        file << std::endl;
+    }
+
+    static void generate_get_format_info_switch(const xml::Manifest& manifest)
+    {
+        // NOTE : The switch based get_format_info() is kept as a reference for
+        //  tests that validate the generated tables, it isn't used by gvk.
+        FileGenerator file(GVK_FORMAT_INFO_GENERATED_INCLUDE_PATH "/get-format-info-switch.hpp");
+        file << "#include \"gvk-defines.hpp\"" << std::endl;
+        file << "#include \"gvk-format-info/generated/format-info.h\"" << std::endl;
         file << std::endl;
         file << "#include <array>" << std::endl;
         file << "#include <cassert>" << std::endl;
         file << std::endl;
-        NamespaceGenerator namespaceGenerator(file, "gvk");
+        NamespaceGenerator namespaceGenerator(file, "gvk::detail");
         file << std::endl;
-        file << "void get_format_info(VkFormat format, GvkFormatInfo* pFormatInfo)" << std::endl;
+        file << "inline void get_format_info_switch(VkFormat format, GvkFormatInfo* pFormatInfo)" << std::endl;
         file << "{" << std::endl;
         file << "    assert(pFormatInfo);" << std::endl;
         file << "    switch (format) {" << std::endl;
@@ -60,24 +319,8 @@ public:
             file << "        pFormatInfo->blockExtent[0] = " << format.blockExtent[0] << ";" << std::endl;
             file << "        pFormatInfo->blockExtent[1] = " << format.blockExtent[1] << ";" << std::endl;
             file << "        pFormatInfo->blockExtent[2] = " << format.blockExtent[2] << ";" << std::endl;
-
-            if (!format.compressionType.empty()) {
-                file << "        pFormatInfo->compressionType = GVK_FORMAT_COMPRESSION_TYPE_" << string::replace(format.compressionType, " ", "_") << ";" << std::endl;
-            } else {
-                file << "        pFormatInfo->compressionType = GVK_FORMAT_COMPRESSION_TYPE_NONE;" << std::endl;
-            }
-
-            std::string numericFormat = "UNDEFINED";
-            if (!format.components.empty()) {
-                numericFormat = format.components.front().numericFormat;
-                for (const auto& component : format.components) {
-                    if (component.numericFormat != numericFormat) {
-                        numericFormat = "UNDEFINED";
-                        break;
-                    }
-                }
-            }
-            file << "        pFormatInfo->numericFormat = GVK_NUMERIC_FORMAT_" << numericFormat << ";" << std::endl;
+            file << "        pFormatInfo->compressionType = " << get_compression_type(format) << ";" << std::endl;
+            file << "        pFormatInfo->numericFormat = " << get_numeric_format(format) << ";" << std::endl;
 
             auto spirvImageFormat = !format.spirvImageFormat.empty() ? "\"" + format.spirvImageFormat + "\"" : "nullptr";
             file << "        pFormatInfo->pSpirvImageFormat = " << spirvImageFormat << ";" << std::endl;
@@ -85,7 +328,7 @@ public:
             if (!format.classes.empty()) {
                 file << "        static const std::array<GvkFormatClass, " << format.classes.size() << "> scClasses {" << std::endl;
                 for (const auto& formatClass : format.classes) {
-                    file << "            GVK_FORMAT_CLASS_" << string::to_upper(string::replace(formatClass, "-", "_")) << "," << std::endl;
+                    file << "            " << get_format_class(formatClass) << "," << std::endl;
                 }
                 file << "        };" << std::endl;
                 file << "        pFormatInfo->classCount = (uint32_t)scClasses.size();" << std::endl;
@@ -239,10 +239,8 @@ std::vector<xml::Enumeration> get_format_info_enumerations(const xml::Manifest&
 
 int main(int, const char*[])
 {
-    tinyxml2::XMLDocument xmlDocument;
-    auto xmlResult = xmlDocument.LoadFile(GVK_XML_FILE_PATH);
-    if (xmlResult == tinyxml2::XML_SUCCESS) {
-        gvk::xml::Manifest manifest(xmlDocument);
+    gvk::xml::Manifest manifest;
+    if (gvk::xml::load_manifest(GVK_XML_FILE_PATH, GVK_XML_MANIFEST_CACHE_DIRECTORY, manifest)) {
         gvk::cppgen::ApiElementCollectionInfo apiElements { };
         apiElements.name = "format-info";
         apiElements.headerGuard = "gvk_format_info_h";
@@ -251,26 +249,29 @@ int main(int, const char*[])
         apiElements.sourcePath = GVK_FORMAT_INFO_GENERATED_SOURCE_PATH;
         apiElements.enumerations = get_format_info_enumerations(manifest);
         apiElements.structures = get_format_info_structures(manifest);
-        gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(apiElements);
+        gvk::cppgen::ParallelGenerator generators;
+        auto declarationApiElements = apiElements;
         apiElements.headerIncludes = {
             GVK_FORMAT_INFO_GENERATED_INCLUDE_PREFIX "format-info.h",
         };
         apiElements.sourceIncludes = {
             "gvk-structures.hpp",
         };
-        gvk::cppgen::EnumerationToStringGenerator::generate(apiElements);
-        gvk::cppgen::StructureCerealizationGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
-        gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDeserializationGenerator::generate(apiElements);
-        gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements);
-        gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureSerializationGenerator::generate(apiElements);
-        gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements);
-        gvk::cppgen::EnumerateFormatsGenerator::generate(manifest);
-        gvk::cppgen::GetFormatInfoGenerator::generate(manifest);
+        generators.add([&]() { gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(declarationApiElements); });
+        generators.add([&]() { gvk::cppgen::EnumerationToStringGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureCerealizationGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDeserializationGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureSerializationGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::EnumerateFormatsGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::GetFormatInfoGenerator::generate(manifest); });
+        generators.wait();
     }
     return 0;
 }
@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-defines.hpp"
 #include "gvk-format-info/generated/enumerate-formats.hpp"
 #include "gvk-format-info/generated/format-info.h"
+#include "gvk-format-info/generated/format-info-tables.hpp"
 #include "gvk-format-info/generated/format-info-enumerations-to-string.hpp"
 #include "gvk-format-info/generated/format-info-structure-comparison-operators.hpp"
 #include "gvk-format-info/generated/format-info-structure-create-copy.hpp"
@@ -42,6 +43,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace gvk {
 
+/**
+Gets the FormatInfo for a specified VkFormat
+@param [in] format The VkFormat to get FormatInfo for
+@return The FormatInfo for the specified VkFormat
+    @note If the specified VkFormat is unrecognized, the returned FormatInfo is zero initialized
+*/
+inline constexpr const GvkFormatInfo& get_format_info(VkFormat format)
+{
+    return detail::FormatInfos[detail::get_format_info_index(format)];
+}
+
 /**
 Gets the FormatInfo for a specified VkFormat
 @param [in] format The VkFormat to get FormatInfo for
@@ -54,21 +66,30 @@ Gets the VkImageAspectFlags for a specified VkFormat
 @param [in] format The VkFormat to get VkImageAspectFlags for
 @return The VkImageAspectFlags for the specified VkFormat
 */
-VkImageAspectFlags get_image_aspect_flags(VkFormat format);
+inline constexpr VkImageAspectFlags get_image_aspect_flags(VkFormat format)
+{
+    return detail::FormatInfoImageAspectFlags[detail::get_format_info_index(format)];
+}
 
 /**
 Gets the nubmer of bits per texel (if applicable) of a specific VkFormat
 @param [in] format The VkFormat to get bits per texel for
 @return The bits per texel of the specified VkFormat
 */
-uint32_t get_bits_per_texel(VkFormat format);
+inline constexpr uint32_t get_bits_per_texel(VkFormat format)
+{
+    return detail::FormatInfoBitsPerTexel[detail::get_format_info_index(format)];
+}
 
 /**
 Gets the nubmer of bytes per texel (if applicable) of a specific VkFormat
 @param [in] format The VkFormat to get bytes per texel for
 @return The bytes per texel of the specified VkFormat
 */
-uint32_t get_bytes_per_texel(VkFormat format);
+inline constexpr uint32_t get_bytes_per_texel(VkFormat format)
+{
+    return get_bits_per_texel(format) / 8;
+}
 
 /**
 Executes a given function for every VkFormat the fulfills the provided criteria
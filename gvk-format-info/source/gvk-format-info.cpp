@@ -26,47 +26,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-format-info.hpp"
 
-namespace gvk {
-
-VkImageAspectFlags get_image_aspect_flags(VkFormat format)
-{
-    GvkFormatInfo formatInfo { };
-    get_format_info(format, &formatInfo);
-    VkImageAspectFlags imageAspectFlags = VK_IMAGE_ASPECT_NONE;
-    for (uint32_t i = 0; i < formatInfo.componentCount; ++i) {
-        switch (formatInfo.pComponents[i].name) {
-        case GVK_FORMAT_COMPONENT_NAME_A:
-        case GVK_FORMAT_COMPONENT_NAME_R:
-        case GVK_FORMAT_COMPONENT_NAME_G:
-        case GVK_FORMAT_COMPONENT_NAME_B: {
-            imageAspectFlags |= VK_IMAGE_ASPECT_COLOR_BIT;
-        } break;
-        case GVK_FORMAT_COMPONENT_NAME_D: {
-            imageAspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
-        } break;
-        case GVK_FORMAT_COMPONENT_NAME_S: {
-            imageAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
-        } break;
-        default: {
-        } break;
-        }
-    }
-    return imageAspectFlags;
-}
+#include <cassert>
 
-uint32_t get_bits_per_texel(VkFormat format)
-{
-    if (format) {
-        GvkFormatInfo formatInfo { };
-        get_format_info(format, &formatInfo);
-        return formatInfo.packed ? formatInfo.packed : formatInfo.blockSize * 8 / formatInfo.texelsPerBlock;
-    }
-    return 0;
-}
+namespace gvk {
 
-uint32_t get_bytes_per_texel(VkFormat format)
+void get_format_info(VkFormat format, GvkFormatInfo* pFormatInfo)
 {
-    return get_bits_per_texel(format) / 8;
+    assert(pFormatInfo);
+    *pFormatInfo = get_format_info(format);
 }
 
 } // namespace gvk
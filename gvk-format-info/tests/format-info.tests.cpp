@@ -25,6 +25,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 
 #include "gvk-format-info.hpp"
+#include "gvk-format-info/generated/get-format-info-switch.hpp"
 #include "gvk-structures.hpp"
 
 #ifdef VK_USE_PLATFORM_XLIB_KHR
@@ -94,3 +95,73 @@ TEST(GvkFormatInfo, get_bits_per_texel_compressed)
     );
     EXPECT_TRUE(mismatches.empty());
 }
+
+static_assert(gvk::get_bits_per_texel(VK_FORMAT_R8G8B8A8_UNORM) == 32);
+static_assert(gvk::get_bytes_per_texel(VK_FORMAT_R16G16B16A16_SFLOAT) == 8);
+static_assert(gvk::get_image_aspect_flags(VK_FORMAT_D24_UNORM_S8_UINT) == (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT));
+static_assert(gvk::get_format_info(VK_FORMAT_BC1_RGB_UNORM_BLOCK).compressionType == GVK_FORMAT_COMPRESSION_TYPE_BC);
+static_assert(gvk::get_format_info(VK_FORMAT_UNDEFINED).blockSize == 0);
+
+TEST(GvkFormatInfo, tables)
+{
+    // Validates the generated tables against the switch based get_format_info()
+    //  for every value in every table range, values on either side of each range,
+    //  and values that aren't in any range.
+    auto validate_format =
+    [](VkFormat format)
+    {
+        GvkFormatInfo expectedFormatInfo { };
+        gvk::detail::get_format_info_switch(format, &expectedFormatInfo);
+        const auto& formatInfo = gvk::get_format_info(format);
+        EXPECT_EQ(formatInfo, expectedFormatInfo) << gvk::to_string(format);
+
+        VkImageAspectFlags expectedImageAspectFlags = VK_IMAGE_ASPECT_NONE;
+        for (uint32_t i = 0; i < expectedFormatInfo.componentCount; ++i) {
+            switch (expectedFormatInfo.pComponents[i].name) {
+            case GVK_FORMAT_COMPONENT_NAME_A:
+            case GVK_FORMAT_COMPONENT_NAME_R:
+            case GVK_FORMAT_COMPONENT_NAME_G:
+            case GVK_FORMAT_COMPONENT_NAME_B: {
+                expectedImageAspectFlags |= VK_IMAGE_ASPECT_COLOR_BIT;
+            } break;
+            case GVK_FORMAT_COMPONENT_NAME_D: {
+                expectedImageAspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+            } break;
+            case GVK_FORMAT_COMPONENT_NAME_S: {
+                expectedImageAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+            } break;
+            default: {
+            } break;
+            }
+        }
+        EXPECT_EQ(gvk::get_image_aspect_flags(format), expectedImageAspectFlags) << gvk::to_string(format);
+
+        uint32_t expectedBitsPerTexel = 0;
+        if (expectedFormatInfo.texelsPerBlock) {
+            expectedBitsPerTexel = expectedFormatInfo.packed ? expectedFormatInfo.packed : expectedFormatInfo.blockSize * 8 / expectedFormatInfo.texelsPerBlock;
+        }
+        EXPECT_EQ(gvk::get_bits_per_texel(format), expectedBitsPerTexel) << gvk::to_string(format);
+        EXPECT_EQ(gvk::get_bytes_per_texel(format), expectedBitsPerTexel / 8) << gvk::to_string(format);
+    };
+
+    uint32_t tableEntryCount = 0;
+    for (const auto& range : gvk::detail::FormatInfoTableRanges) {
+        EXPECT_EQ(range.firstIndex, tableEntryCount);
+        tableEntryCount += range.formatCount;
+        for (int64_t format = range.firstFormat - 1; format <= range.firstFormat + range.formatCount; ++format) {
+            validate_format((VkFormat)format);
+        }
+    }
+    EXPECT_EQ(tableEntryCount, gvk::detail::FormatInfoTableSize);
+    validate_format((VkFormat)-1);
+    validate_format((VkFormat)0x7FFFFFFF);
+
+    // Every VkFormat enumerated by enumerate_formats() is in a table range.
+    gvk::enumerate_formats(
+        [&](VkFormat format)
+        {
+            EXPECT_TRUE(!format || gvk::detail::get_format_info_index(format)) << gvk::to_string(format);
+            return true;
+        }
+    );
+}
@@ -31,10 +31,15 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-defines.hpp"
 #include "gvk-handles/handles.hpp"
 #include "gvk-handles/mesh.hpp"
+#include "gvk-handles/upload-manager.hpp"
 #include "gvk-handles/utilities.hpp"
 
 #include "imgui.h"
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace gvk {
 namespace gui {
 
@@ -54,6 +59,7 @@ public:
     Renderer(Renderer&& other);
     Renderer& operator=(Renderer&& other);
     static VkResult create(const Device& device, VkQueue vkQueue, VkCommandBuffer vkCommandBuffer, const RenderPass& renderPass, const VkAllocationCallbacks* pAllocator, Renderer* pRenderer);
+    static VkResult create(UploadManager& uploadManager, const RenderPass& renderPass, const VkAllocationCallbacks* pAllocator, Renderer* pRenderer);
     ~Renderer();
 
     const Device& get_device() const;
@@ -63,21 +69,45 @@ public:
     VkResult end_gui(uint32_t fenceCount, const VkFence* pVkFences);
     void record_cmds(VkCommandBuffer vkCommandBuffer) const;
 
+    VkResult create_texture_id(const ImageView& imageView, const Sampler& sampler, VkImageLayout imageLayout, ImTextureID* pTextureId);
+    void destroy_texture_id(ImTextureID textureId);
+
 private:
+    class Texture final
+    {
+    public:
+        DescriptorSet descriptorSet;
+        ImageView imageView;
+        Sampler sampler;
+    };
+
     VkResult create_pipeline(const RenderPass& renderPass, const VkAllocationCallbacks* pAllocator);
-    VkResult create_image_view_and_sampler(VkQueue vkQueue, VkCommandBuffer vkCommandBuffer, const VkAllocationCallbacks* pAllocator);
+    VkResult create_image_view_and_sampler(UploadManager* pUploadManager, VkQueue vkQueue, VkCommandBuffer vkCommandBuffer, const VkAllocationCallbacks* pAllocator);
+    VkResult upload_font_image(const Image& image, VkQueue vkQueue, VkCommandBuffer vkCommandBuffer, const unsigned char* pFontData);
     VkResult allocate_and_update_descriptor_set(const VkAllocationCallbacks* pAllocator);
+    VkResult create_vertex_index_buffer(uint32_t regionCount, VkDeviceSize regionSize);
     void record_render_state_setup_cmds(VkCommandBuffer vkCommandBuffer, const ImDrawData* pImDrawData) const;
 
     ImGuiContext* mpImGuiContext { nullptr };
     Device mDevice;
+    VkAllocationCallbacks mAllocator { };
     Pipeline mPipeline;
     ImageView mFontImageView;
     Sampler mFontSampler;
     DescriptorSet mFontDescriptorSet;
     Buffer mVertexIndexBuffer;
+    uint8_t* mpVertexIndexData { nullptr };
+    uint32_t mVertexIndexRegionCount { };
+    VkDeviceSize mVertexIndexRegionSize { };
+    VkDeviceSize mVertexDataOffset { };
     VkDeviceSize mIndexDataOffset { };
     uint32_t mIndexCount { };
+    uint64_t mFrameIndex { };
+    uint32_t mFramesInFlight { };
+    std::vector<std::pair<uint64_t, Buffer>> mRetiredVertexIndexBuffers;
+    DescriptorPool mTextureDescriptorPool;
+    std::unordered_map<VkDescriptorSet, Texture> mTextures;
+    std::vector<std::pair<uint64_t, Texture>> mRetiredTextures;
 };
 
 } // namespace gui
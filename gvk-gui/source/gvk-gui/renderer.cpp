@@ -87,13 +87,26 @@ Renderer& Renderer::operator=(Renderer&& other)
     if (this != &other) {
         mpImGuiContext = std::move(other.mpImGuiContext);
         mDevice = std::move(other.mDevice);
+        mAllocator = std::move(other.mAllocator);
         mPipeline = std::move(other.mPipeline);
         mFontImageView = std::move(other.mFontImageView);
         mFontSampler = std::move(other.mFontSampler);
         mFontDescriptorSet = std::move(other.mFontDescriptorSet);
         mVertexIndexBuffer = std::move(other.mVertexIndexBuffer);
+        mpVertexIndexData = std::move(other.mpVertexIndexData);
+        mVertexIndexRegionCount = std::move(other.mVertexIndexRegionCount);
+        mVertexIndexRegionSize = std::move(other.mVertexIndexRegionSize);
+        mVertexDataOffset = std::move(other.mVertexDataOffset);
+        mIndexDataOffset = std::move(other.mIndexDataOffset);
         mIndexCount = std::move(other.mIndexCount);
+        mFrameIndex = std::move(other.mFrameIndex);
+        mFramesInFlight = std::move(other.mFramesInFlight);
+        mRetiredVertexIndexBuffers = std::move(other.mRetiredVertexIndexBuffers);
+        mTextureDescriptorPool = std::move(other.mTextureDescriptorPool);
+        mTextures = std::move(other.mTextures);
+        mRetiredTextures = std::move(other.mRetiredTextures);
         other.mpImGuiContext = nullptr;
+        other.mpVertexIndexData = nullptr;
     }
     return *this;
 }
@@ -107,11 +120,32 @@ VkResult Renderer::create(const Device& device, VkQueue vkQueue, VkCommandBuffer
     assert(pRenderer);
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         pRenderer->mDevice = device;
+        pRenderer->mAllocator = pAllocator ? *pAllocator : get_default<VkAllocationCallbacks>();
         pRenderer->mpImGuiContext = ImGui::CreateContext();
         ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
         gvk_result(pRenderer->mpImGuiContext ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
         gvk_result(pRenderer->create_pipeline(renderPass, pAllocator));
-        gvk_result(pRenderer->create_image_view_and_sampler(vkQueue, vkCommandBuffer, pAllocator));
+        gvk_result(pRenderer->create_image_view_and_sampler(nullptr, vkQueue, vkCommandBuffer, pAllocator));
+        gvk_result(pRenderer->allocate_and_update_descriptor_set(pAllocator));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult Renderer::create(UploadManager& uploadManager, const RenderPass& renderPass, const VkAllocationCallbacks* pAllocator, Renderer* pRenderer)
+{
+    assert(uploadManager.get_device());
+    assert(renderPass);
+    assert(pRenderer);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : The font Image upload is recorded into the given UploadManager, it
+        //  must complete before commands recorded by record_cmds() execute.
+        pRenderer->mDevice = uploadManager.get_device();
+        pRenderer->mAllocator = pAllocator ? *pAllocator : get_default<VkAllocationCallbacks>();
+        pRenderer->mpImGuiContext = ImGui::CreateContext();
+        ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
+        gvk_result(pRenderer->mpImGuiContext ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        gvk_result(pRenderer->create_pipeline(renderPass, pAllocator));
+        gvk_result(pRenderer->create_image_view_and_sampler(&uploadManager, VK_NULL_HANDLE, VK_NULL_HANDLE, pAllocator));
         gvk_result(pRenderer->allocate_and_update_descriptor_set(pAllocator));
     } gvk_result_scope_end;
     return gvkResult;
@@ -397,37 +431,45 @@ void Renderer::begin_gui(const BeginInfo& beginInfo)
 VkResult Renderer::end_gui(uint32_t fenceCount, const VkFence* pVkFences)
 {
     assert(mDevice);
+    (void)pVkFences;
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         ImGui::Render();
         auto pImDrawData = ImGui::GetDrawData();
         assert(pImDrawData);
-        auto vertexCount = pImDrawData->TotalVtxCount;
-        auto vertexDataSize = vertexCount * sizeof(ImDrawVert);
-        mIndexDataOffset = vertexDataSize;
-        mIndexCount = pImDrawData->TotalIdxCount;
-        auto indexDataSize = mIndexCount * sizeof(ImDrawIdx);
+
+        // NOTE : Buffers that were replaced while growing and textures that were
+        //  destroyed are released once every frame that may have referenced them has
+        //  completed.  The given VkFences guard at most fenceCount frames in flight.
+        mFramesInFlight = fenceCount;
+        ++mFrameIndex;
+        auto isReleasable = [&](const auto& retired)
+        {
+            return retired.first <= mFrameIndex;
+        };
+        mRetiredVertexIndexBuffers.erase(std::remove_if(mRetiredVertexIndexBuffers.begin(), mRetiredVertexIndexBuffers.end(), isReleasable), mRetiredVertexIndexBuffers.end());
+        mRetiredTextures.erase(std::remove_if(mRetiredTextures.begin(), mRetiredTextures.end(), isReleasable), mRetiredTextures.end());
+
+        auto vertexDataSize = (VkDeviceSize)pImDrawData->TotalVtxCount * sizeof(ImDrawVert);
+        auto indexDataSize = (VkDeviceSize)pImDrawData->TotalIdxCount * sizeof(ImDrawIdx);
         auto dataSize = vertexDataSize + indexDataSize;
+        mIndexCount = pImDrawData->TotalIdxCount;
         if (dataSize) {
-            if (!mVertexIndexBuffer || mVertexIndexBuffer.get<VkBufferCreateInfo>().size < dataSize) {
-                auto originalSize = mVertexIndexBuffer ? mVertexIndexBuffer.get<VkBufferCreateInfo>().size : 0;
-                (void)originalSize;
-                if (mVertexIndexBuffer && fenceCount && pVkFences) {
-                    const auto& dispatchTable = mDevice.get<DispatchTable>();
-                    assert(dispatchTable.gvkWaitForFences);
-                    dispatchTable.gvkWaitForFences(mDevice, fenceCount, pVkFences, VK_TRUE, UINT64_MAX);
-                }
-                auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
-                bufferCreateInfo.size = dataSize;
-                bufferCreateInfo.usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
-                VmaAllocationCreateInfo allocationCreateInfo { };
-                allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
-                allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
-                gvk_result(Buffer::create(mDevice, &bufferCreateInfo, &allocationCreateInfo, &mVertexIndexBuffer));
+            // NOTE : Each frame writes to its own region of a persistently mapped
+            //  gvk::Buffer.  With mFramesInFlight + 1 regions a region is never
+            //  written while a frame that reads it may still be executing.
+            auto regionCount = mFramesInFlight + 1;
+            auto regionSize = mVertexIndexRegionSize;
+            if (regionSize < dataSize) {
+                regionSize = std::max(regionSize * 2, dataSize);
+            }
+            if (!mVertexIndexBuffer || mVertexIndexRegionCount != regionCount || mVertexIndexRegionSize != regionSize) {
+                gvk_result(create_vertex_index_buffer(regionCount, regionSize));
             }
-            uint8_t* pData = nullptr;
-            gvk_result(vmaMapMemory(mDevice.get<VmaAllocator>(), mVertexIndexBuffer.get<VmaAllocation>(), (void**)&pData));
-            auto pVertexData = (ImDrawVert*)pData;
-            auto pIndexData = (ImDrawIdx*)(pData + mIndexDataOffset);
+            auto regionOffset = (mFrameIndex % mVertexIndexRegionCount) * mVertexIndexRegionSize;
+            mVertexDataOffset = regionOffset;
+            mIndexDataOffset = regionOffset + vertexDataSize;
+            auto pVertexData = (ImDrawVert*)(mpVertexIndexData + mVertexDataOffset);
+            auto pIndexData = (ImDrawIdx*)(mpVertexIndexData + mIndexDataOffset);
             for (int i = 0; i < pImDrawData->CmdListsCount; ++i) {
                 auto pCmdList = pImDrawData->CmdLists[i];
                 assert(pCmdList);
@@ -436,8 +478,7 @@ VkResult Renderer::end_gui(uint32_t fenceCount, const VkFence* pVkFences)
                 pVertexData += pCmdList->VtxBuffer.Size;
                 pIndexData += pCmdList->IdxBuffer.Size;
             }
-            gvk_result(vmaFlushAllocation(mDevice.get<VmaAllocator>(), mVertexIndexBuffer.get<VmaAllocation>(), 0, dataSize));
-            vmaUnmapMemory(mDevice.get<VmaAllocator>(), mVertexIndexBuffer.get<VmaAllocation>());
+            gvk_result(vmaFlushAllocation(mDevice.get<VmaAllocator>(), mVertexIndexBuffer.get<VmaAllocation>(), regionOffset, dataSize));
         }
     } gvk_result_scope_end;
     return gvkResult;
@@ -453,6 +494,25 @@ void Renderer::record_cmds(VkCommandBuffer vkCommandBuffer) const
     assert(pImDrawData);
     if (!pImDrawData->CmdLists.empty()) {
         record_render_state_setup_cmds(vkCommandBuffer, pImDrawData);
+
+        // NOTE : VkDescriptorSet binds and scissors are only recorded when they
+        //  change.  Consecutive ImDrawCmds with the same VkDescriptorSet, scissor,
+        //  and vertex offset that reference contiguous indices are merged into a
+        //  single vkCmdDrawIndexed().
+        VkDescriptorSet boundVkDescriptorSet = VK_NULL_HANDLE;
+        auto boundScissor = get_default<VkRect2D>();
+        bool scissorBound = false;
+        uint32_t drawIndexCount = 0;
+        uint32_t drawFirstIndex = 0;
+        int32_t drawVertexOffset = 0;
+        auto recordDraw = [&]()
+        {
+            if (drawIndexCount) {
+                dispatchTable.gvkCmdDrawIndexed(vkCommandBuffer, drawIndexCount, 1, drawFirstIndex, drawVertexOffset, 0);
+                drawIndexCount = 0;
+            }
+        };
+
         int vertexOffset = 0;
         int indexOffset = 0;
         for (int cmdList_i = 0; cmdList_i < pImDrawData->CmdLists.size(); ++cmdList_i) {
@@ -460,11 +520,14 @@ void Renderer::record_cmds(VkCommandBuffer vkCommandBuffer) const
             for (int cmd_i = 0; cmd_i < pCmdList->CmdBuffer.Size; ++cmd_i) {
                 const auto& cmd = pCmdList->CmdBuffer[cmd_i];
                 if (cmd.UserCallback) {
+                    recordDraw();
                     if (cmd.UserCallback == ImDrawCallback_ResetRenderState) {
                         record_render_state_setup_cmds(vkCommandBuffer, pImDrawData);
                     } else {
                         cmd.UserCallback(pCmdList, &cmd);
                     }
+                    boundVkDescriptorSet = VK_NULL_HANDLE;
+                    scissorBound = false;
                 } else {
                     auto displayPos = pImDrawData->DisplayPos;
                     auto framebufferScale = pImDrawData->FramebufferScale;
@@ -476,16 +539,111 @@ void Renderer::record_cmds(VkCommandBuffer vkCommandBuffer) const
                     scissor.extent.width = (uint32_t)(clipMax.x - clipMin.x);
                     scissor.extent.height = (uint32_t)(clipMax.y - clipMin.y);
                     if (clipMin.x < clipMax.x && clipMin.y < clipMax.y) {
-                        dispatchTable.gvkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
                         auto vkDescriptorSet = (VkDescriptorSet)cmd.TextureId;
-                        dispatchTable.gvkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline.get<PipelineLayout>(), 0, 1, &vkDescriptorSet, 0, nullptr);
-                        dispatchTable.gvkCmdDrawIndexed(vkCommandBuffer, cmd.ElemCount, 1, cmd.IdxOffset + indexOffset, cmd.VtxOffset + vertexOffset, 0);
+                        auto firstIndex = cmd.IdxOffset + (uint32_t)indexOffset;
+                        auto cmdVertexOffset = (int32_t)cmd.VtxOffset + vertexOffset;
+                        auto scissorChanged = !scissorBound ||
+                            scissor.offset.x != boundScissor.offset.x ||
+                            scissor.offset.y != boundScissor.offset.y ||
+                            scissor.extent.width != boundScissor.extent.width ||
+                            scissor.extent.height != boundScissor.extent.height;
+                        auto descriptorSetChanged = vkDescriptorSet != boundVkDescriptorSet;
+                        if (scissorChanged || descriptorSetChanged || cmdVertexOffset != drawVertexOffset || firstIndex != drawFirstIndex + drawIndexCount) {
+                            recordDraw();
+                        }
+                        if (scissorChanged) {
+                            dispatchTable.gvkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
+                            boundScissor = scissor;
+                            scissorBound = true;
+                        }
+                        if (descriptorSetChanged) {
+                            dispatchTable.gvkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline.get<PipelineLayout>(), 0, 1, &vkDescriptorSet, 0, nullptr);
+                            boundVkDescriptorSet = vkDescriptorSet;
+                        }
+                        if (!drawIndexCount) {
+                            drawFirstIndex = firstIndex;
+                            drawVertexOffset = cmdVertexOffset;
+                        }
+                        drawIndexCount += cmd.ElemCount;
                     }
                 }
             }
             vertexOffset += pCmdList->VtxBuffer.Size;
             indexOffset += pCmdList->IdxBuffer.Size;
         }
+        recordDraw();
+    }
+}
+
+VkResult Renderer::create_texture_id(const ImageView& imageView, const Sampler& sampler, VkImageLayout imageLayout, ImTextureID* pTextureId)
+{
+    assert(mDevice);
+    assert(mPipeline);
+    assert(imageView);
+    assert(sampler);
+    assert(pTextureId);
+    const auto& descriptorSetLayouts = mPipeline.get<PipelineLayout>().get<DescriptorSetLayouts>();
+    assert(descriptorSetLayouts.size() == 1);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : VkDescriptorSets are allocated from a shared gvk::DescriptorPool,
+        //  when the gvk::DescriptorPool is exhausted a new one is created.  Each
+        //  gvk::DescriptorSet keeps its gvk::DescriptorPool alive.
+        auto descriptorSetAllocateInfo = get_default<VkDescriptorSetAllocateInfo>();
+        descriptorSetAllocateInfo.descriptorSetCount = 1;
+        descriptorSetAllocateInfo.pSetLayouts = &descriptorSetLayouts[0].get<VkDescriptorSetLayout>();
+        Texture texture;
+        auto vkResult = VK_ERROR_OUT_OF_POOL_MEMORY;
+        if (mTextureDescriptorPool) {
+            descriptorSetAllocateInfo.descriptorPool = mTextureDescriptorPool;
+            vkResult = DescriptorSet::allocate(mDevice, &descriptorSetAllocateInfo, &texture.descriptorSet);
+        }
+        if (vkResult == VK_ERROR_OUT_OF_POOL_MEMORY || vkResult == VK_ERROR_FRAGMENTED_POOL) {
+            const uint32_t TextureDescriptorPoolSize = 64;
+            auto descriptorPoolSize = get_default<VkDescriptorPoolSize>();
+            descriptorPoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            descriptorPoolSize.descriptorCount = TextureDescriptorPoolSize;
+            auto descriptorPoolCreateInfo = get_default<VkDescriptorPoolCreateInfo>();
+            descriptorPoolCreateInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+            descriptorPoolCreateInfo.maxSets = TextureDescriptorPoolSize;
+            descriptorPoolCreateInfo.poolSizeCount = 1;
+            descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
+            gvk_result(DescriptorPool::create(mDevice, &descriptorPoolCreateInfo, validate_allocator(mAllocator), &mTextureDescriptorPool));
+            descriptorSetAllocateInfo.descriptorPool = mTextureDescriptorPool;
+            vkResult = DescriptorSet::allocate(mDevice, &descriptorSetAllocateInfo, &texture.descriptorSet);
+        }
+        gvk_result(vkResult);
+
+        auto descriptorImageInfo = get_default<VkDescriptorImageInfo>();
+        descriptorImageInfo.sampler = sampler;
+        descriptorImageInfo.imageView = imageView;
+        descriptorImageInfo.imageLayout = imageLayout;
+        auto writeDescriptorSet = get_default<VkWriteDescriptorSet>();
+        writeDescriptorSet.dstSet = texture.descriptorSet;
+        writeDescriptorSet.descriptorCount = 1;
+        writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writeDescriptorSet.pImageInfo = &descriptorImageInfo;
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        assert(dispatchTable.gvkUpdateDescriptorSets);
+        dispatchTable.gvkUpdateDescriptorSets(mDevice, 1, &writeDescriptorSet, 0, nullptr);
+
+        texture.imageView = imageView;
+        texture.sampler = sampler;
+        VkDescriptorSet vkDescriptorSet = texture.descriptorSet;
+        *pTextureId = (ImTextureID)vkDescriptorSet;
+        mTextures[vkDescriptorSet] = std::move(texture);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void Renderer::destroy_texture_id(ImTextureID textureId)
+{
+    // NOTE : The VkDescriptorSet may still be referenced by frames in flight, so
+    //  it's released by end_gui() once those frames have completed.
+    auto itr = mTextures.find((VkDescriptorSet)textureId);
+    if (itr != mTextures.end()) {
+        auto retiredFrameIndex = mFrameIndex + mFramesInFlight + 1;
+        mRetiredTextures.emplace_back(retiredFrameIndex, std::move(itr->second));
+        mTextures.erase(itr);
     }
 }
 
@@ -629,12 +787,12 @@ VkResult Renderer::create_pipeline(const RenderPass& renderPass, const VkAllocat
     return gvkResult;
 }
 
-VkResult Renderer::create_image_view_and_sampler(VkQueue vkQueue, VkCommandBuffer vkCommandBuffer, const VkAllocationCallbacks* pAllocator)
+VkResult Renderer::create_image_view_and_sampler(UploadManager* pUploadManager, VkQueue vkQueue, VkCommandBuffer vkCommandBuffer, const VkAllocationCallbacks* pAllocator)
 {
     assert(mpImGuiContext);
     assert(mDevice);
-    assert(vkQueue);
-    assert(vkCommandBuffer);
+    assert(pUploadManager || vkQueue);
+    assert(pUploadManager || vkCommandBuffer);
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         int fontWidth = 0;
         int fontHeight = 0;
@@ -654,10 +812,39 @@ VkResult Renderer::create_image_view_and_sampler(VkQueue vkQueue, VkCommandBuffe
         allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
         Image image;
         gvk_result(Image::create(mDevice, &imageCreateInfo, &allocationCreateInfo, &image));
+        if (pUploadManager) {
+            auto bufferImageCopy = get_default<VkBufferImageCopy>();
+            bufferImageCopy.imageExtent = imageCreateInfo.extent;
+            bufferImageCopy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            auto size = (VkDeviceSize)fontWidth * fontHeight * 4 * sizeof(unsigned char);
+            gvk_result(pUploadManager->upload(image, imageCreateInfo.initialLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 1, &bufferImageCopy, size, pFontData));
+        } else {
+            gvk_result(upload_font_image(image, vkQueue, vkCommandBuffer, pFontData));
+        }
 
+        auto imageViewCreateInfo = get_default<VkImageViewCreateInfo>();
+        imageViewCreateInfo.image = image;
+        imageViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        imageViewCreateInfo.format = imageCreateInfo.format;
+        gvk_result(ImageView::create(mDevice, &imageViewCreateInfo, pAllocator, &mFontImageView));
+        gvk_result(Sampler::create(mDevice, &get_default<VkSamplerCreateInfo>(), pAllocator, &mFontSampler));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult Renderer::upload_font_image(const Image& image, VkQueue vkQueue, VkCommandBuffer vkCommandBuffer, const unsigned char* pFontData)
+{
+    assert(mDevice);
+    assert(image);
+    assert(vkQueue);
+    assert(vkCommandBuffer);
+    assert(pFontData);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        const auto& imageCreateInfo = image.get<VkImageCreateInfo>();
         auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
-        bufferCreateInfo.size = fontWidth * fontHeight * 4 * sizeof(unsigned char);
+        bufferCreateInfo.size = imageCreateInfo.extent.width * imageCreateInfo.extent.height * 4 * sizeof(unsigned char);
         bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        auto allocationCreateInfo = get_default<VmaAllocationCreateInfo>();
         allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
         allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
         Buffer buffer;
@@ -695,13 +882,6 @@ VkResult Renderer::create_image_view_and_sampler(VkQueue vkQueue, VkCommandBuffe
                 dispatchTable.gvkCmdPipelineBarrier(vkCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
             }
         ));
-
-        auto imageViewCreateInfo = get_default<VkImageViewCreateInfo>();
-        imageViewCreateInfo.image = image;
-        imageViewCreateInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        imageViewCreateInfo.format = imageCreateInfo.format;
-        gvk_result(ImageView::create(mDevice, &imageViewCreateInfo, pAllocator, &mFontImageView));
-        gvk_result(Sampler::create(mDevice, &get_default<VkSamplerCreateInfo>(), pAllocator, &mFontSampler));
     } gvk_result_scope_end;
     return gvkResult;
 }
@@ -752,6 +932,42 @@ VkResult Renderer::allocate_and_update_descriptor_set(const VkAllocationCallback
     return gvkResult;
 }
 
+VkResult Renderer::create_vertex_index_buffer(uint32_t regionCount, VkDeviceSize regionSize)
+{
+    assert(mDevice);
+    assert(regionCount);
+    assert(regionSize);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : Regions are aligned so that every region's vertex and index data
+        //  offsets satisfy vkCmdBindVertexBuffers()/vkCmdBindIndexBuffer().
+        const VkDeviceSize RegionAlignment = 256;
+        regionSize = (regionSize + RegionAlignment - 1) / RegionAlignment * RegionAlignment;
+        if (mVertexIndexBuffer) {
+            auto retiredFrameIndex = mFrameIndex + mFramesInFlight + 1;
+            mRetiredVertexIndexBuffers.emplace_back(retiredFrameIndex, std::move(mVertexIndexBuffer));
+        }
+        mVertexIndexBuffer.reset();
+        mpVertexIndexData = nullptr;
+        mVertexIndexRegionCount = 0;
+        mVertexIndexRegionSize = 0;
+
+        auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
+        bufferCreateInfo.size = regionCount * regionSize;
+        bufferCreateInfo.usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+        auto allocationCreateInfo = get_default<VmaAllocationCreateInfo>();
+        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        gvk_result(Buffer::create(mDevice, &bufferCreateInfo, &allocationCreateInfo, &mVertexIndexBuffer));
+        VmaAllocationInfo allocationInfo { };
+        vmaGetAllocationInfo(mDevice.get<VmaAllocator>(), mVertexIndexBuffer.get<VmaAllocation>(), &allocationInfo);
+        mpVertexIndexData = (uint8_t*)allocationInfo.pMappedData;
+        gvk_result(mpVertexIndexData ? VK_SUCCESS : VK_ERROR_MEMORY_MAP_FAILED);
+        mVertexIndexRegionCount = regionCount;
+        mVertexIndexRegionSize = regionSize;
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
 void Renderer::record_render_state_setup_cmds(VkCommandBuffer vkCommandBuffer, const ImDrawData* pImDrawData) const
 {
     const auto& dispatchTable = mDevice.get<DispatchTable>();
@@ -776,8 +992,7 @@ void Renderer::record_render_state_setup_cmds(VkCommandBuffer vkCommandBuffer, c
     dispatchTable.gvkCmdPushConstants(vkCommandBuffer, mPipeline.get<PipelineLayout>(), VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(pushContstants), &pushContstants);
 
     if (pImDrawData->TotalVtxCount) {
-        VkDeviceSize vertexDataOffset = 0;
-        dispatchTable.gvkCmdBindVertexBuffers(vkCommandBuffer, 0, 1, &mVertexIndexBuffer.get<VkBuffer>(), &vertexDataOffset);
+        dispatchTable.gvkCmdBindVertexBuffers(vkCommandBuffer, 0, 1, &mVertexIndexBuffer.get<VkBuffer>(), &mVertexDataOffset);
         dispatchTable.gvkCmdBindIndexBuffer(vkCommandBuffer, mVertexIndexBuffer, mIndexDataOffset, get_index_type<ImDrawIdx>());
     }
 }
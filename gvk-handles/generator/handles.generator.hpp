@@ -53,10 +53,12 @@ public:
             add_member(MemberInfo("VkInstance", "mVkInstance", "VkInstance"));
         }
         if (handle.name == "VkDevice") {
+            add_manually_implemented_ctor("VkResult create(const PhysicalDevice& physicalDevice, const VkDeviceCreateInfo* pCreateInfo, VmaAllocatorCreateFlags vmaAllocatorCreateFlags, const VkAllocationCallbacks* pAllocator, Device* pDevice)");
             add_manually_implemented_ctor("VkResult create_unmanaged(const PhysicalDevice& physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, const DispatchTable* pDispatchTable, VkDevice vkDevice, Device *pGvkDevice)");
             add_member(MemberInfo("Instance", "mInstance", "Instance"));
             add_member(MemberInfo("std::vector<QueueFamily>", "mQueueFamilies", "std::vector<QueueFamily>"));
             add_member(MemberInfo("VmaAllocator", "mVmaAllocator", "VmaAllocator"));
+            add_member(MemberInfo("VmaAllocatorCreateFlags", "mVmaAllocatorCreateFlags"));
             add_member(MemberInfo("bool", "mUnmanaged"));
             add_manually_implemented_dtor();
         }
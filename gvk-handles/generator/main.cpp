@@ -29,10 +29,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 int main(int, const char*[])
 {
-    tinyxml2::XMLDocument xmlDocument;
-    auto xmlResult = xmlDocument.LoadFile(GVK_XML_FILE_PATH);
-    if (xmlResult == tinyxml2::XML_SUCCESS) {
-        gvk::xml::Manifest manifest(xmlDocument);
+    gvk::xml::Manifest manifest;
+    if (gvk::xml::load_manifest(GVK_XML_FILE_PATH, GVK_XML_MANIFEST_CACHE_DIRECTORY, manifest)) {
         gvk::cppgen::HandlesGenerator::generate(manifest);
     }
     return 0;
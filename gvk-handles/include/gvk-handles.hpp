@@ -28,10 +28,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-handles/generated/forward-declarations.inl"
 #include "gvk-handles/generated/handles.hpp"
+#include "gvk-handles/allocation-pool.hpp"
+#include "gvk-handles/buffer-suballocator.hpp"
 #include "gvk-handles/context.hpp"
 #include "gvk-handles/defines.hpp"
 #include "gvk-handles/handles.hpp"
+#include "gvk-handles/immediate-executor.hpp"
 #include "gvk-handles/mesh.hpp"
 #include "gvk-handles/render-target.hpp"
+#include "gvk-handles/upload-manager.hpp"
 #include "gvk-handles/utilities.hpp"
 #include "gvk-handles/wsi-manager.hpp"
@@ -0,0 +1,191 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-handles/handles.hpp"
+#include "gvk-defines.hpp"
+
+#include <string>
+
+namespace gvk {
+
+/**
+Provides a named VmaPool for Buffer and Image objects that share a memory type
+    @note Buffer and Image objects are allocated from an AllocationPool by passing the VmaAllocationCreateInfo returned from get_allocation_create_info() to Buffer::create() or Image::create()
+    @note All Buffer and Image objects allocated from an AllocationPool must be destroyed before the AllocationPool is destroyed
+*/
+class AllocationPool final
+{
+public:
+    /**
+    Specifies how an AllocationPool places allocations in its blocks
+    */
+    enum class Algorithm
+    {
+        /**
+        The VmaAllocator's general purpose algorithm, allocations may be freed in any order
+        */
+        Default,
+
+        /**
+        Allocations are placed one after another, space is only reclaimed when allocations at the end (or the beginning, with VMA_ALLOCATION_CREATE_UPPER_ADDRESS_BIT, at the top) are freed
+            @note Suitable for allocations that are freed together or in reverse order
+        */
+        Linear,
+
+        /**
+        Allocations are placed one after another in a single block, wrapping to the beginning when the end of the block is reached
+            @note Allocations must be freed in the order they were made
+            @note CreateInfo::blockSize must be set
+        */
+        Ring,
+    };
+
+    /**
+    Creation parameters for AllocationPool
+    */
+    struct CreateInfo
+    {
+        /**
+        Optional name for the AllocationPool, visible in VMA statistics
+        */
+        const char* pName { nullptr };
+
+        /**
+        The Algorithm to place allocations with
+        */
+        Algorithm algorithm { Algorithm::Default };
+
+        /**
+        A representative VkBufferCreateInfo used to select the AllocationPool object's memory type
+            @note Either pBufferCreateInfo or pImageCreateInfo must be provided
+        */
+        const VkBufferCreateInfo* pBufferCreateInfo { nullptr };
+
+        /**
+        A representative VkImageCreateInfo used to select the AllocationPool object's memory type
+            @note Either pBufferCreateInfo or pImageCreateInfo must be provided
+        */
+        const VkImageCreateInfo* pImageCreateInfo { nullptr };
+
+        /**
+        The VmaAllocationCreateInfo used to select the AllocationPool object's memory type
+            @note If usage is VMA_MEMORY_USAGE_UNKNOWN, VMA_MEMORY_USAGE_AUTO is used
+        */
+        VmaAllocationCreateInfo allocationCreateInfo { };
+
+        /**
+        The size of each block of memory allocated for the AllocationPool
+            @note If 0, the VmaAllocator's preferred block size is used
+        */
+        VkDeviceSize blockSize { 0 };
+
+        /**
+        The number of blocks to allocate when the AllocationPool is created
+        */
+        size_t minBlockCount { 0 };
+
+        /**
+        The maximum number of blocks the AllocationPool may allocate
+            @note If 0, the number of blocks is unlimited
+            @note Ignored for Algorithm::Ring
+        */
+        size_t maxBlockCount { 0 };
+    };
+
+    /**
+    Creates an instance of AllocationPool
+    @param [in] device The Device to create the AllocationPool with
+    @param [in] pCreateInfo A pointer to the AllocationPool creation parameters
+    @param [out] pAllocationPool A pointer to the AllocationPool to create
+    @return The VkResult
+    */
+    static VkResult create(const Device& device, const CreateInfo* pCreateInfo, AllocationPool* pAllocationPool);
+
+    /**
+    Constructs an instance of AllocationPool
+    */
+    AllocationPool() = default;
+
+    /**
+    Destroys this instance of AllocationPool
+    */
+    ~AllocationPool();
+
+    /**
+    Destroys this instance of AllocationPool
+    */
+    void reset();
+
+    /**
+    Gets this AllocationPool object's Device
+    @return This AllocationPool object's Device
+    */
+    const Device& get_device() const;
+
+    /**
+    Gets this AllocationPool object's name
+    @return This AllocationPool object's name
+    */
+    const std::string& get_name() const;
+
+    /**
+    Gets this AllocationPool object's Algorithm
+    @return This AllocationPool object's Algorithm
+    */
+    Algorithm get_algorithm() const;
+
+    /**
+    Gets this AllocationPool object's VmaPool
+    @return This AllocationPool object's VmaPool
+    */
+    VmaPool get_vma_pool() const;
+
+    /**
+    Gets a VmaAllocationCreateInfo that allocates from this AllocationPool
+    @param [in] (optional = 0) flags The VmaAllocationCreateFlags to populate the VmaAllocationCreateInfo with
+    @return A VmaAllocationCreateInfo that allocates from this AllocationPool
+    */
+    VmaAllocationCreateInfo get_allocation_create_info(VmaAllocationCreateFlags flags = 0) const;
+
+    /**
+    Gets this AllocationPool object's VmaStatistics
+    @return This AllocationPool object's VmaStatistics
+    */
+    VmaStatistics get_statistics() const;
+
+private:
+    Device mDevice;
+    VmaPool mVmaPool { VK_NULL_HANDLE };
+    std::string mName;
+    Algorithm mAlgorithm { Algorithm::Default };
+
+    AllocationPool(const AllocationPool&) = delete;
+    AllocationPool& operator=(const AllocationPool&) = delete;
+};
+
+} // namespace gvk
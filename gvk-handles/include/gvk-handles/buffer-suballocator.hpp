@@ -0,0 +1,235 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-handles/handles.hpp"
+#include "gvk-defines.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace gvk {
+
+class BufferRange;
+
+/**
+Provides BufferRange objects sub-allocated from a single parent Buffer
+    @note BufferRange objects are offset/size views into the parent Buffer, no VkBuffer or VmaAllocation is created per BufferRange
+    @note BufferSuballocator is thread safe, BufferRange objects may be allocated and released from any thread
+    @note The parent Buffer is kept alive until the BufferSuballocator and all of its BufferRange objects are destroyed
+*/
+class BufferSuballocator final
+{
+public:
+    /**
+    Creation parameters for BufferSuballocator
+    */
+    struct CreateInfo
+    {
+        /**
+        The VkBufferCreateInfo to create the parent Buffer with
+        */
+        const VkBufferCreateInfo* pBufferCreateInfo { nullptr };
+
+        /**
+        The VmaAllocationCreateInfo to create the parent Buffer with
+            @note May reference an AllocationPool
+            @note If VMA_ALLOCATION_CREATE_MAPPED_BIT is set, BufferRange::get_mapped_data() returns a pointer into the parent Buffer object's mapped memory
+        */
+        const VmaAllocationCreateInfo* pAllocationCreateInfo { nullptr };
+
+        /**
+        Whether or not to place BufferRange objects one after another
+            @note Linear placement is faster but space is only reclaimed when BufferRange objects at the end of the parent Buffer are released
+        */
+        VkBool32 linear { VK_FALSE };
+
+        /**
+        The minimum alignment of each BufferRange object's offset
+            @note The alignment is raised to the Device object's minimum uniform, storage, and texel buffer offset alignments based on the parent Buffer object's usage
+        */
+        VkDeviceSize minAlignment { 1 };
+    };
+
+    /**
+    Creates an instance of BufferSuballocator
+    @param [in] device The Device to create the parent Buffer with
+    @param [in] pCreateInfo A pointer to the BufferSuballocator creation parameters
+    @param [out] pBufferSuballocator A pointer to the BufferSuballocator to create
+    @return The VkResult
+    */
+    static VkResult create(const Device& device, const CreateInfo* pCreateInfo, BufferSuballocator* pBufferSuballocator);
+
+    /**
+    Constructs an instance of BufferSuballocator
+    */
+    BufferSuballocator() = default;
+
+    /**
+    Destroys this instance of BufferSuballocator
+        @note Outstanding BufferRange objects remain valid until they're released
+    */
+    ~BufferSuballocator();
+
+    /**
+    Destroys this instance of BufferSuballocator
+        @note Outstanding BufferRange objects remain valid until they're released
+    */
+    void reset();
+
+    /**
+    Gets this BufferSuballocator object's parent Buffer
+    @return This BufferSuballocator object's parent Buffer
+    */
+    const Buffer& get_buffer() const;
+
+    /**
+    Gets the minimum alignment of this BufferSuballocator object's BufferRange offsets
+    @return The minimum alignment of this BufferSuballocator object's BufferRange offsets
+    */
+    VkDeviceSize get_min_alignment() const;
+
+    /**
+    Gets this BufferSuballocator object's VmaStatistics
+    @return This BufferSuballocator object's VmaStatistics
+    */
+    VmaStatistics get_statistics() const;
+
+    /**
+    Allocates a BufferRange from this BufferSuballocator object's parent Buffer
+    @param [in] size The size of the BufferRange to allocate
+    @param [in] alignment The alignment of the BufferRange to allocate, raised to get_min_alignment() if lower
+    @param [out] pBufferRange A pointer to the BufferRange to allocate
+    @return The VkResult
+        @note Returns VK_ERROR_OUT_OF_DEVICE_MEMORY if the parent Buffer doesn't have space for the BufferRange
+    */
+    VkResult allocate(VkDeviceSize size, VkDeviceSize alignment, BufferRange* pBufferRange);
+
+private:
+    class Block final
+    {
+    public:
+        ~Block();
+        Buffer buffer;
+        uint8_t* pMappedData { nullptr };
+        VmaVirtualBlock vmaVirtualBlock { VK_NULL_HANDLE };
+        std::mutex mutex;
+    };
+
+    std::shared_ptr<Block> mspBlock;
+    VkDeviceSize mMinAlignment { 1 };
+
+    friend class BufferRange;
+    BufferSuballocator(const BufferSuballocator&) = delete;
+    BufferSuballocator& operator=(const BufferSuballocator&) = delete;
+};
+
+/**
+Provides an offset/size view into a BufferSuballocator object's parent Buffer
+    @note The BufferRange is released back to its BufferSuballocator when it's reset or destroyed
+*/
+class BufferRange final
+{
+public:
+    /**
+    Constructs an instance of BufferRange
+    */
+    BufferRange() = default;
+
+    /**
+    Moves an instance of BufferRange
+    @param [in] other The BufferRange to move from
+    */
+    BufferRange(BufferRange&& other);
+
+    /**
+    Moves an instance of BufferRange
+    @param [in] other The BufferRange to move from
+    @return A reference to this BufferRange
+    */
+    BufferRange& operator=(BufferRange&& other);
+
+    /**
+    Destroys this instance of BufferRange
+    */
+    ~BufferRange();
+
+    /**
+    Gets a value indicating whether or not this BufferRange is valid
+    @return Whether or not this BufferRange is valid
+    */
+    operator bool() const;
+
+    /**
+    Releases this BufferRange back to its BufferSuballocator
+        @note The application is responsible for ensuring the GPU is no longer accessing this BufferRange
+    */
+    void reset();
+
+    /**
+    Gets this BufferRange object's parent Buffer
+    @return This BufferRange object's parent Buffer
+    */
+    const Buffer& get_buffer() const;
+
+    /**
+    Gets this BufferRange object's offset in its parent Buffer
+    @return This BufferRange object's offset in its parent Buffer
+    */
+    VkDeviceSize get_offset() const;
+
+    /**
+    Gets this BufferRange object's size
+    @return This BufferRange object's size
+    */
+    VkDeviceSize get_size() const;
+
+    /**
+    Gets a pointer to this BufferRange object's mapped memory
+    @return A pointer to this BufferRange object's mapped memory
+        @note Returns nullptr if the parent Buffer isn't persistently mapped
+    */
+    uint8_t* get_mapped_data() const;
+
+    /**
+    Gets a VkDescriptorBufferInfo that describes this BufferRange
+    @return A VkDescriptorBufferInfo that describes this BufferRange
+    */
+    VkDescriptorBufferInfo get_descriptor_buffer_info() const;
+
+private:
+    std::shared_ptr<BufferSuballocator::Block> mspBlock;
+    VmaVirtualAllocation mVmaVirtualAllocation { VK_NULL_HANDLE };
+    VkDeviceSize mOffset { 0 };
+    VkDeviceSize mSize { 0 };
+
+    friend class BufferSuballocator;
+    BufferRange(const BufferRange&) = delete;
+    BufferRange& operator=(const BufferRange&) = delete;
+};
+
+} // namespace gvk
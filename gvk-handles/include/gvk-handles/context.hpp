@@ -73,6 +73,13 @@ public:
         Optional VkDevice creation parameters
         */
         const VkDeviceCreateInfo* pDeviceCreateInfo { nullptr };
+
+        /**
+        Additional VmaAllocatorCreateFlags to create each Device object's VmaAllocator with
+            @note VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT, VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT, and VMA_ALLOCATOR_CREATE_EXT_MEMORY_PRIORITY_BIT are set automatically when the corresponding features/extensions are enabled in pDeviceCreateInfo
+            @note If VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT is set, the application is responsible for synchronizing creation and destruction of Buffer and Image objects
+        */
+        VmaAllocatorCreateFlags vmaAllocatorCreateFlags { 0 };
     };
 
     /**
@@ -202,6 +209,7 @@ protected:
     std::vector<PhysicalDevice> mPhysicalDevices;
     std::vector<Device> mDevices;
     std::vector<CommandBuffer> mCommandBuffers;
+    VmaAllocatorCreateFlags mVmaAllocatorCreateFlags { 0 };
 
 private:
     Context(const Context&) = delete;
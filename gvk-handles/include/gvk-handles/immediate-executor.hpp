@@ -0,0 +1,211 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-dispatch-table.hpp"
+#include "gvk-handles/handles.hpp"
+#include "gvk-defines.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gvk {
+
+/**
+Provides recycled CommandBuffer and Fence objects for one-shot GPU work
+    @note ImmediateExecutor is not thread safe, each ImmediateExecutor must only be used by one thread at a time
+    @note Access to the VkQueue that work is submitted to must be externally synchronized, if the VkQueue is used by other threads or objects, provide the std::mutex that guards it with CreateInfo::pQueueMutex
+    @note Work recorded with record() is batched into a single submission until submit() is called
+    @note CommandBuffer and Fence objects are recycled when their Fence is signaled and no Ticket refers to them
+*/
+class ImmediateExecutor final
+{
+private:
+    class Job;
+
+public:
+    /**
+    Identifies work submitted by an ImmediateExecutor
+    */
+    class Ticket final
+    {
+    public:
+        /**
+        Waits for the work identified by this Ticket to complete
+        @param [in] (optional = UINT64_MAX) timeout How long to wait, in nanoseconds
+        @return The VkResult
+        */
+        VkResult wait(uint64_t timeout = UINT64_MAX) const;
+
+        /**
+        Gets a value indicating whether or not the work identified by this Ticket has completed
+        @return Whether or not the work identified by this Ticket has completed
+            @note A Ticket that doesn't identify any work is complete
+        */
+        VkBool32 is_complete() const;
+
+        /**
+        Releases this Ticket's reference to its work, allowing its resources to be recycled
+        */
+        void reset();
+
+    private:
+        std::shared_ptr<Job> mspJob;
+        friend class ImmediateExecutor;
+    };
+
+    /**
+    Creation parameters for ImmediateExecutor
+    */
+    struct CreateInfo
+    {
+        /**
+        The index of the queue family to submit work to
+        */
+        uint32_t queueFamilyIndex{ };
+
+        /**
+        (optional) The VkQueue to submit work to, must be from the queue family at queueFamilyIndex
+            @note If VK_NULL_HANDLE, the first VkQueue in the queue family will be used
+        */
+        VkQueue queue{ VK_NULL_HANDLE };
+
+        /**
+        (optional) A pointer to the std::mutex that guards the VkQueue, it's locked for each submission
+            @note The std::mutex must outlive the ImmediateExecutor
+        */
+        std::mutex* pQueueMutex{ nullptr };
+    };
+
+    /**
+    Creates an instance of ImmediateExecutor
+    @param [in] device The Device used to create ImmediateExecutor resources
+    @param [in] pCreateInfo A pointer to the ImmediateExecutor creation parameters
+    @param [in] (optional) pAllocator A pointer to the VkAllocationCallbacks to use
+    @param [out] pImmediateExecutor A pointer to the ImmediateExecutor to create
+    @return The VkResult
+    */
+    static VkResult create(const Device& device, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, ImmediateExecutor* pImmediateExecutor);
+
+    /**
+    Constructs an instance of ImmediateExecutor
+    */
+    ImmediateExecutor() = default;
+
+    /**
+    Destroys this instance of ImmediateExecutor
+        @note Recorded work is submitted and all submitted work is waited on
+    */
+    ~ImmediateExecutor();
+
+    /**
+    Destroys this instance of ImmediateExecutor
+        @note Recorded work is submitted and all submitted work is waited on
+    */
+    void reset();
+
+    /**
+    Gets this ImmediateExecutor object's Device
+    @return This ImmediateExecutor object's Device
+    */
+    const Device& get_device() const;
+
+    /**
+    Records commands into this ImmediateExecutor object's pending submission
+    @typename <RecordCommandBufferFunctionType> The type of function to call to record the VkCommandBuffer
+        @note The function type must accept a single VkCommandBuffer argument
+    @param [in] recordCommandBuffer The function to call to record the VkCommandBuffer
+    @return The VkResult
+        @note Recorded commands aren't submitted until submit() or execute() is called
+    */
+    template <typename RecordCommandBufferFunctionType>
+    inline VkResult record(RecordCommandBufferFunctionType recordCommandBuffer)
+    {
+        VkCommandBuffer vkCommandBuffer = VK_NULL_HANDLE;
+        auto vkResult = begin_recording(&vkCommandBuffer);
+        if (vkResult == VK_SUCCESS) {
+            recordCommandBuffer(vkCommandBuffer);
+        }
+        return vkResult;
+    }
+
+    /**
+    Submits this ImmediateExecutor object's pending submission without waiting for it to complete
+    @param [out] (optional) pTicket A pointer to a Ticket to populate with the submitted work
+    @return The VkResult
+        @note If no commands are pending, pTicket is populated with a Ticket that doesn't identify any work
+    */
+    VkResult submit(Ticket* pTicket = nullptr);
+
+    /**
+    Records commands and submits this ImmediateExecutor object's pending submission without waiting for it to complete
+    @typename <RecordCommandBufferFunctionType> The type of function to call to record the VkCommandBuffer
+        @note The function type must accept a single VkCommandBuffer argument
+    @param [in] recordCommandBuffer The function to call to record the VkCommandBuffer
+    @param [out] (optional) pTicket A pointer to a Ticket to populate with the submitted work
+    @return The VkResult
+    */
+    template <typename RecordCommandBufferFunctionType>
+    inline VkResult execute(RecordCommandBufferFunctionType recordCommandBuffer, Ticket* pTicket = nullptr)
+    {
+        auto vkResult = record(recordCommandBuffer);
+        return vkResult == VK_SUCCESS ? submit(pTicket) : vkResult;
+    }
+
+    /**
+    Submits pending work and waits for all work submitted by this ImmediateExecutor to complete
+    @return The VkResult
+        @note Unlike vkQueueWaitIdle(), this only waits on this ImmediateExecutor object's submissions
+    */
+    VkResult wait_idle();
+
+private:
+    class Job final
+    {
+    public:
+        CommandBuffer commandBuffer;
+        Fence fence;
+    };
+
+    VkResult begin_recording(VkCommandBuffer* pVkCommandBuffer);
+    VkResult recycle_jobs();
+
+    Device mDevice;
+    VkAllocationCallbacks mAllocator{ };
+    Queue mQueue;
+    std::mutex* mpQueueMutex{ nullptr };
+    CommandPool mCommandPool;
+    std::shared_ptr<Job> mspRecordingJob;
+    std::vector<std::shared_ptr<Job>> mSubmittedJobs;
+    std::vector<std::shared_ptr<Job>> mAvailableJobs;
+
+    ImmediateExecutor(const ImmediateExecutor&) = delete;
+    ImmediateExecutor& operator=(const ImmediateExecutor&) = delete;
+};
+
+} // namespace gvk
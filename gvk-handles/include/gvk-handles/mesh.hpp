@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-dispatch-table.hpp"
 #include "gvk-defines.hpp"
 #include "gvk-handles/handles.hpp"
+#include "gvk-handles/upload-manager.hpp"
 #include "gvk-handles/utilities.hpp"
 
 namespace gvk {
@@ -55,18 +56,13 @@ public:
             if (device && vkCommandBuffer && vkQueue && vertexCount && pVertices && indexCount && pIndices) {
                 auto vertexDataSize = vertexCount * sizeof(VertexType);
                 auto indexDataSize = indexCount * sizeof(IndexType);
-                mIndexDataOffset = vertexDataSize;
-                mIndexType = get_index_type<IndexType>();
-                mIndexCount = indexCount;
+                gvk_result(create_gpu_buffer(device, vertexDataSize, indexDataSize, get_index_type<IndexType>(), indexCount));
 
                 auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
                 bufferCreateInfo.size = vertexDataSize + indexDataSize;
-                bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+                bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
                 VmaAllocationCreateInfo allocationCreateInfo{ };
                 allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
-                gvk_result(Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &mGpuBuffer));
-
-                bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
                 allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
                 gvk_result(Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &mCpuBuffer));
 
@@ -91,7 +87,32 @@ public:
         return gvkResult;
     }
 
+    template <typename VertexType, typename IndexType>
+    VkResult write(
+        UploadManager& uploadManager,
+        uint32_t vertexCount,
+        const VertexType* pVertices,
+        uint32_t indexCount,
+        const IndexType* pIndices,
+        UploadManager::Ticket* pTicket = nullptr
+    )
+    {
+        gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+            if (uploadManager.get_device() && vertexCount && pVertices && indexCount && pIndices) {
+                auto vertexDataSize = vertexCount * sizeof(VertexType);
+                auto indexDataSize = indexCount * sizeof(IndexType);
+                gvk_result(create_gpu_buffer(uploadManager.get_device(), vertexDataSize, indexDataSize, get_index_type<IndexType>(), indexCount));
+                mCpuBuffer.reset();
+                gvk_result(uploadManager.upload(mGpuBuffer, 0, vertexDataSize, pVertices));
+                gvk_result(uploadManager.upload(mGpuBuffer, mIndexDataOffset, indexDataSize, pIndices, pTicket));
+            }
+        } gvk_result_scope_end
+        return gvkResult;
+    }
+
 private:
+    VkResult create_gpu_buffer(const Device& device, VkDeviceSize vertexDataSize, VkDeviceSize indexDataSize, VkIndexType indexType, uint32_t indexCount);
+
     gvk::Buffer mCpuBuffer;
     gvk::Buffer mGpuBuffer;
     VkDeviceSize mIndexDataOffset { };
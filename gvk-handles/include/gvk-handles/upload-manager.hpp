@@ -0,0 +1,214 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-handles/handles.hpp"
+#include "gvk-defines.hpp"
+
+#include <deque>
+#include <vector>
+
+namespace gvk {
+
+/**
+Provides batched staging uploads to Buffer and Image objects
+    @note UploadManager stages data in a persistently mapped ring Buffer and records copies into command buffers that are submitted in batches
+    @note Uploads larger than the ring Buffer are staged in a dedicated Buffer that's released when its batch completes
+    @note Each batch signals a Fence and, when the timelineSemaphore feature is enabled, a timeline Semaphore with the batch's Ticket value
+    @note Uploaded resources must be used on the UploadManager object's queue family or be created with VK_SHARING_MODE_CONCURRENT
+*/
+class UploadManager final
+{
+public:
+    /**
+    Identifies the batch that an upload is recorded into
+        @note A Ticket is the value that the timeline Semaphore is signaled with when the batch completes
+    */
+    using Ticket = uint64_t;
+
+    /**
+    Creation parameters for UploadManager
+    */
+    struct CreateInfo
+    {
+        /**
+        The index of the queue family to submit uploads to, the first VkQueue in the queue family will be used
+        */
+        uint32_t queueFamilyIndex{ };
+
+        /**
+        The size of the persistently mapped ring Buffer used to stage uploads
+        */
+        VkDeviceSize ringBufferSize{ 64 * 1024 * 1024 };
+
+        /**
+        The number of staged bytes that causes a batch to be submitted automatically
+            @note If 0, a batch is submitted automatically when it stages a quarter of ringBufferSize
+        */
+        VkDeviceSize batchSize{ };
+    };
+
+    /**
+    Creates an instance of UploadManager
+    @param [in] device The Device used to create UploadManager resources
+    @param [in] pCreateInfo A pointer to the UploadManager creation parameters
+    @param [in] (optional) pAllocator A pointer to the VkAllocationCallbacks to use
+    @param [out] pUploadManager A pointer to the UploadManager to create
+    @return the VkResult
+    */
+    static VkResult create(const Device& device, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, UploadManager* pUploadManager);
+
+    /**
+    Constructs an instance of UploadManager
+    */
+    UploadManager() = default;
+
+    /**
+    Destroys this instance of UploadManager
+        @note Pending uploads are submitted and waited on
+    */
+    ~UploadManager();
+
+    /**
+    Destroys this instance of UploadManager
+        @note Pending uploads are submitted and waited on
+    */
+    void reset();
+
+    /**
+    Gets this UploadManager object's Device
+    @return This UploadManager object's Device
+    */
+    const Device& get_device() const;
+
+    /**
+    Gets this UploadManager object's timeline Semaphore
+    @return This UploadManager object's timeline Semaphore
+        @note If the timelineSemaphore feature isn't enabled on the Device the returned Semaphore will be null
+        @note Submissions that consume uploaded resources may wait on this Semaphore with a Ticket value instead of waiting on the host
+    */
+    const Semaphore& get_timeline_semaphore() const;
+
+    /**
+    Records an upload to a Buffer
+    @param [in] buffer The Buffer to upload to, must have been created with VK_BUFFER_USAGE_TRANSFER_DST_BIT
+    @param [in] offset The offset in the Buffer to upload to
+    @param [in] size The number of bytes to upload
+    @param [in] pData A pointer to the data to upload
+    @param [out] (optional) pTicket A pointer to a Ticket to populate with the Ticket of the batch the upload is recorded into
+    @return the VkResult
+        @note The upload isn't guaranteed to be submitted until submit() or flush() is called or the batch fills
+    */
+    VkResult upload(const Buffer& buffer, VkDeviceSize offset, VkDeviceSize size, const void* pData, Ticket* pTicket = nullptr);
+
+    /**
+    Records an upload to an Image
+    @param [in] image The Image to upload to, must have been created with VK_IMAGE_USAGE_TRANSFER_DST_BIT
+    @param [in] oldLayout The VkImageLayout the Image is in before the upload
+    @param [in] newLayout The VkImageLayout to transition the Image to after the upload
+    @param [in] regionCount The number of VkBufferImageCopy regions to upload
+    @param [in] pRegions A pointer to the VkBufferImageCopy regions to upload, bufferOffset members are relative to pData
+    @param [in] size The number of bytes at pData
+    @param [in] pData A pointer to the data to upload
+    @param [out] (optional) pTicket A pointer to a Ticket to populate with the Ticket of the batch the upload is recorded into
+    @return the VkResult
+        @note The subresources referenced by pRegions are transitioned from oldLayout to newLayout
+        @note The upload isn't guaranteed to be submitted until submit() or flush() is called or the batch fills
+    */
+    VkResult upload(const Image& image, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions, VkDeviceSize size, const void* pData, Ticket* pTicket = nullptr);
+
+    /**
+    Submits recorded uploads without waiting for them to complete
+    @param [out] (optional) pTicket A pointer to a Ticket to populate with the Ticket of the submitted batch
+    @return the VkResult
+        @note If no uploads are recorded, pTicket is populated with the Ticket of the most recently submitted batch
+    */
+    VkResult submit(Ticket* pTicket = nullptr);
+
+    /**
+    Submits recorded uploads and waits for all uploads to complete
+    @return the VkResult
+    */
+    VkResult flush();
+
+    /**
+    Waits for the batch identified by a Ticket to complete
+    @param [in] ticket The Ticket of the batch to wait on
+    @param [in] (optional = UINT64_MAX) timeout How long to wait, in nanoseconds
+    @return the VkResult
+        @note If the batch identified by the Ticket hasn't been submitted it will be submitted before waiting
+    */
+    VkResult wait(Ticket ticket, uint64_t timeout = UINT64_MAX);
+
+    /**
+    Gets a value indicating whether or not the batch identified by a Ticket has completed
+    @param [in] ticket The Ticket of the batch to check
+    @return Whether or not the batch identified by the Ticket has completed
+        @note A Ticket that hasn't been issued by this UploadManager is never complete
+    */
+    VkBool32 is_complete(Ticket ticket);
+
+private:
+    class Batch final
+    {
+    public:
+        Ticket ticket{ };
+        CommandBuffer commandBuffer;
+        Fence fence;
+        VkDeviceSize ringBufferSize{ };
+        VkDeviceSize stagedSize{ };
+        std::vector<Buffer> dedicatedBuffers;
+        bool recording{ };
+    };
+
+    VkResult get_recording_batch(Batch** ppBatch);
+    VkResult allocate(VkDeviceSize size, VkDeviceSize alignment, Batch** ppBatch, Buffer* pBuffer, VkDeviceSize* pOffset, uint8_t** ppData);
+    VkResult retire_batches(bool wait);
+    VkResult submit_batch(Batch& batch);
+    VkResult wait_batch(Batch& batch, uint64_t timeout);
+    VkResult release_batch(Batch& batch);
+
+    Device mDevice;
+    VkAllocationCallbacks mAllocator{ };
+    Queue mQueue;
+    CommandPool mCommandPool;
+    Semaphore mTimelineSemaphore;
+    Buffer mRingBuffer;
+    uint8_t* mpRingBufferData{ };
+    VkDeviceSize mRingBufferHead{ };
+    VkDeviceSize mRingBufferUsed{ };
+    VkDeviceSize mBatchSize{ };
+    VkDeviceSize mOptimalBufferCopyOffsetAlignment{ 1 };
+    Ticket mNextTicket{ 1 };
+    std::deque<Batch> mBatches;
+    std::vector<Batch> mAvailableBatches;
+
+    UploadManager(const UploadManager&) = delete;
+    UploadManager& operator=(const UploadManager&) = delete;
+};
+
+} // namespace gvk
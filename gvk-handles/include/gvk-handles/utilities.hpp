@@ -76,6 +76,32 @@ Gets the VkExtent3D of a specified mip level for a VkImage with a specified VkEx
 */
 VkExtent3D get_mip_level_extent(const VkExtent3D& imageExtent, uint32_t mipLevel);
 
+/**
+Gets the number of bytes required to tightly pack a single VkImageAspectFlagBits of an image subresource with a specified VkFormat and VkExtent3D
+    @note Compressed and block based formats are sized in whole texel blocks, partial blocks at the edges of the VkExtent3D are rounded up
+    @note VK_IMAGE_ASPECT_PLANE_N_BIT aspects are sized using the plane's compatible VkFormat and the plane's width and height divisors
+@param [in] format The VkFormat of the image to get the data size for
+@param [in] extent The VkExtent3D of the image subresource to get the data size for
+@param [in] imageAspectFlagBits The VkImageAspectFlagBits to get the data size for
+@return The number of bytes required to tightly pack the specified image subresource aspect
+*/
+VkDeviceSize get_image_aspect_data_size(VkFormat format, const VkExtent3D& extent, VkImageAspectFlagBits imageAspectFlagBits);
+
+/**
+Gets VkBufferImageCopy regions that tightly pack a VkImageSubresourceRange into a buffer
+    @note One VkBufferImageCopy is provided for each aspect of each mip level of each array layer in the VkImageSubresourceRange, regions are ordered by array layer, then mip level, then aspect
+    @note A VkImageSubresourceRange with VK_IMAGE_ASPECT_COLOR_BIT for a multi-planar VkFormat gets one VkBufferImageCopy per plane
+    @note Each VkBufferImageCopy::bufferOffset is aligned to a multiple of 4 and the texel block size of the region's VkFormat
+@param [in] imageCreateInfo The VkImageCreateInfo of the image to get VkBufferImageCopy regions for
+@param [in] imageSubresourceRange The VkImageSubresourceRange to get VkBufferImageCopy regions for
+@param [in,out] pBufferImageCopyCount The number of VkBufferImageCopy regions
+    @note If pBufferImageCopies is null, pBufferImageCopyCount will be populated with the number of VkBufferImageCopy regions
+    @note If pBufferImageCopies is not null, pBufferImageCopyCount indicates the max number of VkBufferImageCopy regions to write to pBufferImageCopies
+@param [out] pBufferImageCopies The VkBufferImageCopy regions
+@return The number of bytes required to store the specified VkImageSubresourceRange
+*/
+VkDeviceSize get_buffer_image_copies(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange, uint32_t* pBufferImageCopyCount, VkBufferImageCopy* pBufferImageCopies);
+
 /**
 Gets the max VkSampleCountFlagBits for a Framebuffer with specified attachment types
 @param [in] vkPhysicalDevice
@@ -230,8 +256,9 @@ Record and execute a VkCommandBuffer immediately
 @param [in] vkQueue The VkQueue to submit the recorded VkCommandBuffer to
 @param [in] vkCommandBuffer The vkCommandBuffer to record and submit
 @param [in] vkFence The VkFence to signal when the submited VkCommandBuffer completes execution
-    @note If this argument is VK_NULL_HANDLE this call will block on vkQueueWaitIdle() after VkCommandBuffer submission
+    @note If this argument is VK_NULL_HANDLE this call will block on a transient Fence until the submitted VkCommandBuffer completes execution
 @return The VkResult
+    @note Use ImmediateExecutor to submit one-shot work without blocking and with recycled CommandBuffer and Fence objects
 */
 template <typename RecordCommandBufferFunctionType>
 inline VkResult execute_immediately(
@@ -257,12 +284,17 @@ inline VkResult execute_immediately(
         auto submitInfo = get_default<VkSubmitInfo>();
         submitInfo.commandBufferCount = 1;
         submitInfo.pCommandBuffers = &vkCommandBuffer;
-        assert(dispatchTable.gvkQueueSubmit);
-        gvk_result(dispatchTable.gvkQueueSubmit(vkQueue, 1, &submitInfo, vkFence));
-
+        // NOTE : When no VkFence is provided, wait on a transient Fence rather than
+        //  using vkQueueWaitIdle() so that other work on the VkQueue isn't waited on.
+        Fence fence;
         if (!vkFence) {
-            assert(dispatchTable.gvkQueueWaitIdle);
-            gvk_result(dispatchTable.gvkQueueWaitIdle(vkQueue));
+            gvk_result(Fence::create(device, &get_default<VkFenceCreateInfo>(), nullptr, &fence));
+        }
+        assert(dispatchTable.gvkQueueSubmit);
+        gvk_result(dispatchTable.gvkQueueSubmit(vkQueue, 1, &submitInfo, vkFence ? vkFence : fence.get<VkFence>()));
+        if (fence) {
+            assert(dispatchTable.gvkWaitForFences);
+            gvk_result(dispatchTable.gvkWaitForFences(device, 1, &fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
         }
     } gvk_result_scope_end
     return gvkResult;
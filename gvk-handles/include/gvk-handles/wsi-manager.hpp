@@ -108,6 +108,20 @@ public:
             @note The supported VkFormat with the highest bitcount that is less than or equal to the requested VkFormat will be selected
         */
         VkFormat depthFormat{ VK_FORMAT_UNDEFINED };
+
+        /**
+        The maximum number of frames that may be in flight
+            @note acquire_next_image() waits for the frame that was acquired maxFramesInFlight frames ago to complete before acquiring the next SwapchainKHR image
+            @note The requested SwapchainKHR image count will be at least maxFramesInFlight, subject to VkSurfaceCapabilitiesKHR::maxImageCount
+        */
+        uint32_t maxFramesInFlight{ 2 };
+
+        /**
+        The maximum number of presents that may be pending before acquire_next_image() waits, 0 disables present wait pacing
+            @note Present wait pacing requires VK_KHR_present_id and VK_KHR_present_wait to be enabled on the Device, if they aren't this value is ignored
+            @note When present wait pacing is enabled every successfully acquired SwapchainKHR image must be presented with the VkPresentInfoKHR from get_present_info()
+        */
+        uint32_t maxPresentLatency{ };
     };
 
     /**
@@ -193,17 +207,31 @@ public:
     const std::vector<VkFence>& get_vk_fences() const;
 
     /**
-    Gets this WsiManager object's image acquired Semaphore
-    @return This WsiManager object's image acquired Semaphore
+    Gets this WsiManager object's image acquired Semaphore for the current frame
+    @return This WsiManager object's image acquired Semaphore for the current frame
     */
     const Semaphore& get_image_acquired_semaphore() const;
 
     /**
-    Gets this WsiManager object's image rendered Semaphore
-    @return This WsiManager object's image rendered Semaphore
+    Gets this WsiManager object's image acquired Semaphore objects
+    @return This WsiManager object's image acquired Semaphore objects
+        @note There's one image acquired Semaphore per frame in flight
+    */
+    const std::vector<Semaphore>& get_image_acquired_semaphores() const;
+
+    /**
+    Gets this WsiManager object's image rendered Semaphore for the most recently acquired SwapchainKHR image
+    @return This WsiManager object's image rendered Semaphore for the most recently acquired SwapchainKHR image
     */
     const Semaphore& get_image_rendered_semaphore() const;
 
+    /**
+    Gets this WsiManager object's image rendered Semaphore objects
+    @return This WsiManager object's image rendered Semaphore objects
+        @note There's one image rendered Semaphore per SwapchainKHR image, a Semaphore waited on by a present can't be safely reused until its SwapchainKHR image is reacquired
+    */
+    const std::vector<Semaphore>& get_image_rendered_semaphores() const;
+
     /**
     Gets a value indicating whether or not this WsiManager object's resources are up to date
     @return This WsiManager object's status
@@ -230,6 +258,12 @@ public:
     */
     VkPresentModeKHR get_present_mode() const;
 
+    /**
+    Gets the maximum number of frames that may be in flight for this WsiManager
+    @return The maximum number of frames that may be in flight for this WsiManager
+    */
+    uint32_t get_max_frames_in_flight() const;
+
     /**
     Gets this WsiManager object's VkSampleCountFlagBits
     @return This WsiManager object's VkSampleCountFlagBits
@@ -260,6 +294,7 @@ public:
     @param [in] vkFence The VkFence to signal or VK_NULL_HANDLE
     @param [out] pImageIndex A pointer to a uint32_t to populate with the acquired image index
     @return The VkResult
+        @note Advances this WsiManager to its next frame, if the frame previously using the next frame's resources is still in flight this method waits for the Fence at get_fences()[imageIndex] that it was submitted with
     */
     VkResult acquire_next_image(uint64_t timeout, VkFence vkFence, uint32_t* pImageIndex);
 
@@ -267,6 +302,8 @@ public:
     Gets the VkSubmitInfo for the SwapchainKHR image at the specified index
     @param [in] imageIndex The index of the SwapchainKHR image to get the VkSubmitInfo for
     @return The VkSubmitInfo of the SwapchainKHR image at the specified index
+        @note The VkSubmitInfo waits on the current frame's image acquired Semaphore and signals the image rendered Semaphore for the SwapchainKHR image at the specified index
+        @note The VkSubmitInfo must be submitted with the Fence at get_fences()[imageIndex] for acquire_next_image() to track frames in flight
     */
     VkSubmitInfo get_submit_info(uint32_t imageIndex) const;
 
@@ -274,6 +311,7 @@ public:
     Gets the VkPresentInfoKHR for the SwapchainKHR image at the specified index
     @param [in] pImageIndex A pointer to a uint32_t populated with the index of the SwapchainKHR image to get the VkPresentInfoKHR for
     @return The VkPresentInfoKHR of the SwapchainKHR image at the specified index
+        @note If present wait pacing is enabled the VkPresentInfoKHR is chained with a VkPresentIdKHR identifying the current frame
     */
     VkPresentInfoKHR get_present_info(const uint32_t* pImageIndex) const;
 
@@ -281,7 +319,8 @@ private:
     VkResult validate();
     void invalidate();
     VkResult create_surface(const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator);
-    VkResult create_swapchain();
+    VkResult wait_for_fences();
+    VkResult create_swapchain(const SwapchainKHR& oldSwapchain);
     VkResult create_render_pass();
     VkResult create_command_buffers();
     VkResult create_render_targets();
@@ -295,10 +334,20 @@ private:
     std::vector<RenderTarget> mRenderTargets;
     std::vector<Fence> mFences;
     std::vector<VkFence> mVkFences;
-    Semaphore mImageAcquiredSemaphore;
-    Semaphore mImageRenderedSemaphore;
+    std::vector<Semaphore> mImageAcquiredSemaphores;
+    std::vector<Semaphore> mImageRenderedSemaphores;
+    SwapchainKHR mRetiredSwapchain;
+    std::vector<Semaphore> mRetiredImageRenderedSemaphores;
+    std::vector<uint32_t> mFrameImageIndices;
+    uint32_t mFrameIndex{ };
+    uint32_t mImageIndex{ };
+    uint64_t mPresentId{ };
+    uint64_t mSwapchainFirstPresentId{ 1 };
+    mutable VkPresentIdKHR mPresentIdKHR{ };
     uint32_t mQueueFamilyIndex{ };
     VkPresentModeKHR mPresentMode{ VK_PRESENT_MODE_FIFO_KHR };
+    uint32_t mMaxFramesInFlight{ 2 };
+    uint32_t mMaxPresentLatency{ };
     VkSampleCountFlagBits mSampleCount{ VK_SAMPLE_COUNT_1_BIT };
     VkFormat mDepthFormat{ VK_FORMAT_UNDEFINED };
     VkResult mStatus{ VK_ERROR_OUT_OF_DATE_KHR };
@@ -0,0 +1,141 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/allocation-pool.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#include <cassert>
+
+namespace gvk {
+
+VkResult AllocationPool::create(const Device& device, const CreateInfo* pCreateInfo, AllocationPool* pAllocationPool)
+{
+    assert(device);
+    assert(pCreateInfo);
+    assert(pCreateInfo->pBufferCreateInfo || pCreateInfo->pImageCreateInfo);
+    assert(pCreateInfo->algorithm != Algorithm::Ring || pCreateInfo->blockSize);
+    assert(pAllocationPool);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        pAllocationPool->reset();
+        auto vmaAllocator = device.get<VmaAllocator>();
+        auto allocationCreateInfo = pCreateInfo->allocationCreateInfo;
+        allocationCreateInfo.pool = VK_NULL_HANDLE;
+        if (allocationCreateInfo.usage == VMA_MEMORY_USAGE_UNKNOWN) {
+            allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        }
+        uint32_t memoryTypeIndex = 0;
+        if (pCreateInfo->pBufferCreateInfo) {
+            gvk_result(vmaFindMemoryTypeIndexForBufferInfo(vmaAllocator, pCreateInfo->pBufferCreateInfo, &allocationCreateInfo, &memoryTypeIndex));
+        } else {
+            gvk_result(vmaFindMemoryTypeIndexForImageInfo(vmaAllocator, pCreateInfo->pImageCreateInfo, &allocationCreateInfo, &memoryTypeIndex));
+        }
+
+        // NOTE : VMA implements ring buffers with its linear algorithm when a pool
+        //  is limited to a single block and allocations are freed in the order they
+        //  were made.
+        VmaPoolCreateInfo poolCreateInfo { };
+        poolCreateInfo.memoryTypeIndex = memoryTypeIndex;
+        poolCreateInfo.blockSize = pCreateInfo->blockSize;
+        poolCreateInfo.minBlockCount = pCreateInfo->minBlockCount;
+        poolCreateInfo.maxBlockCount = pCreateInfo->maxBlockCount;
+        switch (pCreateInfo->algorithm) {
+        case Algorithm::Linear: {
+            poolCreateInfo.flags |= VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
+        } break;
+        case Algorithm::Ring: {
+            poolCreateInfo.flags |= VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
+            poolCreateInfo.minBlockCount = 1;
+            poolCreateInfo.maxBlockCount = 1;
+        } break;
+        default: {
+        } break;
+        }
+        gvk_result(vmaCreatePool(vmaAllocator, &poolCreateInfo, &pAllocationPool->mVmaPool));
+        pAllocationPool->mDevice = device;
+        pAllocationPool->mName = pCreateInfo->pName ? pCreateInfo->pName : std::string();
+        pAllocationPool->mAlgorithm = pCreateInfo->algorithm;
+        if (!pAllocationPool->mName.empty()) {
+            vmaSetPoolName(vmaAllocator, pAllocationPool->mVmaPool, pAllocationPool->mName.c_str());
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+AllocationPool::~AllocationPool()
+{
+    reset();
+}
+
+void AllocationPool::reset()
+{
+    if (mVmaPool) {
+        assert(mDevice);
+        vmaDestroyPool(mDevice.get<VmaAllocator>(), mVmaPool);
+    }
+    mDevice.reset();
+    mVmaPool = VK_NULL_HANDLE;
+    mName.clear();
+    mAlgorithm = Algorithm::Default;
+}
+
+const Device& AllocationPool::get_device() const
+{
+    return mDevice;
+}
+
+const std::string& AllocationPool::get_name() const
+{
+    return mName;
+}
+
+AllocationPool::Algorithm AllocationPool::get_algorithm() const
+{
+    return mAlgorithm;
+}
+
+VmaPool AllocationPool::get_vma_pool() const
+{
+    return mVmaPool;
+}
+
+VmaAllocationCreateInfo AllocationPool::get_allocation_create_info(VmaAllocationCreateFlags flags) const
+{
+    assert(mVmaPool);
+    auto allocationCreateInfo = get_default<VmaAllocationCreateInfo>();
+    allocationCreateInfo.flags = flags;
+    allocationCreateInfo.pool = mVmaPool;
+    return allocationCreateInfo;
+}
+
+VmaStatistics AllocationPool::get_statistics() const
+{
+    assert(mVmaPool);
+    VmaStatistics statistics { };
+    vmaGetPoolStatistics(mDevice.get<VmaAllocator>(), mVmaPool, &statistics);
+    return statistics;
+}
+
+} // namespace gvk
@@ -0,0 +1,210 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/buffer-suballocator.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace gvk {
+
+VkResult BufferSuballocator::create(const Device& device, const CreateInfo* pCreateInfo, BufferSuballocator* pBufferSuballocator)
+{
+    assert(device);
+    assert(pCreateInfo);
+    assert(pCreateInfo->pBufferCreateInfo);
+    assert(pCreateInfo->pAllocationCreateInfo);
+    assert(pCreateInfo->minAlignment && !(pCreateInfo->minAlignment & (pCreateInfo->minAlignment - 1)));
+    assert(pBufferSuballocator);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        pBufferSuballocator->reset();
+        auto spBlock = std::make_shared<Block>();
+        gvk_result(Buffer::create(device, pCreateInfo->pBufferCreateInfo, pCreateInfo->pAllocationCreateInfo, &spBlock->buffer));
+        VmaAllocationInfo allocationInfo { };
+        vmaGetAllocationInfo(device.get<VmaAllocator>(), spBlock->buffer.get<VmaAllocation>(), &allocationInfo);
+        spBlock->pMappedData = (uint8_t*)allocationInfo.pMappedData;
+
+        VmaVirtualBlockCreateInfo virtualBlockCreateInfo { };
+        virtualBlockCreateInfo.size = pCreateInfo->pBufferCreateInfo->size;
+        virtualBlockCreateInfo.flags = pCreateInfo->linear ? VMA_VIRTUAL_BLOCK_CREATE_LINEAR_ALGORITHM_BIT : 0;
+        gvk_result(vmaCreateVirtualBlock(&virtualBlockCreateInfo, &spBlock->vmaVirtualBlock));
+
+        const auto& physicalDevice = device.get<PhysicalDevice>();
+        auto physicalDeviceProperties = get_default<VkPhysicalDeviceProperties>();
+        physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceProperties(physicalDevice, &physicalDeviceProperties);
+        const auto& limits = physicalDeviceProperties.limits;
+        auto usage = pCreateInfo->pBufferCreateInfo->usage;
+        auto minAlignment = pCreateInfo->minAlignment;
+        if (usage & VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT) {
+            minAlignment = std::max(minAlignment, limits.minUniformBufferOffsetAlignment);
+        }
+        if (usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) {
+            minAlignment = std::max(minAlignment, limits.minStorageBufferOffsetAlignment);
+        }
+        if (usage & (VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT)) {
+            minAlignment = std::max(minAlignment, limits.minTexelBufferOffsetAlignment);
+        }
+        pBufferSuballocator->mspBlock = std::move(spBlock);
+        pBufferSuballocator->mMinAlignment = minAlignment;
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+BufferSuballocator::~BufferSuballocator()
+{
+    reset();
+}
+
+void BufferSuballocator::reset()
+{
+    mspBlock.reset();
+    mMinAlignment = 1;
+}
+
+const Buffer& BufferSuballocator::get_buffer() const
+{
+    static const Buffer sNullBuffer;
+    return mspBlock ? mspBlock->buffer : sNullBuffer;
+}
+
+VkDeviceSize BufferSuballocator::get_min_alignment() const
+{
+    return mMinAlignment;
+}
+
+VmaStatistics BufferSuballocator::get_statistics() const
+{
+    assert(mspBlock);
+    VmaStatistics statistics { };
+    std::lock_guard<std::mutex> lock(mspBlock->mutex);
+    vmaGetVirtualBlockStatistics(mspBlock->vmaVirtualBlock, &statistics);
+    return statistics;
+}
+
+VkResult BufferSuballocator::allocate(VkDeviceSize size, VkDeviceSize alignment, BufferRange* pBufferRange)
+{
+    assert(mspBlock);
+    assert(size);
+    assert(!(alignment & (alignment - 1)));
+    assert(pBufferRange);
+    gvk_result_scope_begin(VK_ERROR_OUT_OF_DEVICE_MEMORY) {
+        pBufferRange->reset();
+        VmaVirtualAllocationCreateInfo virtualAllocationCreateInfo { };
+        virtualAllocationCreateInfo.size = size;
+        virtualAllocationCreateInfo.alignment = std::max(alignment, mMinAlignment);
+        VmaVirtualAllocation vmaVirtualAllocation = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        {
+            std::lock_guard<std::mutex> lock(mspBlock->mutex);
+            gvk_result(vmaVirtualAllocate(mspBlock->vmaVirtualBlock, &virtualAllocationCreateInfo, &vmaVirtualAllocation, &offset));
+        }
+        pBufferRange->mspBlock = mspBlock;
+        pBufferRange->mVmaVirtualAllocation = vmaVirtualAllocation;
+        pBufferRange->mOffset = offset;
+        pBufferRange->mSize = size;
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+BufferSuballocator::Block::~Block()
+{
+    if (vmaVirtualBlock) {
+        vmaDestroyVirtualBlock(vmaVirtualBlock);
+    }
+}
+
+BufferRange::BufferRange(BufferRange&& other)
+{
+    *this = std::move(other);
+}
+
+BufferRange& BufferRange::operator=(BufferRange&& other)
+{
+    if (this != &other) {
+        reset();
+        mspBlock = std::move(other.mspBlock);
+        mVmaVirtualAllocation = std::exchange(other.mVmaVirtualAllocation, VK_NULL_HANDLE);
+        mOffset = std::exchange(other.mOffset, 0);
+        mSize = std::exchange(other.mSize, 0);
+    }
+    return *this;
+}
+
+BufferRange::~BufferRange()
+{
+    reset();
+}
+
+BufferRange::operator bool() const
+{
+    return mspBlock && mVmaVirtualAllocation;
+}
+
+void BufferRange::reset()
+{
+    if (mspBlock && mVmaVirtualAllocation) {
+        std::lock_guard<std::mutex> lock(mspBlock->mutex);
+        vmaVirtualFree(mspBlock->vmaVirtualBlock, mVmaVirtualAllocation);
+    }
+    mspBlock.reset();
+    mVmaVirtualAllocation = VK_NULL_HANDLE;
+    mOffset = 0;
+    mSize = 0;
+}
+
+const Buffer& BufferRange::get_buffer() const
+{
+    static const Buffer sNullBuffer;
+    return mspBlock ? mspBlock->buffer : sNullBuffer;
+}
+
+VkDeviceSize BufferRange::get_offset() const
+{
+    return mOffset;
+}
+
+VkDeviceSize BufferRange::get_size() const
+{
+    return mSize;
+}
+
+uint8_t* BufferRange::get_mapped_data() const
+{
+    return mspBlock && mspBlock->pMappedData ? mspBlock->pMappedData + mOffset : nullptr;
+}
+
+VkDescriptorBufferInfo BufferRange::get_descriptor_buffer_info() const
+{
+    auto descriptorBufferInfo = get_default<VkDescriptorBufferInfo>();
+    descriptorBufferInfo.buffer = get_buffer();
+    descriptorBufferInfo.offset = mOffset;
+    descriptorBufferInfo.range = mSize;
+    return descriptorBufferInfo;
+}
+
+} // namespace gvk
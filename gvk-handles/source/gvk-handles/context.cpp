@@ -89,6 +89,7 @@ VkResult Context::create(const CreateInfo* pCreateInfo, const VkAllocationCallba
         }
         deviceCreateInfo.enabledExtensionCount = (uint32_t)deviceExtensions.size();
         deviceCreateInfo.ppEnabledExtensionNames = !deviceExtensions.empty() ? deviceExtensions.data() : nullptr;
+        pContext->mVmaAllocatorCreateFlags = pCreateInfo->vmaAllocatorCreateFlags;
         gvk_result(pContext->create_devices(&deviceCreateInfo, pAllocator));
 
         // Allocate gvk::CommandBuffers
@@ -188,7 +189,7 @@ VkResult Context::create_devices(const VkDeviceCreateInfo* pDeviceCreateInfo, co
 {
     assert(pDeviceCreateInfo);
     mDevices.resize(1);
-    return Device::create(mPhysicalDevices[0], pDeviceCreateInfo, pAllocator, mDevices.data());
+    return Device::create(mPhysicalDevices[0], pDeviceCreateInfo, mVmaAllocatorCreateFlags, pAllocator, mDevices.data());
 }
 
 VkResult Context::allocate_command_buffers(const VkAllocationCallbacks* pAllocator)
@@ -68,6 +68,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #endif // GVK_COMPILER_MSVC
 
 #include <cassert>
+#include <cstring>
 
 namespace gvk {
 
@@ -82,6 +83,109 @@ const QueueFamily& get_queue_family(const Device& device, uint32_t queueFamilyIn
     return sEmptyQueueFamily;
 }
 
+static bool is_device_extension_enabled(const VkDeviceCreateInfo& deviceCreateInfo, const char* pExtensionName)
+{
+    for (uint32_t i = 0; i < deviceCreateInfo.enabledExtensionCount; ++i) {
+        if (!strcmp(deviceCreateInfo.ppEnabledExtensionNames[i], pExtensionName)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static VmaAllocatorCreateFlags get_vma_allocator_create_flags(const VkDeviceCreateInfo& deviceCreateInfo)
+{
+    VmaAllocatorCreateFlags vmaAllocatorCreateFlags = 0;
+    auto pNext = (const VkBaseInStructure*)deviceCreateInfo.pNext;
+    while (pNext) {
+        switch (pNext->sType) {
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES: {
+            if (((const VkPhysicalDeviceVulkan12Features*)pNext)->bufferDeviceAddress) {
+                vmaAllocatorCreateFlags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+            }
+        } break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES: {
+            if (((const VkPhysicalDeviceBufferDeviceAddressFeatures*)pNext)->bufferDeviceAddress) {
+                vmaAllocatorCreateFlags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+            }
+        } break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT: {
+            if (((const VkPhysicalDeviceMemoryPriorityFeaturesEXT*)pNext)->memoryPriority && is_device_extension_enabled(deviceCreateInfo, VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME)) {
+                vmaAllocatorCreateFlags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_PRIORITY_BIT;
+            }
+        } break;
+        default: {
+        } break;
+        }
+        pNext = pNext->pNext;
+    }
+    if (is_device_extension_enabled(deviceCreateInfo, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) {
+        vmaAllocatorCreateFlags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
+    return vmaAllocatorCreateFlags;
+}
+
+static VkResult create_vma_allocator(const Instance& instance, const PhysicalDevice& physicalDevice, VkDevice vkDevice, const DispatchTable& dispatchTable, VmaAllocatorCreateFlags vmaAllocatorCreateFlags, VmaAllocator* pVmaAllocator)
+{
+    assert(pVmaAllocator);
+    assert(!*pVmaAllocator);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        const auto& physicalDeviceDispatchTable = physicalDevice.get<DispatchTable>();
+        VmaVulkanFunctions vulkanFunctions { };
+        vulkanFunctions.vkGetInstanceProcAddr = instance.get<DispatchTable>().gvkGetInstanceProcAddr;
+        vulkanFunctions.vkGetDeviceProcAddr = dispatchTable.gvkGetDeviceProcAddr;
+        vulkanFunctions.vkGetPhysicalDeviceProperties = physicalDeviceDispatchTable.gvkGetPhysicalDeviceProperties;
+        vulkanFunctions.vkGetPhysicalDeviceMemoryProperties = physicalDeviceDispatchTable.gvkGetPhysicalDeviceMemoryProperties;
+        vulkanFunctions.vkAllocateMemory = dispatchTable.gvkAllocateMemory;
+        vulkanFunctions.vkFreeMemory = dispatchTable.gvkFreeMemory;
+        vulkanFunctions.vkMapMemory = dispatchTable.gvkMapMemory;
+        vulkanFunctions.vkUnmapMemory = dispatchTable.gvkUnmapMemory;
+        vulkanFunctions.vkFlushMappedMemoryRanges = dispatchTable.gvkFlushMappedMemoryRanges;
+        vulkanFunctions.vkInvalidateMappedMemoryRanges = dispatchTable.gvkInvalidateMappedMemoryRanges;
+        vulkanFunctions.vkBindBufferMemory = dispatchTable.gvkBindBufferMemory;
+        vulkanFunctions.vkBindImageMemory = dispatchTable.gvkBindImageMemory;
+        vulkanFunctions.vkGetBufferMemoryRequirements = dispatchTable.gvkGetBufferMemoryRequirements;
+        vulkanFunctions.vkGetImageMemoryRequirements = dispatchTable.gvkGetImageMemoryRequirements;
+        vulkanFunctions.vkCreateBuffer = dispatchTable.gvkCreateBuffer;
+        vulkanFunctions.vkDestroyBuffer = dispatchTable.gvkDestroyBuffer;
+        vulkanFunctions.vkCreateImage = dispatchTable.gvkCreateImage;
+        vulkanFunctions.vkDestroyImage = dispatchTable.gvkDestroyImage;
+        vulkanFunctions.vkCmdCopyBuffer = dispatchTable.gvkCmdCopyBuffer;
+#if VMA_DEDICATED_ALLOCATION || VMA_VULKAN_VERSION >= 1001000
+        /// Fetch "vkGetBufferMemoryRequirements2" on Vulkan >= 1.1, fetch "vkGetBufferMemoryRequirements2KHR" when using VK_KHR_dedicated_allocation extension.
+        vulkanFunctions.vkGetBufferMemoryRequirements2KHR = dispatchTable.gvkGetBufferMemoryRequirements2;
+        /// Fetch "vkGetImageMemoryRequirements2" on Vulkan >= 1.1, fetch "vkGetImageMemoryRequirements2KHR" when using VK_KHR_dedicated_allocation extension.
+        vulkanFunctions.vkGetImageMemoryRequirements2KHR = dispatchTable.gvkGetImageMemoryRequirements2;
+#endif
+#if VMA_BIND_MEMORY2 || VMA_VULKAN_VERSION >= 1001000
+        /// Fetch "vkBindBufferMemory2" on Vulkan >= 1.1, fetch "vkBindBufferMemory2KHR" when using VK_KHR_bind_memory2 extension.
+        vulkanFunctions.vkBindBufferMemory2KHR = dispatchTable.gvkBindBufferMemory2;
+        /// Fetch "vkBindImageMemory2" on Vulkan >= 1.1, fetch "vkBindImageMemory2KHR" when using VK_KHR_bind_memory2 extension.
+        vulkanFunctions.vkBindImageMemory2KHR = dispatchTable.gvkBindImageMemory2;
+#endif
+#if VMA_MEMORY_BUDGET || VMA_VULKAN_VERSION >= 1001000
+        vulkanFunctions.vkGetPhysicalDeviceMemoryProperties2KHR = physicalDeviceDispatchTable.gvkGetPhysicalDeviceMemoryProperties2;
+#endif
+#if VMA_VULKAN_VERSION >= 1003000
+        /// Fetch from "vkGetDeviceBufferMemoryRequirements" on Vulkan >= 1.3, but you can also fetch it from "vkGetDeviceBufferMemoryRequirementsKHR" if you enabled extension VK_KHR_maintenance4.
+        vulkanFunctions.vkGetDeviceBufferMemoryRequirements = dispatchTable.gvkGetDeviceBufferMemoryRequirements;
+        /// Fetch from "vkGetDeviceImageMemoryRequirements" on Vulkan >= 1.3, but you can also fetch it from "vkGetDeviceImageMemoryRequirementsKHR" if you enabled extension VK_KHR_maintenance4.
+        vulkanFunctions.vkGetDeviceImageMemoryRequirements = dispatchTable.gvkGetDeviceImageMemoryRequirements;
+#endif
+
+        const auto& instanceCreateInfo = instance.get<VkInstanceCreateInfo>();
+        VmaAllocatorCreateInfo allocatorCreateInfo { };
+        allocatorCreateInfo.vulkanApiVersion = instanceCreateInfo.pApplicationInfo ? instanceCreateInfo.pApplicationInfo->apiVersion : VK_API_VERSION_1_3;
+        allocatorCreateInfo.instance = instance;
+        allocatorCreateInfo.physicalDevice = physicalDevice;
+        allocatorCreateInfo.device = vkDevice;
+        allocatorCreateInfo.pVulkanFunctions = &vulkanFunctions;
+        allocatorCreateInfo.flags = vmaAllocatorCreateFlags;
+        gvk_result(vmaCreateAllocator(&allocatorCreateInfo, pVmaAllocator));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
 VkResult Instance::create_unmanaged(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, const DispatchTable* pDispatchTable, VkInstance vkInstance, Instance* pGvkInstance)
 {
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
@@ -106,6 +210,31 @@ VkResult Instance::create_unmanaged(const VkInstanceCreateInfo* pCreateInfo, con
     return gvkResult;
 }
 
+VkResult Device::create(const PhysicalDevice& physicalDevice, const VkDeviceCreateInfo* pCreateInfo, VmaAllocatorCreateFlags vmaAllocatorCreateFlags, const VkAllocationCallbacks* pAllocator, Device* pDevice)
+{
+    // NOTE : This mirrors the generated Device::create(), the requested
+    //  VmaAllocatorCreateFlags are stored before the control block is initialized
+    //  so the VmaAllocator is only created once.
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        assert(pCreateInfo);
+        assert(pDevice);
+        DispatchTable dispatchTable { };
+        dispatchTable = physicalDevice.get<DispatchTable>();
+        assert(dispatchTable.gvkCreateDevice);
+        VkDevice vkDevice = VK_NULL_HANDLE;
+        gvk_result(dispatchTable.gvkCreateDevice(physicalDevice, pCreateInfo, pAllocator, &vkDevice));
+        pDevice->mReference.reset(gvk::newref, vkDevice);
+        auto& controlBlock = pDevice->mReference.get_obj();
+        controlBlock.mVkDevice = vkDevice;
+        controlBlock.mPhysicalDevice = physicalDevice;
+        controlBlock.mAllocationCallbacks = pAllocator ? *pAllocator : VkAllocationCallbacks { };
+        controlBlock.mDeviceCreateInfo = *pCreateInfo;
+        controlBlock.mVmaAllocatorCreateFlags = vmaAllocatorCreateFlags;
+        gvk_result(gvk::detail::initialize_control_block(*pDevice));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
 VkResult Device::create_unmanaged(const PhysicalDevice& physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, const DispatchTable* pDispatchTable, VkDevice vkDevice, Device* pGvkDevice)
 {
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
@@ -262,56 +391,8 @@ VkResult initialize_control_block<Device>(Device& device)
             deviceControlBlock.mQueueFamilies.push_back(queueFamily);
         }
 
-        VmaVulkanFunctions vulkanFunctions { };
-        vulkanFunctions.vkGetInstanceProcAddr = deviceControlBlock.mInstance.get<DispatchTable>().gvkGetInstanceProcAddr;
-        vulkanFunctions.vkGetDeviceProcAddr = deviceControlBlock.mDispatchTable.gvkGetDeviceProcAddr;
-        vulkanFunctions.vkGetPhysicalDeviceProperties = physicalDeviceDispatchTable.gvkGetPhysicalDeviceProperties;
-        vulkanFunctions.vkGetPhysicalDeviceMemoryProperties = physicalDeviceDispatchTable.gvkGetPhysicalDeviceMemoryProperties;
-        vulkanFunctions.vkAllocateMemory = deviceControlBlock.mDispatchTable.gvkAllocateMemory;
-        vulkanFunctions.vkFreeMemory = deviceControlBlock.mDispatchTable.gvkFreeMemory;
-        vulkanFunctions.vkMapMemory = deviceControlBlock.mDispatchTable.gvkMapMemory;
-        vulkanFunctions.vkUnmapMemory = deviceControlBlock.mDispatchTable.gvkUnmapMemory;
-        vulkanFunctions.vkFlushMappedMemoryRanges = deviceControlBlock.mDispatchTable.gvkFlushMappedMemoryRanges;
-        vulkanFunctions.vkInvalidateMappedMemoryRanges = deviceControlBlock.mDispatchTable.gvkInvalidateMappedMemoryRanges;
-        vulkanFunctions.vkBindBufferMemory = deviceControlBlock.mDispatchTable.gvkBindBufferMemory;
-        vulkanFunctions.vkBindImageMemory = deviceControlBlock.mDispatchTable.gvkBindImageMemory;
-        vulkanFunctions.vkGetBufferMemoryRequirements = deviceControlBlock.mDispatchTable.gvkGetBufferMemoryRequirements;
-        vulkanFunctions.vkGetImageMemoryRequirements = deviceControlBlock.mDispatchTable.gvkGetImageMemoryRequirements;
-        vulkanFunctions.vkCreateBuffer = deviceControlBlock.mDispatchTable.gvkCreateBuffer;
-        vulkanFunctions.vkDestroyBuffer = deviceControlBlock.mDispatchTable.gvkDestroyBuffer;
-        vulkanFunctions.vkCreateImage = deviceControlBlock.mDispatchTable.gvkCreateImage;
-        vulkanFunctions.vkDestroyImage = deviceControlBlock.mDispatchTable.gvkDestroyImage;
-        vulkanFunctions.vkCmdCopyBuffer = deviceControlBlock.mDispatchTable.gvkCmdCopyBuffer;
-#if VMA_DEDICATED_ALLOCATION || VMA_VULKAN_VERSION >= 1001000
-        /// Fetch "vkGetBufferMemoryRequirements2" on Vulkan >= 1.1, fetch "vkGetBufferMemoryRequirements2KHR" when using VK_KHR_dedicated_allocation extension.
-        vulkanFunctions.vkGetBufferMemoryRequirements2KHR = deviceControlBlock.mDispatchTable.gvkGetBufferMemoryRequirements2;
-        /// Fetch "vkGetImageMemoryRequirements2" on Vulkan >= 1.1, fetch "vkGetImageMemoryRequirements2KHR" when using VK_KHR_dedicated_allocation extension.
-        vulkanFunctions.vkGetImageMemoryRequirements2KHR = deviceControlBlock.mDispatchTable.gvkGetImageMemoryRequirements2;
-#endif
-#if VMA_BIND_MEMORY2 || VMA_VULKAN_VERSION >= 1001000
-        /// Fetch "vkBindBufferMemory2" on Vulkan >= 1.1, fetch "vkBindBufferMemory2KHR" when using VK_KHR_bind_memory2 extension.
-        vulkanFunctions.vkBindBufferMemory2KHR = deviceControlBlock.mDispatchTable.gvkBindBufferMemory2;
-        /// Fetch "vkBindImageMemory2" on Vulkan >= 1.1, fetch "vkBindImageMemory2KHR" when using VK_KHR_bind_memory2 extension.
-        vulkanFunctions.vkBindImageMemory2KHR = deviceControlBlock.mDispatchTable.gvkBindImageMemory2;
-#endif
-#if VMA_MEMORY_BUDGET || VMA_VULKAN_VERSION >= 1001000
-        vulkanFunctions.vkGetPhysicalDeviceMemoryProperties2KHR = physicalDeviceDispatchTable.gvkGetPhysicalDeviceMemoryProperties2;
-#endif
-#if VMA_VULKAN_VERSION >= 1003000
-        /// Fetch from "vkGetDeviceBufferMemoryRequirements" on Vulkan >= 1.3, but you can also fetch it from "vkGetDeviceBufferMemoryRequirementsKHR" if you enabled extension VK_KHR_maintenance4.
-        vulkanFunctions.vkGetDeviceBufferMemoryRequirements = deviceControlBlock.mDispatchTable.gvkGetDeviceBufferMemoryRequirements;
-        /// Fetch from "vkGetDeviceImageMemoryRequirements" on Vulkan >= 1.3, but you can also fetch it from "vkGetDeviceImageMemoryRequirementsKHR" if you enabled extension VK_KHR_maintenance4.
-        vulkanFunctions.vkGetDeviceImageMemoryRequirements = deviceControlBlock.mDispatchTable.gvkGetDeviceImageMemoryRequirements;
-#endif
-
-        const auto& instanceCreateInfo = deviceControlBlock.mInstance.get<VkInstanceCreateInfo>();
-        VmaAllocatorCreateInfo allocatorCreateInfo { };
-        allocatorCreateInfo.vulkanApiVersion = instanceCreateInfo.pApplicationInfo ? instanceCreateInfo.pApplicationInfo->apiVersion : VK_API_VERSION_1_3;
-        allocatorCreateInfo.instance = deviceControlBlock.mInstance;
-        allocatorCreateInfo.physicalDevice = deviceControlBlock.mPhysicalDevice;
-        allocatorCreateInfo.device = deviceControlBlock.mVkDevice;
-        allocatorCreateInfo.pVulkanFunctions = &vulkanFunctions;
-        gvk_result(vmaCreateAllocator(&allocatorCreateInfo, &deviceControlBlock.mVmaAllocator));
+        deviceControlBlock.mVmaAllocatorCreateFlags |= get_vma_allocator_create_flags(deviceCreateInfo);
+        gvk_result(create_vma_allocator(deviceControlBlock.mInstance, deviceControlBlock.mPhysicalDevice, deviceControlBlock.mVkDevice, deviceControlBlock.mDispatchTable, deviceControlBlock.mVmaAllocatorCreateFlags, &deviceControlBlock.mVmaAllocator));
     } gvk_result_scope_end;
     return gvkResult;
 }
@@ -0,0 +1,217 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/immediate-executor.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace gvk {
+
+VkResult ImmediateExecutor::Ticket::wait(uint64_t timeout) const
+{
+    if (mspJob) {
+        const auto& device = mspJob->fence.get<Device>();
+        const auto& dispatchTable = device.get<DispatchTable>();
+        assert(dispatchTable.gvkWaitForFences);
+        return dispatchTable.gvkWaitForFences(device, 1, &mspJob->fence.get<VkFence>(), VK_TRUE, timeout);
+    }
+    return VK_SUCCESS;
+}
+
+VkBool32 ImmediateExecutor::Ticket::is_complete() const
+{
+    if (mspJob) {
+        const auto& device = mspJob->fence.get<Device>();
+        const auto& dispatchTable = device.get<DispatchTable>();
+        assert(dispatchTable.gvkGetFenceStatus);
+        return dispatchTable.gvkGetFenceStatus(device, mspJob->fence) == VK_SUCCESS;
+    }
+    return VK_TRUE;
+}
+
+void ImmediateExecutor::Ticket::reset()
+{
+    mspJob.reset();
+}
+
+VkResult ImmediateExecutor::create(const Device& device, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, ImmediateExecutor* pImmediateExecutor)
+{
+    assert(device);
+    assert(pCreateInfo);
+    assert(pImmediateExecutor);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        pImmediateExecutor->reset();
+        pImmediateExecutor->mDevice = device;
+        pImmediateExecutor->mAllocator = pAllocator ? *pAllocator : get_default<VkAllocationCallbacks>();
+        const auto& queues = get_queue_family(device, pCreateInfo->queueFamilyIndex).queues;
+        auto queueItr = std::find_if(queues.begin(), queues.end(), [&](const Queue& queue) { return !pCreateInfo->queue || queue.get<VkQueue>() == pCreateInfo->queue; });
+        gvk_result(queueItr != queues.end() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        pImmediateExecutor->mQueue = *queueItr;
+        pImmediateExecutor->mpQueueMutex = pCreateInfo->pQueueMutex;
+        auto commandPoolCreateInfo = get_default<VkCommandPoolCreateInfo>();
+        commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        commandPoolCreateInfo.queueFamilyIndex = pCreateInfo->queueFamilyIndex;
+        gvk_result(CommandPool::create(device, &commandPoolCreateInfo, pAllocator, &pImmediateExecutor->mCommandPool));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+ImmediateExecutor::~ImmediateExecutor()
+{
+    reset();
+}
+
+void ImmediateExecutor::reset()
+{
+    if (mDevice) {
+        wait_idle();
+    }
+    mspRecordingJob.reset();
+    mSubmittedJobs.clear();
+    mAvailableJobs.clear();
+    mCommandPool.reset();
+    mQueue.reset();
+    mpQueueMutex = nullptr;
+    mDevice.reset();
+}
+
+const Device& ImmediateExecutor::get_device() const
+{
+    return mDevice;
+}
+
+VkResult ImmediateExecutor::submit(Ticket* pTicket)
+{
+    assert(mDevice);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        if (pTicket) {
+            pTicket->reset();
+        }
+        if (mspRecordingJob) {
+            auto spJob = std::move(mspRecordingJob);
+            const auto& dispatchTable = mDevice.get<DispatchTable>();
+            assert(dispatchTable.gvkEndCommandBuffer);
+            gvk_result(dispatchTable.gvkEndCommandBuffer(spJob->commandBuffer));
+            auto submitInfo = get_default<VkSubmitInfo>();
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers = &spJob->commandBuffer.get<VkCommandBuffer>();
+            assert(dispatchTable.gvkQueueSubmit);
+            std::unique_lock<std::mutex> queueLock;
+            if (mpQueueMutex) {
+                queueLock = std::unique_lock<std::mutex>(*mpQueueMutex);
+            }
+            gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, spJob->fence));
+            if (pTicket) {
+                pTicket->mspJob = spJob;
+            }
+            mSubmittedJobs.push_back(std::move(spJob));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult ImmediateExecutor::wait_idle()
+{
+    assert(mDevice);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        gvk_result(submit());
+        std::vector<VkFence> vkFences;
+        vkFences.reserve(mSubmittedJobs.size());
+        for (const auto& spJob : mSubmittedJobs) {
+            vkFences.push_back(spJob->fence);
+        }
+        if (!vkFences.empty()) {
+            const auto& dispatchTable = mDevice.get<DispatchTable>();
+            assert(dispatchTable.gvkWaitForFences);
+            gvk_result(dispatchTable.gvkWaitForFences(mDevice, (uint32_t)vkFences.size(), vkFences.data(), VK_TRUE, UINT64_MAX));
+        }
+        gvk_result(recycle_jobs());
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult ImmediateExecutor::begin_recording(VkCommandBuffer* pVkCommandBuffer)
+{
+    assert(mDevice);
+    assert(pVkCommandBuffer);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        if (!mspRecordingJob) {
+            gvk_result(recycle_jobs());
+            std::shared_ptr<Job> spJob;
+            if (!mAvailableJobs.empty()) {
+                spJob = std::move(mAvailableJobs.back());
+                mAvailableJobs.pop_back();
+            } else {
+                spJob = std::make_shared<Job>();
+                auto commandBufferAllocateInfo = get_default<VkCommandBufferAllocateInfo>();
+                commandBufferAllocateInfo.commandPool = mCommandPool;
+                commandBufferAllocateInfo.commandBufferCount = 1;
+                gvk_result(CommandBuffer::allocate(mDevice, &commandBufferAllocateInfo, &spJob->commandBuffer));
+                gvk_result(Fence::create(mDevice, &get_default<VkFenceCreateInfo>(), validate_allocator(mAllocator), &spJob->fence));
+            }
+            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
+            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            const auto& dispatchTable = mDevice.get<DispatchTable>();
+            assert(dispatchTable.gvkBeginCommandBuffer);
+            gvk_result(dispatchTable.gvkBeginCommandBuffer(spJob->commandBuffer, &commandBufferBeginInfo));
+            mspRecordingJob = std::move(spJob);
+        }
+        *pVkCommandBuffer = mspRecordingJob->commandBuffer;
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult ImmediateExecutor::recycle_jobs()
+{
+    // NOTE : A submitted Job is recycled once its Fence is signaled and there are
+    //  no outstanding Tickets referring to it, so a Ticket never observes a Fence
+    //  that's been reset for a later submission.
+    gvk_result_scope_begin(VK_SUCCESS) {
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        assert(dispatchTable.gvkGetFenceStatus);
+        assert(dispatchTable.gvkResetFences);
+        for (size_t i = 0; i < mSubmittedJobs.size();) {
+            auto& spJob = mSubmittedJobs[i];
+            if (spJob.use_count() == 1) {
+                auto vkResult = dispatchTable.gvkGetFenceStatus(mDevice, spJob->fence);
+                if (vkResult == VK_SUCCESS) {
+                    gvk_result(dispatchTable.gvkResetFences(mDevice, 1, &spJob->fence.get<VkFence>()));
+                    mAvailableJobs.push_back(std::move(spJob));
+                    spJob = std::move(mSubmittedJobs.back());
+                    mSubmittedJobs.pop_back();
+                    continue;
+                }
+                gvk_result(vkResult == VK_NOT_READY ? VK_SUCCESS : vkResult);
+            }
+            ++i;
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+} // namespace gvk
@@ -49,6 +49,19 @@ void Mesh::record_cmds(const gvk::CommandBuffer& commandBuffer) const
     dispatchTable.gvkCmdDrawIndexed(commandBuffer, (uint32_t)mIndexCount, 1, 0, 0, 0);
 }
 
+VkResult Mesh::create_gpu_buffer(const Device& device, VkDeviceSize vertexDataSize, VkDeviceSize indexDataSize, VkIndexType indexType, uint32_t indexCount)
+{
+    mIndexDataOffset = vertexDataSize;
+    mIndexType = indexType;
+    mIndexCount = indexCount;
+    auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
+    bufferCreateInfo.size = vertexDataSize + indexDataSize;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    VmaAllocationCreateInfo allocationCreateInfo{ };
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    return Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &mGpuBuffer);
+}
+
 VkResult resize(VkDeviceSize size, gvk::Buffer* pBuffer)
 {
     assert(pBuffer);
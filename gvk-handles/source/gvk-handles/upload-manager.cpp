@@ -0,0 +1,488 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/upload-manager.hpp"
+#include "gvk-dispatch-table.hpp"
+#include "gvk-format-info.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace gvk {
+
+static VkBool32 is_timeline_semaphore_enabled(const VkDeviceCreateInfo& deviceCreateInfo)
+{
+    auto pNext = (const VkBaseInStructure*)deviceCreateInfo.pNext;
+    while (pNext) {
+        switch (pNext->sType) {
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES: {
+            if (((const VkPhysicalDeviceVulkan12Features*)pNext)->timelineSemaphore) {
+                return VK_TRUE;
+            }
+        } break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES: {
+            if (((const VkPhysicalDeviceTimelineSemaphoreFeatures*)pNext)->timelineSemaphore) {
+                return VK_TRUE;
+            }
+        } break;
+        default: {
+        } break;
+        }
+        pNext = pNext->pNext;
+    }
+    return VK_FALSE;
+}
+
+static VkImageAspectFlags get_barrier_aspect_flags(VkFormat format, VkImageAspectFlags aspectFlags)
+{
+    if (aspectFlags & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
+        return get_image_aspect_flags(format);
+    }
+    if (aspectFlags & (VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT)) {
+        return VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+    return aspectFlags;
+}
+
+VkResult UploadManager::create(const Device& device, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, UploadManager* pUploadManager)
+{
+    assert(device);
+    assert(pCreateInfo);
+    assert(pCreateInfo->ringBufferSize);
+    assert(pUploadManager);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        pUploadManager->reset();
+        pUploadManager->mDevice = device;
+        pUploadManager->mAllocator = pAllocator ? *pAllocator : get_default<VkAllocationCallbacks>();
+        pUploadManager->mQueue = get_queue_family(device, pCreateInfo->queueFamilyIndex).queues[0];
+        pUploadManager->mBatchSize = pCreateInfo->batchSize ? pCreateInfo->batchSize : std::max(pCreateInfo->ringBufferSize / 4, (VkDeviceSize)1);
+        const auto& physicalDevice = device.get<PhysicalDevice>();
+        auto physicalDeviceProperties = get_default<VkPhysicalDeviceProperties>();
+        physicalDevice.get<DispatchTable>().gvkGetPhysicalDeviceProperties(physicalDevice, &physicalDeviceProperties);
+        pUploadManager->mOptimalBufferCopyOffsetAlignment = std::max(physicalDeviceProperties.limits.optimalBufferCopyOffsetAlignment, (VkDeviceSize)1);
+
+        // Create gvk::CommandPool
+        auto commandPoolCreateInfo = get_default<VkCommandPoolCreateInfo>();
+        commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        commandPoolCreateInfo.queueFamilyIndex = pCreateInfo->queueFamilyIndex;
+        gvk_result(CommandPool::create(device, &commandPoolCreateInfo, pAllocator, &pUploadManager->mCommandPool));
+
+        // Create timeline gvk::Semaphore
+        if (is_timeline_semaphore_enabled(device.get<VkDeviceCreateInfo>())) {
+            auto semaphoreTypeCreateInfo = get_default<VkSemaphoreTypeCreateInfo>();
+            semaphoreTypeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+            auto semaphoreCreateInfo = get_default<VkSemaphoreCreateInfo>();
+            semaphoreCreateInfo.pNext = &semaphoreTypeCreateInfo;
+            gvk_result(Semaphore::create(device, &semaphoreCreateInfo, pAllocator, &pUploadManager->mTimelineSemaphore));
+        }
+
+        // Create persistently mapped ring gvk::Buffer
+        auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
+        bufferCreateInfo.size = pCreateInfo->ringBufferSize;
+        bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        auto allocationCreateInfo = get_default<VmaAllocationCreateInfo>();
+        allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        gvk_result(Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &pUploadManager->mRingBuffer));
+        VmaAllocationInfo allocationInfo { };
+        vmaGetAllocationInfo(device.get<VmaAllocator>(), pUploadManager->mRingBuffer.get<VmaAllocation>(), &allocationInfo);
+        pUploadManager->mpRingBufferData = (uint8_t*)allocationInfo.pMappedData;
+        gvk_result(pUploadManager->mpRingBufferData ? VK_SUCCESS : VK_ERROR_MEMORY_MAP_FAILED);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+UploadManager::~UploadManager()
+{
+    reset();
+}
+
+void UploadManager::reset()
+{
+    if (mDevice) {
+        flush();
+    }
+    mBatches.clear();
+    mAvailableBatches.clear();
+    mRingBuffer.reset();
+    mpRingBufferData = nullptr;
+    mRingBufferHead = 0;
+    mRingBufferUsed = 0;
+    mTimelineSemaphore.reset();
+    mCommandPool.reset();
+    mQueue.reset();
+    mDevice.reset();
+    mNextTicket = 1;
+}
+
+const Device& UploadManager::get_device() const
+{
+    return mDevice;
+}
+
+const Semaphore& UploadManager::get_timeline_semaphore() const
+{
+    return mTimelineSemaphore;
+}
+
+VkResult UploadManager::upload(const Buffer& buffer, VkDeviceSize offset, VkDeviceSize size, const void* pData, Ticket* pTicket)
+{
+    assert(mDevice);
+    assert(buffer);
+    assert(!size || pData);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        Batch* pBatch = nullptr;
+        Buffer stagingBuffer;
+        VkDeviceSize stagingOffset = 0;
+        uint8_t* pStagingData = nullptr;
+        gvk_result(allocate(size, mOptimalBufferCopyOffsetAlignment, &pBatch, &stagingBuffer, &stagingOffset, &pStagingData));
+        if (size) {
+            memcpy(pStagingData, pData, (size_t)size);
+            gvk_result(vmaFlushAllocation(mDevice.get<VmaAllocator>(), stagingBuffer.get<VmaAllocation>(), stagingOffset, size));
+            auto bufferCopy = get_default<VkBufferCopy>();
+            bufferCopy.srcOffset = stagingOffset;
+            bufferCopy.dstOffset = offset;
+            bufferCopy.size = size;
+            const auto& dispatchTable = mDevice.get<DispatchTable>();
+            assert(dispatchTable.gvkCmdCopyBuffer);
+            dispatchTable.gvkCmdCopyBuffer(pBatch->commandBuffer, stagingBuffer, buffer, 1, &bufferCopy);
+        }
+        if (pTicket) {
+            *pTicket = pBatch->ticket;
+        }
+        pBatch->stagedSize += size;
+        if (mBatchSize <= pBatch->stagedSize) {
+            gvk_result(submit_batch(*pBatch));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::upload(const Image& image, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions, VkDeviceSize size, const void* pData, Ticket* pTicket)
+{
+    assert(mDevice);
+    assert(image);
+    assert(!regionCount || pRegions);
+    assert(!size || pData);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : VkBufferImageCopy::bufferOffset must be a multiple of the texel
+        //  block size and, for depth/stencil formats, a multiple of 4.
+        const auto& imageCreateInfo = image.get<VkImageCreateInfo>();
+        GvkFormatInfo formatInfo { };
+        get_format_info(imageCreateInfo.format, &formatInfo);
+        auto alignment = std::lcm(std::lcm(std::max((VkDeviceSize)formatInfo.blockSize, (VkDeviceSize)1), (VkDeviceSize)4), mOptimalBufferCopyOffsetAlignment);
+
+        Batch* pBatch = nullptr;
+        Buffer stagingBuffer;
+        VkDeviceSize stagingOffset = 0;
+        uint8_t* pStagingData = nullptr;
+        gvk_result(allocate(size, alignment, &pBatch, &stagingBuffer, &stagingOffset, &pStagingData));
+        if (size) {
+            memcpy(pStagingData, pData, (size_t)size);
+            gvk_result(vmaFlushAllocation(mDevice.get<VmaAllocator>(), stagingBuffer.get<VmaAllocation>(), stagingOffset, size));
+        }
+
+        // Setup VkImageMemoryBarriers for each unique subresource range and
+        //  offset VkBufferImageCopy regions into the staging gvk::Buffer
+        std::vector<VkImageMemoryBarrier> imageMemoryBarriers;
+        std::vector<VkBufferImageCopy> regions(pRegions, pRegions + regionCount);
+        for (auto& region : regions) {
+            region.bufferOffset += stagingOffset;
+            auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
+            imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            imageMemoryBarrier.oldLayout = oldLayout;
+            imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            imageMemoryBarrier.image = image;
+            imageMemoryBarrier.subresourceRange.aspectMask = get_barrier_aspect_flags(imageCreateInfo.format, region.imageSubresource.aspectMask);
+            imageMemoryBarrier.subresourceRange.baseMipLevel = region.imageSubresource.mipLevel;
+            imageMemoryBarrier.subresourceRange.levelCount = 1;
+            imageMemoryBarrier.subresourceRange.baseArrayLayer = region.imageSubresource.baseArrayLayer;
+            imageMemoryBarrier.subresourceRange.layerCount = region.imageSubresource.layerCount;
+            auto itr = std::find_if(imageMemoryBarriers.begin(), imageMemoryBarriers.end(),
+                [&](const VkImageMemoryBarrier& other)
+                {
+                    return !memcmp(&other.subresourceRange, &imageMemoryBarrier.subresourceRange, sizeof(VkImageSubresourceRange));
+                }
+            );
+            if (itr == imageMemoryBarriers.end()) {
+                imageMemoryBarriers.push_back(imageMemoryBarrier);
+            }
+        }
+
+        // Record copy and layout transitions
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        assert(dispatchTable.gvkCmdPipelineBarrier);
+        assert(dispatchTable.gvkCmdCopyBufferToImage);
+        const auto& commandBuffer = pBatch->commandBuffer;
+        if (!imageMemoryBarriers.empty()) {
+            dispatchTable.gvkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, (uint32_t)imageMemoryBarriers.size(), imageMemoryBarriers.data());
+            dispatchTable.gvkCmdCopyBufferToImage(commandBuffer, stagingBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)regions.size(), regions.data());
+            for (auto& imageMemoryBarrier : imageMemoryBarriers) {
+                imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                imageMemoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+                imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                imageMemoryBarrier.newLayout = newLayout;
+            }
+            dispatchTable.gvkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, (uint32_t)imageMemoryBarriers.size(), imageMemoryBarriers.data());
+        }
+        if (pTicket) {
+            *pTicket = pBatch->ticket;
+        }
+        pBatch->stagedSize += size;
+        if (mBatchSize <= pBatch->stagedSize) {
+            gvk_result(submit_batch(*pBatch));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::submit(Ticket* pTicket)
+{
+    assert(mDevice);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        if (!mBatches.empty() && mBatches.back().recording) {
+            gvk_result(submit_batch(mBatches.back()));
+        }
+        if (pTicket) {
+            *pTicket = mNextTicket - 1;
+        }
+        gvk_result(retire_batches(false));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::flush()
+{
+    assert(mDevice);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        gvk_result(submit());
+        gvk_result(retire_batches(true));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::wait(Ticket ticket, uint64_t timeout)
+{
+    assert(mDevice);
+    assert(ticket < mNextTicket);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        auto itr = std::find_if(mBatches.begin(), mBatches.end(), [&](const Batch& batch) { return batch.ticket == ticket; });
+        if (itr != mBatches.end()) {
+            if (itr->recording) {
+                gvk_result(submit_batch(*itr));
+            }
+            gvk_result(wait_batch(*itr, timeout));
+            gvk_result(retire_batches(false));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkBool32 UploadManager::is_complete(Ticket ticket)
+{
+    assert(mDevice);
+    retire_batches(false);
+    return ticket < mNextTicket && (mBatches.empty() || ticket < mBatches.front().ticket);
+}
+
+VkResult UploadManager::get_recording_batch(Batch** ppBatch)
+{
+    assert(mDevice);
+    assert(ppBatch);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        if (mBatches.empty() || !mBatches.back().recording) {
+            Batch batch;
+            if (!mAvailableBatches.empty()) {
+                batch = std::move(mAvailableBatches.back());
+                mAvailableBatches.pop_back();
+            } else {
+                auto commandBufferAllocateInfo = get_default<VkCommandBufferAllocateInfo>();
+                commandBufferAllocateInfo.commandPool = mCommandPool;
+                commandBufferAllocateInfo.commandBufferCount = 1;
+                gvk_result(CommandBuffer::allocate(mDevice, &commandBufferAllocateInfo, &batch.commandBuffer));
+                gvk_result(Fence::create(mDevice, &get_default<VkFenceCreateInfo>(), validate_allocator(mAllocator), &batch.fence));
+            }
+            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
+            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            const auto& dispatchTable = mDevice.get<DispatchTable>();
+            assert(dispatchTable.gvkBeginCommandBuffer);
+            gvk_result(dispatchTable.gvkBeginCommandBuffer(batch.commandBuffer, &commandBufferBeginInfo));
+            batch.ticket = mNextTicket++;
+            batch.recording = true;
+            mBatches.push_back(std::move(batch));
+        }
+        *ppBatch = &mBatches.back();
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::allocate(VkDeviceSize size, VkDeviceSize alignment, Batch** ppBatch, Buffer* pBuffer, VkDeviceSize* pOffset, uint8_t** ppData)
+{
+    assert(mRingBuffer);
+    assert(alignment);
+    assert(ppBatch);
+    assert(pBuffer);
+    assert(pOffset);
+    assert(ppData);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        const auto ringBufferSize = mRingBuffer.get<VkBufferCreateInfo>().size;
+        if (ringBufferSize < size) {
+            // NOTE : Uploads that can't fit in the ring gvk::Buffer are staged in a
+            //  dedicated gvk::Buffer that's released when its batch completes.
+            auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
+            bufferCreateInfo.size = size;
+            bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+            auto allocationCreateInfo = get_default<VmaAllocationCreateInfo>();
+            allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+            allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+            Buffer dedicatedBuffer;
+            gvk_result(Buffer::create(mDevice, &bufferCreateInfo, &allocationCreateInfo, &dedicatedBuffer));
+            VmaAllocationInfo allocationInfo { };
+            vmaGetAllocationInfo(mDevice.get<VmaAllocator>(), dedicatedBuffer.get<VmaAllocation>(), &allocationInfo);
+            gvk_result(allocationInfo.pMappedData ? VK_SUCCESS : VK_ERROR_MEMORY_MAP_FAILED);
+            gvk_result(get_recording_batch(ppBatch));
+            (*ppBatch)->dedicatedBuffers.push_back(dedicatedBuffer);
+            *pBuffer = dedicatedBuffer;
+            *pOffset = 0;
+            *ppData = (uint8_t*)allocationInfo.pMappedData;
+        } else {
+            while (true) {
+                if (!mRingBufferUsed) {
+                    mRingBufferHead = 0;
+                }
+                auto offset = (mRingBufferHead + alignment - 1) / alignment * alignment;
+                auto padding = offset - mRingBufferHead;
+                if (ringBufferSize < offset + size) {
+                    padding = ringBufferSize - mRingBufferHead;
+                    offset = 0;
+                }
+                if (mRingBufferUsed + padding + size <= ringBufferSize) {
+                    gvk_result(get_recording_batch(ppBatch));
+                    (*ppBatch)->ringBufferSize += padding + size;
+                    mRingBufferUsed += padding + size;
+                    mRingBufferHead = offset + size;
+                    *pBuffer = mRingBuffer;
+                    *pOffset = offset;
+                    *ppData = mpRingBufferData + offset;
+                    break;
+                }
+
+                // NOTE : The ring gvk::Buffer is full, submit the recording batch if
+                //  it's the only batch holding ring gvk::Buffer space, then wait for
+                //  the oldest batch to complete and release its space.
+                assert(!mBatches.empty());
+                if (mBatches.front().recording) {
+                    gvk_result(submit_batch(mBatches.front()));
+                }
+                gvk_result(wait_batch(mBatches.front(), UINT64_MAX));
+                gvk_result(retire_batches(false));
+            }
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::retire_batches(bool wait)
+{
+    gvk_result_scope_begin(VK_SUCCESS) {
+        while (!mBatches.empty() && !mBatches.front().recording) {
+            auto& batch = mBatches.front();
+            if (wait) {
+                gvk_result(wait_batch(batch, UINT64_MAX));
+            } else {
+                const auto& dispatchTable = mDevice.get<DispatchTable>();
+                assert(dispatchTable.gvkGetFenceStatus);
+                auto vkResult = dispatchTable.gvkGetFenceStatus(mDevice, batch.fence);
+                if (vkResult == VK_NOT_READY) {
+                    break;
+                }
+                gvk_result(vkResult);
+            }
+            gvk_result(release_batch(batch));
+            mAvailableBatches.push_back(std::move(batch));
+            mBatches.pop_front();
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::submit_batch(Batch& batch)
+{
+    assert(batch.recording);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : Make transfer writes available and visible to all subsequent
+        //  commands, Image layout transitions are recorded with each upload.
+        auto memoryBarrier = get_default<VkMemoryBarrier>();
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        assert(dispatchTable.gvkCmdPipelineBarrier);
+        dispatchTable.gvkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+        assert(dispatchTable.gvkEndCommandBuffer);
+        gvk_result(dispatchTable.gvkEndCommandBuffer(batch.commandBuffer));
+        batch.recording = false;
+
+        auto timelineSemaphoreSubmitInfo = get_default<VkTimelineSemaphoreSubmitInfo>();
+        timelineSemaphoreSubmitInfo.signalSemaphoreValueCount = 1;
+        timelineSemaphoreSubmitInfo.pSignalSemaphoreValues = &batch.ticket;
+        auto submitInfo = get_default<VkSubmitInfo>();
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &batch.commandBuffer.get<VkCommandBuffer>();
+        if (mTimelineSemaphore) {
+            submitInfo.pNext = &timelineSemaphoreSubmitInfo;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores = &mTimelineSemaphore.get<VkSemaphore>();
+        }
+        assert(dispatchTable.gvkQueueSubmit);
+        gvk_result(dispatchTable.gvkQueueSubmit(mQueue, 1, &submitInfo, batch.fence));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult UploadManager::wait_batch(Batch& batch, uint64_t timeout)
+{
+    assert(!batch.recording);
+    const auto& dispatchTable = mDevice.get<DispatchTable>();
+    assert(dispatchTable.gvkWaitForFences);
+    return dispatchTable.gvkWaitForFences(mDevice, 1, &batch.fence.get<VkFence>(), VK_TRUE, timeout);
+}
+
+VkResult UploadManager::release_batch(Batch& batch)
+{
+    assert(!batch.recording);
+    assert(batch.ringBufferSize <= mRingBufferUsed);
+    mRingBufferUsed -= batch.ringBufferSize;
+    batch.ringBufferSize = 0;
+    batch.stagedSize = 0;
+    batch.dedicatedBuffers.clear();
+    const auto& dispatchTable = mDevice.get<DispatchTable>();
+    assert(dispatchTable.gvkResetFences);
+    return dispatchTable.gvkResetFences(mDevice, 1, &batch.fence.get<VkFence>());
+}
+
+} // namespace gvk
@@ -25,9 +25,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 
 #include "gvk-handles/utilities.hpp"
+#include "gvk-format-info.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 namespace gvk {
 
@@ -74,6 +76,152 @@ VkExtent3D get_mip_level_extent(const VkExtent3D& imageExtent, uint32_t mipLevel
     };
 }
 
+static uint32_t get_image_aspect_plane_index(VkImageAspectFlagBits imageAspectFlagBits)
+{
+    switch (imageAspectFlagBits) {
+    case VK_IMAGE_ASPECT_PLANE_0_BIT: return 0;
+    case VK_IMAGE_ASPECT_PLANE_1_BIT: return 1;
+    case VK_IMAGE_ASPECT_PLANE_2_BIT: return 2;
+    default: return UINT32_MAX;
+    }
+}
+
+static uint32_t get_image_aspect_texel_block_size(VkFormat format, VkImageAspectFlagBits imageAspectFlagBits)
+{
+    const auto& formatInfo = get_format_info(format);
+    switch (imageAspectFlagBits) {
+    case VK_IMAGE_ASPECT_DEPTH_BIT: {
+        // NOTE : Depth data is copied as 2 bytes per texel for 16 bit depth and
+        //  4 bytes per texel for 24 and 32 bit depth, stencil data is always 1
+        //  byte per texel.
+        for (uint32_t i = 0; i < formatInfo.componentCount; ++i) {
+            if (formatInfo.pComponents[i].name == GVK_FORMAT_COMPONENT_NAME_D) {
+                return formatInfo.pComponents[i].bits == 16 ? 2 : 4;
+            }
+        }
+        return 0;
+    }
+    case VK_IMAGE_ASPECT_STENCIL_BIT: {
+        return 1;
+    }
+    case VK_IMAGE_ASPECT_PLANE_0_BIT:
+    case VK_IMAGE_ASPECT_PLANE_1_BIT:
+    case VK_IMAGE_ASPECT_PLANE_2_BIT: {
+        auto planeIndex = get_image_aspect_plane_index(imageAspectFlagBits);
+        return planeIndex < formatInfo.planeCount ? get_format_info(formatInfo.pPlanes[planeIndex].compatible).blockSize : 0;
+    }
+    default: {
+        return formatInfo.blockSize;
+    }
+    }
+}
+
+VkDeviceSize get_image_aspect_data_size(VkFormat format, const VkExtent3D& extent, VkImageAspectFlagBits imageAspectFlagBits)
+{
+    const auto& formatInfo = get_format_info(format);
+    switch (imageAspectFlagBits) {
+    case VK_IMAGE_ASPECT_DEPTH_BIT:
+    case VK_IMAGE_ASPECT_STENCIL_BIT: {
+        return (VkDeviceSize)get_image_aspect_texel_block_size(format, imageAspectFlagBits) * extent.width * extent.height * extent.depth;
+    }
+    case VK_IMAGE_ASPECT_PLANE_0_BIT:
+    case VK_IMAGE_ASPECT_PLANE_1_BIT:
+    case VK_IMAGE_ASPECT_PLANE_2_BIT: {
+        auto planeIndex = get_image_aspect_plane_index(imageAspectFlagBits);
+        if (planeIndex < formatInfo.planeCount) {
+            const auto& plane = formatInfo.pPlanes[planeIndex];
+            auto planeExtent = extent;
+            planeExtent.width = (extent.width + plane.widthDivisor - 1) / plane.widthDivisor;
+            planeExtent.height = (extent.height + plane.heightDivisor - 1) / plane.heightDivisor;
+            return get_image_aspect_data_size(plane.compatible, planeExtent, VK_IMAGE_ASPECT_COLOR_BIT);
+        }
+        return 0;
+    }
+    default: {
+        if (formatInfo.blockExtent[0] && formatInfo.blockExtent[1] && formatInfo.blockExtent[2]) {
+            VkDeviceSize blockCount = 1;
+            blockCount *= (extent.width + formatInfo.blockExtent[0] - 1) / formatInfo.blockExtent[0];
+            blockCount *= (extent.height + formatInfo.blockExtent[1] - 1) / formatInfo.blockExtent[1];
+            blockCount *= (extent.depth + formatInfo.blockExtent[2] - 1) / formatInfo.blockExtent[2];
+            return blockCount * formatInfo.blockSize;
+        }
+        return 0;
+    }
+    }
+}
+
+VkDeviceSize get_buffer_image_copies(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange, uint32_t* pBufferImageCopyCount, VkBufferImageCopy* pBufferImageCopies)
+{
+    assert(pBufferImageCopyCount);
+    const auto& formatInfo = get_format_info(imageCreateInfo.format);
+    auto levelCount = imageSubresourceRange.levelCount != VK_REMAINING_MIP_LEVELS ? imageSubresourceRange.levelCount : imageCreateInfo.mipLevels - imageSubresourceRange.baseMipLevel;
+    auto layerCount = imageSubresourceRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? imageSubresourceRange.layerCount : imageCreateInfo.arrayLayers - imageSubresourceRange.baseArrayLayer;
+    assert(imageSubresourceRange.baseMipLevel + levelCount <= imageCreateInfo.mipLevels);
+    assert(imageSubresourceRange.baseArrayLayer + layerCount <= imageCreateInfo.arrayLayers);
+
+    // NOTE : Multi-planar formats report VK_IMAGE_ASPECT_COLOR_BIT, but copies
+    //  have to address each plane individually.
+    uint32_t imageAspectFlagBitCount = 0;
+    std::array<VkImageAspectFlagBits, 3> imageAspectFlagBits { };
+    auto imageAspectFlags = imageSubresourceRange.aspectMask & get_image_aspect_flags(imageCreateInfo.format);
+    if (1 < formatInfo.planeCount) {
+        for (uint32_t i = 0; i < formatInfo.planeCount && i < imageAspectFlagBits.size(); ++i) {
+            auto planeImageAspectFlagBit = (VkImageAspectFlagBits)(VK_IMAGE_ASPECT_PLANE_0_BIT << i);
+            if (imageAspectFlags & VK_IMAGE_ASPECT_COLOR_BIT || imageSubresourceRange.aspectMask & planeImageAspectFlagBit) {
+                imageAspectFlagBits[imageAspectFlagBitCount++] = planeImageAspectFlagBit;
+            }
+        }
+    } else {
+        for (auto imageAspectFlagBit : { VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_ASPECT_DEPTH_BIT, VK_IMAGE_ASPECT_STENCIL_BIT }) {
+            if (imageAspectFlags & imageAspectFlagBit) {
+                imageAspectFlagBits[imageAspectFlagBitCount++] = imageAspectFlagBit;
+            }
+        }
+    }
+
+    // NOTE : VkBufferImageCopy::bufferOffset must be a multiple of 4 and a
+    //  multiple of the texel block size of the VkFormat being copied.  Rows are
+    //  tightly packed (bufferRowLength and bufferImageHeight are 0) so that
+    //  downloaded data can be uploaded to a device with different limits.
+    std::array<VkDeviceSize, 3> alignments { };
+    for (uint32_t i = 0; i < imageAspectFlagBitCount; ++i) {
+        alignments[i] = std::lcm<VkDeviceSize>(4, std::max<VkDeviceSize>(1, get_image_aspect_texel_block_size(imageCreateInfo.format, imageAspectFlagBits[i])));
+    }
+
+    uint32_t bufferImageCopyCount = 0;
+    VkDeviceSize bufferOffset = 0;
+    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.baseArrayLayer + layerCount; ++arrayLayer) {
+        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.baseMipLevel + levelCount; ++mipLevel) {
+            auto mipLevelExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
+            for (uint32_t i = 0; i < imageAspectFlagBitCount; ++i) {
+                bufferOffset = (bufferOffset + alignments[i] - 1) / alignments[i] * alignments[i];
+                if (pBufferImageCopies && bufferImageCopyCount < *pBufferImageCopyCount) {
+                    auto& bufferImageCopy = pBufferImageCopies[bufferImageCopyCount];
+                    bufferImageCopy = get_default<VkBufferImageCopy>();
+                    bufferImageCopy.bufferOffset = bufferOffset;
+                    bufferImageCopy.imageSubresource.aspectMask = imageAspectFlagBits[i];
+                    bufferImageCopy.imageSubresource.mipLevel = mipLevel;
+                    bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
+                    bufferImageCopy.imageSubresource.layerCount = 1;
+                    bufferImageCopy.imageExtent = mipLevelExtent;
+                    auto planeIndex = get_image_aspect_plane_index(imageAspectFlagBits[i]);
+                    if (planeIndex < formatInfo.planeCount) {
+                        const auto& plane = formatInfo.pPlanes[planeIndex];
+                        bufferImageCopy.imageExtent.width = (mipLevelExtent.width + plane.widthDivisor - 1) / plane.widthDivisor;
+                        bufferImageCopy.imageExtent.height = (mipLevelExtent.height + plane.heightDivisor - 1) / plane.heightDivisor;
+                    }
+                }
+                bufferOffset += get_image_aspect_data_size(imageCreateInfo.format, mipLevelExtent, imageAspectFlagBits[i]);
+                ++bufferImageCopyCount;
+            }
+        }
+    }
+    if (!pBufferImageCopies) {
+        *pBufferImageCopyCount = bufferImageCopyCount;
+    }
+    return bufferOffset;
+}
+
 VkSampleCountFlagBits get_max_framebuffer_sample_count(const PhysicalDevice& physicalDevice, VkBool32 color, VkBool32 depth, VkBool32 stencil)
 {
     assert(physicalDevice);
@@ -34,6 +34,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 
 namespace gvk {
 
@@ -61,6 +62,25 @@ VkResult WsiManager::create(const Device& device, const CreateInfo* pCreateInfo,
                 }
             }
 
+            // Get frames in flight and present wait pacing
+            // NOTE : Present wait pacing is only used when VK_KHR_present_id and
+            //  VK_KHR_present_wait are enabled, the corresponding presentId and
+            //  presentWait features must also be enabled by the caller.
+            pWsiManager->mMaxFramesInFlight = std::max(pCreateInfo->maxFramesInFlight, 1u);
+            pWsiManager->mMaxPresentLatency = 0;
+            if (pCreateInfo->maxPresentLatency) {
+                bool presentIdEnabled = false;
+                bool presentWaitEnabled = false;
+                const auto& deviceCreateInfo = device.get<VkDeviceCreateInfo>();
+                for (uint32_t i = 0; i < deviceCreateInfo.enabledExtensionCount; ++i) {
+                    presentIdEnabled |= !strcmp(deviceCreateInfo.ppEnabledExtensionNames[i], VK_KHR_PRESENT_ID_EXTENSION_NAME);
+                    presentWaitEnabled |= !strcmp(deviceCreateInfo.ppEnabledExtensionNames[i], VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+                }
+                if (presentIdEnabled && presentWaitEnabled && device.get<DispatchTable>().gvkWaitForPresentKHR) {
+                    pWsiManager->mMaxPresentLatency = pCreateInfo->maxPresentLatency;
+                }
+            }
+
             // Get depth VkFormat
             if (pCreateInfo->depthFormat) {
                 GvkFormatInfo formatInfo { };
@@ -122,7 +142,14 @@ WsiManager::~WsiManager()
 
 void WsiManager::reset()
 {
+    if (mDevice) {
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        assert(dispatchTable.gvkDeviceWaitIdle);
+        dispatchTable.gvkDeviceWaitIdle(mDevice);
+    }
     invalidate();
+    mRetiredSwapchain.reset();
+    mRetiredImageRenderedSemaphores.clear();
     mDevice.reset();
     mSurface.reset();
 }
@@ -159,12 +186,24 @@ const std::vector<VkFence>& WsiManager::get_vk_fences() const
 
 const Semaphore& WsiManager::get_image_acquired_semaphore() const
 {
-    return mImageAcquiredSemaphore;
+    static const Semaphore sNullSemaphore;
+    return mFrameIndex < mImageAcquiredSemaphores.size() ? mImageAcquiredSemaphores[mFrameIndex] : sNullSemaphore;
+}
+
+const std::vector<Semaphore>& WsiManager::get_image_acquired_semaphores() const
+{
+    return mImageAcquiredSemaphores;
 }
 
 const Semaphore& WsiManager::get_image_rendered_semaphore() const
 {
-    return mImageRenderedSemaphore;
+    static const Semaphore sNullSemaphore;
+    return mImageIndex < mImageRenderedSemaphores.size() ? mImageRenderedSemaphores[mImageIndex] : sNullSemaphore;
+}
+
+const std::vector<Semaphore>& WsiManager::get_image_rendered_semaphores() const
+{
+    return mImageRenderedSemaphores;
 }
 
 const std::vector<CommandBuffer>& WsiManager::get_command_buffers() const
@@ -184,8 +223,9 @@ VkBool32 WsiManager::is_enabled() const
     assert((mSwapchain == VK_NULL_HANDLE) == mRenderTargets.empty());
     assert((mSwapchain == VK_NULL_HANDLE) == mFences.empty());
     assert((mSwapchain == VK_NULL_HANDLE) == mVkFences.empty());
-    assert((mSwapchain == VK_NULL_HANDLE) == (mImageAcquiredSemaphore == VK_NULL_HANDLE));
-    assert((mSwapchain == VK_NULL_HANDLE) == (mImageRenderedSemaphore == VK_NULL_HANDLE));
+    assert((mSwapchain == VK_NULL_HANDLE) == mImageAcquiredSemaphores.empty());
+    assert((mSwapchain == VK_NULL_HANDLE) == mImageRenderedSemaphores.empty());
+    assert(mImageRenderedSemaphores.size() == mFences.size());
     return mSurface && mSwapchain;
 }
 
@@ -199,6 +239,11 @@ VkPresentModeKHR WsiManager::get_present_mode() const
     return mPresentMode;
 }
 
+uint32_t WsiManager::get_max_frames_in_flight() const
+{
+    return mMaxFramesInFlight;
+}
+
 VkSampleCountFlagBits WsiManager::get_sample_count() const
 {
     return mSampleCount;
@@ -222,10 +267,45 @@ VkBool32 WsiManager::update()
 VkResult WsiManager::acquire_next_image(uint64_t timeout, VkFence vkFence, uint32_t* pImageIndex)
 {
     assert(pImageIndex);
-    assert(mImageAcquiredSemaphore);
+    assert(!mImageAcquiredSemaphores.empty());
+    assert(mFrameImageIndices.size() == mImageAcquiredSemaphores.size());
     const auto& dispatchTable = mDevice.get<DispatchTable>();
+
+    // NOTE : The image acquired Semaphore for the next frame was last waited on by
+    //  the submission for the image that was acquired maxFramesInFlight frames ago.
+    //  That submission signals the Fence for its image, so waiting on that Fence
+    //  both limits the number of frames in flight and guarantees that the image
+    //  acquired Semaphore is safe to reuse.
+    auto frameIndex = (mFrameIndex + 1) % (uint32_t)mImageAcquiredSemaphores.size();
+    auto frameImageIndex = mFrameImageIndices[frameIndex];
+    if (frameImageIndex < mVkFences.size()) {
+        assert(dispatchTable.gvkWaitForFences);
+        auto vkResult = dispatchTable.gvkWaitForFences(mDevice, 1, &mVkFences[frameImageIndex], VK_TRUE, timeout);
+        if (vkResult != VK_SUCCESS) {
+            return vkResult;
+        }
+    }
+
+    // NOTE : When present wait pacing is enabled, wait for the present that was
+    //  queued maxPresentLatency frames ago to complete, present ids are only
+    //  waited on for presents queued on the current SwapchainKHR.
+    if (mMaxPresentLatency && mSwapchainFirstPresentId + mMaxPresentLatency <= mPresentId + 1) {
+        assert(dispatchTable.gvkWaitForPresentKHR);
+        auto vkResult = dispatchTable.gvkWaitForPresentKHR(mDevice, mSwapchain, mPresentId - mMaxPresentLatency + 1, timeout);
+        if (vkResult != VK_SUCCESS && vkResult != VK_TIMEOUT) {
+            mStatus = vkResult;
+            return mStatus;
+        }
+    }
+
     assert(dispatchTable.gvkAcquireNextImageKHR);
-    mStatus = dispatchTable.gvkAcquireNextImageKHR(mDevice, mSwapchain, timeout, mImageAcquiredSemaphore, vkFence, pImageIndex);
+    mStatus = dispatchTable.gvkAcquireNextImageKHR(mDevice, mSwapchain, timeout, mImageAcquiredSemaphores[frameIndex], vkFence, pImageIndex);
+    if (mStatus == VK_SUCCESS || mStatus == VK_SUBOPTIMAL_KHR) {
+        mFrameIndex = frameIndex;
+        mFrameImageIndices[mFrameIndex] = *pImageIndex;
+        mImageIndex = *pImageIndex;
+        ++mPresentId;
+    }
     return mStatus;
 }
 
@@ -235,22 +315,28 @@ VkSubmitInfo WsiManager::get_submit_info(uint32_t imageIndex) const
     static const VkPipelineStageFlags sWaitStage[]{ VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
     auto submitInfo = get_default<VkSubmitInfo>();
     submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = &mImageAcquiredSemaphore.get<VkSemaphore>();
+    submitInfo.pWaitSemaphores = &mImageAcquiredSemaphores[mFrameIndex].get<VkSemaphore>();
     submitInfo.pWaitDstStageMask = sWaitStage;
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &mCommandBuffers[imageIndex].get<VkCommandBuffer>();
     submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = &mImageRenderedSemaphore.get<VkSemaphore>();
+    submitInfo.pSignalSemaphores = &mImageRenderedSemaphores[imageIndex].get<VkSemaphore>();
     return submitInfo;
 }
 
 VkPresentInfoKHR WsiManager::get_present_info(const uint32_t* pImageIndex) const
 {
     assert(pImageIndex);
-    assert(mImageRenderedSemaphore);
+    assert(*pImageIndex < mImageRenderedSemaphores.size());
     auto presentInfo = get_default<VkPresentInfoKHR>();
+    if (mMaxPresentLatency) {
+        mPresentIdKHR = get_default<VkPresentIdKHR>();
+        mPresentIdKHR.swapchainCount = 1;
+        mPresentIdKHR.pPresentIds = &mPresentId;
+        presentInfo.pNext = &mPresentIdKHR;
+    }
     presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores = &mImageRenderedSemaphore.get<VkSemaphore>();
+    presentInfo.pWaitSemaphores = &mImageRenderedSemaphores[*pImageIndex].get<VkSemaphore>();
     presentInfo.swapchainCount = 1;
     presentInfo.pSwapchains = &mSwapchain.get<VkSwapchainKHR>();
     presentInfo.pImageIndices = pImageIndex;
@@ -265,19 +351,25 @@ VkResult WsiManager::validate()
     assert(dispatchTable.gvkGetPhysicalDeviceSurfaceCapabilitiesKHR);
     auto vkResult = dispatchTable.gvkGetPhysicalDeviceSurfaceCapabilitiesKHR(mDevice.get<PhysicalDevice>(), mSurface, &surfaceCapabilities);
     bool swapchainImageExtentMatchesSurfaceCapabilities = mSwapchain && mSwapchain.get<VkSwapchainCreateInfoKHR>().imageExtent == surfaceCapabilities.currentExtent;
-    if (mStatus != VK_SUCCESS || vkResult != VK_SUCCESS ||
-        !surfaceCapabilities.currentExtent.width ||
-        !surfaceCapabilities.currentExtent.height ||
-        !swapchainImageExtentMatchesSurfaceCapabilities
-    ) {
+    bool surfaceExtentValid = surfaceCapabilities.currentExtent.width && surfaceCapabilities.currentExtent.height;
+    bool recreate = surfaceExtentValid && (mStatus != VK_SUCCESS || vkResult != VK_SUCCESS || !swapchainImageExtentMatchesSurfaceCapabilities);
+
+    // NOTE : When recreating resources the current SwapchainKHR is provided as the
+    //  oldSwapchain for the new SwapchainKHR.  Presents queued on it may still be
+    //  waiting on its image rendered Semaphores, so the SwapchainKHR and those
+    //  Semaphores are retired together until the next recreation rather than
+    //  destroyed.  The previously retired SwapchainKHR is released before its
+    //  Semaphores.
+    if (recreate) {
+        mRetiredSwapchain = mSwapchain;
+        mRetiredImageRenderedSemaphores = std::move(mImageRenderedSemaphores);
+    }
+    if (mStatus != VK_SUCCESS || vkResult != VK_SUCCESS || !surfaceExtentValid || !swapchainImageExtentMatchesSurfaceCapabilities) {
         invalidate();
     }
-    if (surfaceCapabilities.currentExtent.width &&
-        surfaceCapabilities.currentExtent.height &&
-        !swapchainImageExtentMatchesSurfaceCapabilities
-    ) {
+    if (recreate) {
         gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-            gvk_result(create_swapchain());
+            gvk_result(create_swapchain(mRetiredSwapchain));
             gvk_result(create_render_pass());
             gvk_result(create_command_buffers());
             gvk_result(create_render_targets());
@@ -294,22 +386,36 @@ VkResult WsiManager::validate()
 
 void WsiManager::invalidate()
 {
-    if (mDevice) {
-        const auto& dispatchTable = mDevice.get<DispatchTable>();
-        assert(dispatchTable.gvkDeviceWaitIdle);
-        dispatchTable.gvkDeviceWaitIdle(mDevice);
-    }
+    // NOTE : Every submission made for this WsiManager's SwapchainKHR images signals
+    //  one of this WsiManager's Fences, waiting on those Fences rather than the
+    //  Device allows resources to be recreated without stalling unrelated work.
+    wait_for_fences();
     mSwapchain.reset();
     mRenderPass.reset();
     mCommandBuffers.clear();
     mRenderTargets.clear();
     mFences.clear();
     mVkFences.clear();
-    mImageAcquiredSemaphore.reset();
-    mImageRenderedSemaphore.reset();
+    mImageAcquiredSemaphores.clear();
+    mImageRenderedSemaphores.clear();
+    mFrameImageIndices.clear();
+    mFrameIndex = 0;
+    mImageIndex = 0;
+    mSwapchainFirstPresentId = mPresentId + 1;
     mStatus = VK_ERROR_OUT_OF_DATE_KHR;
 }
 
+VkResult WsiManager::wait_for_fences()
+{
+    VkResult vkResult = VK_SUCCESS;
+    if (mDevice && !mVkFences.empty()) {
+        const auto& dispatchTable = mDevice.get<DispatchTable>();
+        assert(dispatchTable.gvkWaitForFences);
+        vkResult = dispatchTable.gvkWaitForFences(mDevice, (uint32_t)mVkFences.size(), mVkFences.data(), VK_TRUE, UINT64_MAX);
+    }
+    return vkResult;
+}
+
 VkResult WsiManager::create_surface(const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator)
 {
     assert(mDevice);
@@ -397,7 +503,7 @@ VkResult WsiManager::create_surface(const CreateInfo* pCreateInfo, const VkAlloc
     return gvkResult;
 }
 
-VkResult WsiManager::create_swapchain()
+VkResult WsiManager::create_swapchain(const SwapchainKHR& oldSwapchain)
 {
     assert(mDevice);
     assert(mSurface);
@@ -434,9 +540,10 @@ VkResult WsiManager::create_swapchain()
             // Create gvk::SwapchainKHR
             auto minImageCount = surfaceCapabilities.minImageCount;
             auto maxImageCount = surfaceCapabilities.maxImageCount;
+            auto imageCount = std::max(minImageCount + 1, mMaxFramesInFlight);
             auto swapchainCreateInfo = get_default<VkSwapchainCreateInfoKHR>();
             swapchainCreateInfo.surface = mSurface;
-            swapchainCreateInfo.minImageCount = maxImageCount ? std::clamp(minImageCount + 1, minImageCount, maxImageCount) : minImageCount + 1;
+            swapchainCreateInfo.minImageCount = maxImageCount ? std::clamp(imageCount, minImageCount, maxImageCount) : imageCount;
             swapchainCreateInfo.imageFormat = surfaceFormat.format;
             swapchainCreateInfo.imageColorSpace = surfaceFormat.colorSpace;
             swapchainCreateInfo.imageExtent = surfaceCapabilities.currentExtent;
@@ -446,6 +553,7 @@ VkResult WsiManager::create_swapchain()
             swapchainCreateInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
             swapchainCreateInfo.presentMode = mPresentMode;
             swapchainCreateInfo.clipped = VK_TRUE;
+            swapchainCreateInfo.oldSwapchain = oldSwapchain;
             gvk_result(SwapchainKHR::create(mDevice, &swapchainCreateInfo, validate_allocator(mAllocator), &mSwapchain));
         } else {
             invalidate();
@@ -651,8 +759,16 @@ VkResult WsiManager::create_synchronization_primitives()
             gvk_result(Fence::create(mDevice, &fenceCreateInfo, validate_allocator(mAllocator), &mFences[i]));
             mVkFences[i] = mFences[i];
         }
-        gvk_result(Semaphore::create(mDevice, &get_default<VkSemaphoreCreateInfo>(), validate_allocator(mAllocator), &mImageAcquiredSemaphore));
-        gvk_result(Semaphore::create(mDevice, &get_default<VkSemaphoreCreateInfo>(), validate_allocator(mAllocator), &mImageRenderedSemaphore));
+        mImageRenderedSemaphores.resize(mRenderTargets.size());
+        for (auto& imageRenderedSemaphore : mImageRenderedSemaphores) {
+            gvk_result(Semaphore::create(mDevice, &get_default<VkSemaphoreCreateInfo>(), validate_allocator(mAllocator), &imageRenderedSemaphore));
+        }
+        mImageAcquiredSemaphores.resize(mMaxFramesInFlight);
+        for (auto& imageAcquiredSemaphore : mImageAcquiredSemaphores) {
+            gvk_result(Semaphore::create(mDevice, &get_default<VkSemaphoreCreateInfo>(), validate_allocator(mAllocator), &imageAcquiredSemaphore));
+        }
+        mFrameImageIndices.assign(mMaxFramesInFlight, UINT32_MAX);
+        mFrameIndex = mMaxFramesInFlight - 1;
     } gvk_result_scope_end;
     return gvkResult;
 }
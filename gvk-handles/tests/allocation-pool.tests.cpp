@@ -0,0 +1,105 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/allocation-pool.hpp"
+#include "gvk-handles/context.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <vector>
+
+static VkBufferCreateInfo get_buffer_create_info(VkDeviceSize size)
+{
+    auto bufferCreateInfo = gvk::get_default<VkBufferCreateInfo>();
+    bufferCreateInfo.size = size;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    return bufferCreateInfo;
+}
+
+TEST(AllocationPool, Linear)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+
+    auto bufferCreateInfo = get_buffer_create_info(256);
+    auto allocationPoolCreateInfo = gvk::get_default<gvk::AllocationPool::CreateInfo>();
+    allocationPoolCreateInfo.pName = "gvk::AllocationPool.Linear";
+    allocationPoolCreateInfo.algorithm = gvk::AllocationPool::Algorithm::Linear;
+    allocationPoolCreateInfo.pBufferCreateInfo = &bufferCreateInfo;
+    allocationPoolCreateInfo.blockSize = 64 * 1024;
+    gvk::AllocationPool allocationPool;
+    ASSERT_EQ(gvk::AllocationPool::create(device, &allocationPoolCreateInfo, &allocationPool), VK_SUCCESS);
+    EXPECT_EQ(allocationPool.get_name(), "gvk::AllocationPool.Linear");
+
+    {
+        std::vector<gvk::Buffer> buffers(16);
+        auto allocationCreateInfo = allocationPool.get_allocation_create_info();
+        VkDeviceMemory vkDeviceMemory = VK_NULL_HANDLE;
+        for (auto& buffer : buffers) {
+            ASSERT_EQ(gvk::Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &buffer), VK_SUCCESS);
+            VmaAllocationInfo allocationInfo { };
+            vmaGetAllocationInfo(device.get<VmaAllocator>(), buffer.get<VmaAllocation>(), &allocationInfo);
+            vkDeviceMemory = vkDeviceMemory ? vkDeviceMemory : allocationInfo.deviceMemory;
+            EXPECT_EQ(allocationInfo.deviceMemory, vkDeviceMemory);
+        }
+        auto statistics = allocationPool.get_statistics();
+        EXPECT_EQ(statistics.allocationCount, (uint32_t)buffers.size());
+        EXPECT_EQ(statistics.blockCount, 1u);
+    }
+    EXPECT_EQ(allocationPool.get_statistics().allocationCount, 0u);
+}
+
+TEST(AllocationPool, Ring)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+
+    auto bufferCreateInfo = get_buffer_create_info(1024);
+    auto allocationPoolCreateInfo = gvk::get_default<gvk::AllocationPool::CreateInfo>();
+    allocationPoolCreateInfo.algorithm = gvk::AllocationPool::Algorithm::Ring;
+    allocationPoolCreateInfo.pBufferCreateInfo = &bufferCreateInfo;
+    allocationPoolCreateInfo.blockSize = 64 * 1024;
+    gvk::AllocationPool allocationPool;
+    ASSERT_EQ(gvk::AllocationPool::create(device, &allocationPoolCreateInfo, &allocationPool), VK_SUCCESS);
+
+    // NOTE : Allocating far more than the ring's single block while releasing
+    //  the oldest allocation first forces allocations to wrap.
+    auto allocationCreateInfo = allocationPool.get_allocation_create_info();
+    std::vector<gvk::Buffer> buffers(8);
+    for (uint32_t i = 0; i < 1024; ++i) {
+        auto& buffer = buffers[i % buffers.size()];
+        buffer.reset();
+        ASSERT_EQ(gvk::Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &buffer), VK_SUCCESS);
+    }
+    EXPECT_EQ(allocationPool.get_statistics().blockCount, 1u);
+}
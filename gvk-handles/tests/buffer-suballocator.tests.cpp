@@ -0,0 +1,90 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/buffer-suballocator.hpp"
+#include "gvk-handles/context.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+TEST(BufferSuballocator, BufferRanges)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+
+    auto bufferCreateInfo = gvk::get_default<VkBufferCreateInfo>();
+    bufferCreateInfo.size = 4096;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    auto allocationCreateInfo = gvk::get_default<VmaAllocationCreateInfo>();
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    auto bufferSuballocatorCreateInfo = gvk::get_default<gvk::BufferSuballocator::CreateInfo>();
+    bufferSuballocatorCreateInfo.pBufferCreateInfo = &bufferCreateInfo;
+    bufferSuballocatorCreateInfo.pAllocationCreateInfo = &allocationCreateInfo;
+    gvk::BufferSuballocator bufferSuballocator;
+    ASSERT_EQ(gvk::BufferSuballocator::create(device, &bufferSuballocatorCreateInfo, &bufferSuballocator), VK_SUCCESS);
+    auto minAlignment = bufferSuballocator.get_min_alignment();
+    ASSERT_LE(minAlignment, bufferCreateInfo.size);
+
+    // NOTE : Every gvk::BufferRange shares the parent gvk::Buffer, allocate until
+    //  the parent gvk::Buffer is full.
+    std::vector<gvk::BufferRange> bufferRanges;
+    while (true) {
+        gvk::BufferRange bufferRange;
+        if (bufferSuballocator.allocate(16, 0, &bufferRange) != VK_SUCCESS) {
+            break;
+        }
+        EXPECT_EQ(bufferRange.get_buffer().get<VkBuffer>(), bufferSuballocator.get_buffer().get<VkBuffer>());
+        EXPECT_EQ(bufferRange.get_offset() % minAlignment, 0u);
+        EXPECT_EQ(bufferRange.get_size(), 16u);
+        ASSERT_NE(bufferRange.get_mapped_data(), nullptr);
+        memset(bufferRange.get_mapped_data(), (int)bufferRanges.size(), (size_t)bufferRange.get_size());
+        bufferRanges.push_back(std::move(bufferRange));
+    }
+    ASSERT_FALSE(bufferRanges.empty());
+    EXPECT_EQ(bufferSuballocator.get_statistics().allocationCount, (uint32_t)bufferRanges.size());
+
+    // NOTE : A released gvk::BufferRange is returned to the gvk::BufferSuballocator.
+    bufferRanges.front().reset();
+    EXPECT_FALSE(bufferRanges.front());
+    ASSERT_EQ(bufferSuballocator.allocate(16, 0, &bufferRanges.front()), VK_SUCCESS);
+    EXPECT_TRUE(bufferRanges.front());
+
+    // NOTE : gvk::BufferRanges keep the parent gvk::Buffer alive.
+    auto vkBuffer = bufferSuballocator.get_buffer().get<VkBuffer>();
+    bufferSuballocator.reset();
+    EXPECT_EQ(bufferRanges.back().get_buffer().get<VkBuffer>(), vkBuffer);
+    bufferRanges.clear();
+}
@@ -0,0 +1,140 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/context.hpp"
+#include "gvk-handles/immediate-executor.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST(ImmediateExecutor, BatchedExecution)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+    gvk::ImmediateExecutor immediateExecutor;
+    ASSERT_EQ(gvk::ImmediateExecutor::create(device, &gvk::get_default<gvk::ImmediateExecutor::CreateInfo>(), nullptr, &immediateExecutor), VK_SUCCESS);
+
+    auto bufferCreateInfo = gvk::get_default<VkBufferCreateInfo>();
+    bufferCreateInfo.size = 256;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    auto allocationCreateInfo = gvk::get_default<VmaAllocationCreateInfo>();
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    gvk::Buffer buffer;
+    ASSERT_EQ(gvk::Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &buffer), VK_SUCCESS);
+
+    // Record two jobs into a single submission
+    const auto& dispatchTable = device.get<gvk::DispatchTable>();
+    ASSERT_EQ(immediateExecutor.record([&](VkCommandBuffer vkCommandBuffer) { dispatchTable.gvkCmdFillBuffer(vkCommandBuffer, buffer, 0, 128, 0x01010101); }), VK_SUCCESS);
+    gvk::ImmediateExecutor::Ticket ticket;
+    ASSERT_EQ(immediateExecutor.execute([&](VkCommandBuffer vkCommandBuffer) { dispatchTable.gvkCmdFillBuffer(vkCommandBuffer, buffer, 128, 128, 0x02020202); }, &ticket), VK_SUCCESS);
+    ASSERT_EQ(ticket.wait(), VK_SUCCESS);
+    EXPECT_TRUE(ticket.is_complete());
+
+    const auto& allocator = device.get<VmaAllocator>();
+    vmaInvalidateAllocation(allocator, buffer.get<VmaAllocation>(), 0, VK_WHOLE_SIZE);
+    VmaAllocationInfo allocationInfo { };
+    vmaGetAllocationInfo(allocator, buffer.get<VmaAllocation>(), &allocationInfo);
+    ASSERT_NE(allocationInfo.pMappedData, nullptr);
+    std::vector<uint8_t> expectedData(256, 0x01);
+    std::fill(expectedData.begin() + 128, expectedData.end(), (uint8_t)0x02);
+    auto pData = (const uint8_t*)allocationInfo.pMappedData;
+    EXPECT_EQ(std::vector<uint8_t>(pData, pData + expectedData.size()), expectedData);
+
+    // An empty submission yields a complete Ticket
+    ASSERT_EQ(immediateExecutor.submit(&ticket), VK_SUCCESS);
+    EXPECT_TRUE(ticket.is_complete());
+    ASSERT_EQ(immediateExecutor.wait_idle(), VK_SUCCESS);
+}
+
+TEST(ImmediateExecutor, SharedQueue)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+
+    // NOTE : Both ImmediateExecutor objects submit to the same VkQueue from their
+    //  own threads, the shared std::mutex synchronizes access to the VkQueue.
+    std::mutex queueMutex;
+    auto immediateExecutorCreateInfo = gvk::get_default<gvk::ImmediateExecutor::CreateInfo>();
+    immediateExecutorCreateInfo.queue = gvk::get_queue_family(device, 0).queues[0];
+    immediateExecutorCreateInfo.pQueueMutex = &queueMutex;
+    std::array<gvk::ImmediateExecutor, 2> immediateExecutors;
+    std::array<gvk::Buffer, 2> buffers;
+    for (size_t i = 0; i < immediateExecutors.size(); ++i) {
+        ASSERT_EQ(gvk::ImmediateExecutor::create(device, &immediateExecutorCreateInfo, nullptr, &immediateExecutors[i]), VK_SUCCESS);
+        auto bufferCreateInfo = gvk::get_default<VkBufferCreateInfo>();
+        bufferCreateInfo.size = 256;
+        bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        auto allocationCreateInfo = gvk::get_default<VmaAllocationCreateInfo>();
+        allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        ASSERT_EQ(gvk::Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, &buffers[i]), VK_SUCCESS);
+    }
+
+    const auto& dispatchTable = device.get<gvk::DispatchTable>();
+    std::array<VkResult, 2> results { VK_ERROR_INITIALIZATION_FAILED, VK_ERROR_INITIALIZATION_FAILED };
+    std::array<std::thread, 2> threads;
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i] = std::thread(
+            [&, i]()
+            {
+                results[i] = VK_SUCCESS;
+                for (uint32_t j = 0; j < 64 && results[i] == VK_SUCCESS; ++j) {
+                    results[i] = immediateExecutors[i].execute([&](VkCommandBuffer vkCommandBuffer) { dispatchTable.gvkCmdFillBuffer(vkCommandBuffer, buffers[i], 0, VK_WHOLE_SIZE, (uint32_t)(i + 1) * 0x01010101); });
+                }
+                if (results[i] == VK_SUCCESS) {
+                    results[i] = immediateExecutors[i].wait_idle();
+                }
+            }
+        );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto& allocator = device.get<VmaAllocator>();
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        EXPECT_EQ(results[i], VK_SUCCESS);
+        vmaInvalidateAllocation(allocator, buffers[i].get<VmaAllocation>(), 0, VK_WHOLE_SIZE);
+        VmaAllocationInfo allocationInfo { };
+        vmaGetAllocationInfo(allocator, buffers[i].get<VmaAllocation>(), &allocationInfo);
+        ASSERT_NE(allocationInfo.pMappedData, nullptr);
+        auto pData = (const uint8_t*)allocationInfo.pMappedData;
+        EXPECT_EQ(std::vector<uint8_t>(pData, pData + 256), std::vector<uint8_t>(256, (uint8_t)(i + 1)));
+    }
+}
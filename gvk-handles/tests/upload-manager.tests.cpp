@@ -0,0 +1,234 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/context.hpp"
+#include "gvk-handles/immediate-executor.hpp"
+#include "gvk-handles/upload-manager.hpp"
+#include "gvk-structures/defaults.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+static VkResult create_readback_buffer(const gvk::Device& device, VkDeviceSize size, gvk::Buffer* pBuffer)
+{
+    auto bufferCreateInfo = gvk::get_default<VkBufferCreateInfo>();
+    bufferCreateInfo.size = size;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    auto allocationCreateInfo = gvk::get_default<VmaAllocationCreateInfo>();
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    return gvk::Buffer::create(device, &bufferCreateInfo, &allocationCreateInfo, pBuffer);
+}
+
+static std::vector<uint8_t> get_readback_data(const gvk::Buffer& buffer)
+{
+    const auto& allocator = buffer.get<gvk::Device>().get<VmaAllocator>();
+    vmaInvalidateAllocation(allocator, buffer.get<VmaAllocation>(), 0, VK_WHOLE_SIZE);
+    VmaAllocationInfo allocationInfo { };
+    vmaGetAllocationInfo(allocator, buffer.get<VmaAllocation>(), &allocationInfo);
+    auto pData = (const uint8_t*)allocationInfo.pMappedData;
+    return pData ? std::vector<uint8_t>(pData, pData + buffer.get<VkBufferCreateInfo>().size) : std::vector<uint8_t>();
+}
+
+TEST(UploadManager, BatchedBufferUploads)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+
+    // NOTE : A small ring gvk::Buffer forces uploads to wrap, to wait on earlier
+    //  batches, and to fall back to dedicated staging gvk::Buffers.
+    auto uploadManagerCreateInfo = gvk::get_default<gvk::UploadManager::CreateInfo>();
+    uploadManagerCreateInfo.ringBufferSize = 1024;
+    gvk::UploadManager uploadManager;
+    ASSERT_EQ(gvk::UploadManager::create(device, &uploadManagerCreateInfo, nullptr, &uploadManager), VK_SUCCESS);
+
+    std::vector<uint8_t> expectedData(16 * 1024);
+    std::iota(expectedData.begin(), expectedData.end(), (uint8_t)0);
+    gvk::Buffer buffer;
+    ASSERT_EQ(create_readback_buffer(device, (VkDeviceSize)expectedData.size(), &buffer), VK_SUCCESS);
+
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 1;
+    while (offset < expectedData.size()) {
+        size = std::min(size, (VkDeviceSize)expectedData.size() - offset);
+        ASSERT_EQ(uploadManager.upload(buffer, offset, size, expectedData.data() + offset), VK_SUCCESS);
+        offset += size;
+        size = size * 3 + 1;
+    }
+    ASSERT_EQ(uploadManager.flush(), VK_SUCCESS);
+    EXPECT_EQ(get_readback_data(buffer), expectedData);
+}
+
+TEST(UploadManager, Tickets)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+    gvk::UploadManager uploadManager;
+    ASSERT_EQ(gvk::UploadManager::create(device, &gvk::get_default<gvk::UploadManager::CreateInfo>(), nullptr, &uploadManager), VK_SUCCESS);
+
+    std::vector<uint8_t> expectedData(256, 0x7f);
+    gvk::Buffer buffer;
+    ASSERT_EQ(create_readback_buffer(device, (VkDeviceSize)expectedData.size(), &buffer), VK_SUCCESS);
+
+    gvk::UploadManager::Ticket uploadTicket { };
+    ASSERT_EQ(uploadManager.upload(buffer, 0, expectedData.size(), expectedData.data(), &uploadTicket), VK_SUCCESS);
+    EXPECT_FALSE(uploadManager.is_complete(uploadTicket));
+    gvk::UploadManager::Ticket submitTicket { };
+    ASSERT_EQ(uploadManager.submit(&submitTicket), VK_SUCCESS);
+    EXPECT_EQ(submitTicket, uploadTicket);
+    ASSERT_EQ(uploadManager.wait(uploadTicket), VK_SUCCESS);
+    EXPECT_TRUE(uploadManager.is_complete(uploadTicket));
+    EXPECT_EQ(get_readback_data(buffer), expectedData);
+
+    // NOTE : Tickets that haven't been issued are never complete
+    EXPECT_FALSE(uploadManager.is_complete(uploadTicket + 1));
+    EXPECT_FALSE(uploadManager.is_complete(UINT64_MAX));
+}
+
+TEST(UploadManager, RingBufferWrapAround)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+
+    // NOTE : Each upload is its own batch and only two fit in the ring gvk::Buffer,
+    //  every third upload has to wait on the oldest batch and wrap to the start
+    //  of the ring gvk::Buffer, leaving the space at the end as padding.
+    auto uploadManagerCreateInfo = gvk::get_default<gvk::UploadManager::CreateInfo>();
+    uploadManagerCreateInfo.ringBufferSize = 1024;
+    uploadManagerCreateInfo.batchSize = 384;
+    gvk::UploadManager uploadManager;
+    ASSERT_EQ(gvk::UploadManager::create(device, &uploadManagerCreateInfo, nullptr, &uploadManager), VK_SUCCESS);
+
+    const VkDeviceSize UploadSize = 384;
+    const uint32_t UploadCount = 8;
+    std::vector<uint8_t> expectedData(UploadSize * UploadCount);
+    std::iota(expectedData.begin(), expectedData.end(), (uint8_t)0);
+    gvk::Buffer buffer;
+    ASSERT_EQ(create_readback_buffer(device, (VkDeviceSize)expectedData.size(), &buffer), VK_SUCCESS);
+
+    gvk::UploadManager::Ticket previousTicket { };
+    for (uint32_t i = 0; i < UploadCount; ++i) {
+        gvk::UploadManager::Ticket ticket { };
+        ASSERT_EQ(uploadManager.upload(buffer, i * UploadSize, UploadSize, expectedData.data() + i * UploadSize, &ticket), VK_SUCCESS);
+        EXPECT_LT(previousTicket, ticket);
+        previousTicket = ticket;
+    }
+    ASSERT_EQ(uploadManager.flush(), VK_SUCCESS);
+    EXPECT_TRUE(uploadManager.is_complete(previousTicket));
+    EXPECT_EQ(get_readback_data(buffer), expectedData);
+}
+
+TEST(UploadManager, DedicatedStagingBuffer)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+    auto uploadManagerCreateInfo = gvk::get_default<gvk::UploadManager::CreateInfo>();
+    uploadManagerCreateInfo.ringBufferSize = 256;
+    uploadManagerCreateInfo.batchSize = 64 * 1024;
+    gvk::UploadManager uploadManager;
+    ASSERT_EQ(gvk::UploadManager::create(device, &uploadManagerCreateInfo, nullptr, &uploadManager), VK_SUCCESS);
+
+    // NOTE : The first and last uploads fit in the ring gvk::Buffer, the upload
+    //  between them is larger than the ring gvk::Buffer so it's staged in a
+    //  dedicated gvk::Buffer that's recorded into the same batch.
+    std::vector<uint8_t> expectedData(128 + 4096 + 128);
+    std::iota(expectedData.begin(), expectedData.end(), (uint8_t)0);
+    gvk::Buffer buffer;
+    ASSERT_EQ(create_readback_buffer(device, (VkDeviceSize)expectedData.size(), &buffer), VK_SUCCESS);
+    gvk::UploadManager::Ticket tickets[3] { };
+    ASSERT_EQ(uploadManager.upload(buffer, 0, 128, expectedData.data(), &tickets[0]), VK_SUCCESS);
+    ASSERT_EQ(uploadManager.upload(buffer, 128, 4096, expectedData.data() + 128, &tickets[1]), VK_SUCCESS);
+    ASSERT_EQ(uploadManager.upload(buffer, 128 + 4096, 128, expectedData.data() + 128 + 4096, &tickets[2]), VK_SUCCESS);
+    EXPECT_EQ(tickets[0], tickets[1]);
+    ASSERT_EQ(uploadManager.wait(tickets[1]), VK_SUCCESS);
+    ASSERT_EQ(uploadManager.flush(), VK_SUCCESS);
+    EXPECT_TRUE(uploadManager.is_complete(tickets[2]));
+    EXPECT_EQ(get_readback_data(buffer), expectedData);
+}
+
+TEST(UploadManager, ImageUpload)
+{
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+    gvk::UploadManager uploadManager;
+    ASSERT_EQ(gvk::UploadManager::create(device, &gvk::get_default<gvk::UploadManager::CreateInfo>(), nullptr, &uploadManager), VK_SUCCESS);
+    gvk::ImmediateExecutor immediateExecutor;
+    ASSERT_EQ(gvk::ImmediateExecutor::create(device, &gvk::get_default<gvk::ImmediateExecutor::CreateInfo>(), nullptr, &immediateExecutor), VK_SUCCESS);
+
+    const uint32_t Width = 16;
+    const uint32_t Height = 16;
+    const uint32_t LayerCount = 2;
+    auto imageCreateInfo = gvk::get_default<VkImageCreateInfo>();
+    imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageCreateInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    imageCreateInfo.extent.width = Width;
+    imageCreateInfo.extent.height = Height;
+    imageCreateInfo.arrayLayers = LayerCount;
+    imageCreateInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    auto allocationCreateInfo = gvk::get_default<VmaAllocationCreateInfo>();
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
+    gvk::Image image;
+    ASSERT_EQ(gvk::Image::create(device, &imageCreateInfo, &allocationCreateInfo, &image), VK_SUCCESS);
+
+    // NOTE : Each array layer is uploaded with its own region, bufferOffset is
+    //  relative to the uploaded data.
+    const VkDeviceSize LayerSize = Width * Height * 4;
+    std::vector<uint8_t> expectedData(LayerSize * LayerCount);
+    std::iota(expectedData.begin(), expectedData.end(), (uint8_t)0);
+    std::vector<VkBufferImageCopy> regions(LayerCount);
+    for (uint32_t i = 0; i < LayerCount; ++i) {
+        regions[i] = { };
+        regions[i].bufferOffset = i * LayerSize;
+        regions[i].imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        regions[i].imageSubresource.baseArrayLayer = i;
+        regions[i].imageSubresource.layerCount = 1;
+        regions[i].imageExtent = { Width, Height, 1 };
+    }
+    gvk::UploadManager::Ticket uploadTicket { };
+    ASSERT_EQ(uploadManager.upload(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, (uint32_t)regions.size(), regions.data(), (VkDeviceSize)expectedData.size(), expectedData.data(), &uploadTicket), VK_SUCCESS);
+    ASSERT_EQ(uploadManager.wait(uploadTicket), VK_SUCCESS);
+    EXPECT_TRUE(uploadManager.is_complete(uploadTicket));
+
+    gvk::Buffer buffer;
+    ASSERT_EQ(create_readback_buffer(device, (VkDeviceSize)expectedData.size(), &buffer), VK_SUCCESS);
+    const auto& dispatchTable = device.get<gvk::DispatchTable>();
+    gvk::ImmediateExecutor::Ticket readbackTicket;
+    ASSERT_EQ(immediateExecutor.execute([&](VkCommandBuffer vkCommandBuffer) { dispatchTable.gvkCmdCopyImageToBuffer(vkCommandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer, (uint32_t)regions.size(), regions.data()); }, &readbackTicket), VK_SUCCESS);
+    ASSERT_EQ(readbackTicket.wait(), VK_SUCCESS);
+    EXPECT_EQ(get_readback_data(buffer), expectedData);
+}
@@ -0,0 +1,147 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-handles/utilities.hpp"
+#include "gvk-format-info.hpp"
+#include "gvk-structures/to-string.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <vector>
+
+static std::vector<VkBufferImageCopy> get_buffer_image_copies(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange, VkDeviceSize* pSize)
+{
+    uint32_t bufferImageCopyCount = 0;
+    gvk::get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, nullptr);
+    std::vector<VkBufferImageCopy> bufferImageCopies(bufferImageCopyCount);
+    *pSize = gvk::get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, bufferImageCopies.data());
+    return bufferImageCopies;
+}
+
+TEST(utilities, get_image_aspect_data_size)
+{
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_R8G8B8A8_UNORM, { 17, 9, 1 }, VK_IMAGE_ASPECT_COLOR_BIT), 17u * 9u * 4u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_R8G8B8_UNORM, { 3, 3, 3 }, VK_IMAGE_ASPECT_COLOR_BIT), 3u * 3u * 3u * 3u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_BC1_RGB_UNORM_BLOCK, { 4, 4, 1 }, VK_IMAGE_ASPECT_COLOR_BIT), 8u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_BC1_RGB_UNORM_BLOCK, { 5, 5, 1 }, VK_IMAGE_ASPECT_COLOR_BIT), 4u * 8u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_BC7_UNORM_BLOCK, { 1, 1, 1 }, VK_IMAGE_ASPECT_COLOR_BIT), 16u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_ASTC_10x5_UNORM_BLOCK, { 21, 11, 1 }, VK_IMAGE_ASPECT_COLOR_BIT), 3u * 3u * 16u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_G8B8G8R8_422_UNORM, { 5, 2, 1 }, VK_IMAGE_ASPECT_COLOR_BIT), 3u * 2u * 4u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM, { 16, 8, 1 }, VK_IMAGE_ASPECT_PLANE_0_BIT), 16u * 8u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM, { 16, 8, 1 }, VK_IMAGE_ASPECT_PLANE_1_BIT), 8u * 4u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_G8_B8R8_2PLANE_420_UNORM, { 16, 8, 1 }, VK_IMAGE_ASPECT_PLANE_1_BIT), 8u * 4u * 2u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_G8_B8R8_2PLANE_420_UNORM, { 16, 8, 1 }, VK_IMAGE_ASPECT_PLANE_2_BIT), 0u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_D16_UNORM_S8_UINT, { 8, 8, 1 }, VK_IMAGE_ASPECT_DEPTH_BIT), 8u * 8u * 2u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_D24_UNORM_S8_UINT, { 8, 8, 1 }, VK_IMAGE_ASPECT_DEPTH_BIT), 8u * 8u * 4u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_D32_SFLOAT_S8_UINT, { 8, 8, 1 }, VK_IMAGE_ASPECT_DEPTH_BIT), 8u * 8u * 4u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_D32_SFLOAT_S8_UINT, { 8, 8, 1 }, VK_IMAGE_ASPECT_STENCIL_BIT), 8u * 8u);
+    EXPECT_EQ(gvk::get_image_aspect_data_size(VK_FORMAT_UNDEFINED, { 8, 8, 1 }, VK_IMAGE_ASPECT_COLOR_BIT), 0u);
+}
+
+TEST(utilities, get_buffer_image_copies)
+{
+    auto imageCreateInfo = gvk::get_default<VkImageCreateInfo>();
+    imageCreateInfo.extent = { 37, 19, 1 };
+    imageCreateInfo.mipLevels = gvk::get_mip_level_count(imageCreateInfo.extent);
+    imageCreateInfo.arrayLayers = 3;
+    gvk::enumerate_formats(
+        [&](VkFormat format)
+        {
+            if (format == VK_FORMAT_UNDEFINED) {
+                return true;
+            }
+            const auto& formatInfo = gvk::get_format_info(format);
+            imageCreateInfo.format = format;
+            auto imageAspectFlags = gvk::get_image_aspect_flags(format);
+            auto imageSubresourceRange = gvk::get_default<VkImageSubresourceRange>();
+            imageSubresourceRange.aspectMask = imageAspectFlags;
+            imageSubresourceRange.baseMipLevel = 1;
+            imageSubresourceRange.levelCount = imageCreateInfo.mipLevels - 1;
+            imageSubresourceRange.baseArrayLayer = 1;
+            imageSubresourceRange.layerCount = 2;
+            VkDeviceSize size = 0;
+            auto bufferImageCopies = get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &size);
+
+            uint32_t aspectCount = 1 < formatInfo.planeCount ? formatInfo.planeCount : 0;
+            if (!aspectCount) {
+                aspectCount += imageAspectFlags & VK_IMAGE_ASPECT_COLOR_BIT ? 1 : 0;
+                aspectCount += imageAspectFlags & VK_IMAGE_ASPECT_DEPTH_BIT ? 1 : 0;
+                aspectCount += imageAspectFlags & VK_IMAGE_ASPECT_STENCIL_BIT ? 1 : 0;
+            }
+            EXPECT_EQ(bufferImageCopies.size(), aspectCount * imageSubresourceRange.levelCount * imageSubresourceRange.layerCount) << gvk::to_string(format);
+
+            VkDeviceSize bufferOffset = 0;
+            for (const auto& bufferImageCopy : bufferImageCopies) {
+                const auto& imageSubresource = bufferImageCopy.imageSubresource;
+                auto mipLevelExtent = gvk::get_mip_level_extent(imageCreateInfo.extent, imageSubresource.mipLevel);
+                auto imageAspectDataSize = gvk::get_image_aspect_data_size(format, mipLevelExtent, (VkImageAspectFlagBits)imageSubresource.aspectMask);
+                EXPECT_LE(bufferOffset, bufferImageCopy.bufferOffset) << gvk::to_string(format);
+                EXPECT_EQ(bufferImageCopy.bufferOffset % 4, 0u) << gvk::to_string(format);
+                EXPECT_EQ(bufferImageCopy.bufferRowLength, 0u) << gvk::to_string(format);
+                EXPECT_EQ(bufferImageCopy.bufferImageHeight, 0u) << gvk::to_string(format);
+                EXPECT_EQ(imageSubresource.layerCount, 1u) << gvk::to_string(format);
+                EXPECT_GT(imageAspectDataSize, 0u) << gvk::to_string(format);
+                switch (imageSubresource.aspectMask) {
+                case VK_IMAGE_ASPECT_COLOR_BIT: {
+                    EXPECT_EQ(formatInfo.planeCount, 0u) << gvk::to_string(format);
+                    EXPECT_EQ(bufferImageCopy.bufferOffset % formatInfo.blockSize, 0u) << gvk::to_string(format);
+                    EXPECT_EQ(bufferImageCopy.imageExtent.width, mipLevelExtent.width) << gvk::to_string(format);
+                    EXPECT_EQ(bufferImageCopy.imageExtent.height, mipLevelExtent.height) << gvk::to_string(format);
+                    if (formatInfo.blockExtent[0] == 1 && formatInfo.blockExtent[1] == 1 && formatInfo.blockExtent[2] == 1) {
+                        EXPECT_EQ(imageAspectDataSize, (VkDeviceSize)gvk::get_bytes_per_texel(format) * mipLevelExtent.width * mipLevelExtent.height) << gvk::to_string(format);
+                    }
+                } break;
+                case VK_IMAGE_ASPECT_DEPTH_BIT:
+                case VK_IMAGE_ASPECT_STENCIL_BIT: {
+                    EXPECT_EQ(bufferImageCopy.imageExtent.width, mipLevelExtent.width) << gvk::to_string(format);
+                    EXPECT_EQ(bufferImageCopy.imageExtent.height, mipLevelExtent.height) << gvk::to_string(format);
+                } break;
+                default: {
+                    EXPECT_LT(1u, formatInfo.planeCount) << gvk::to_string(format);
+                    uint32_t planeIndex = 0;
+                    while (!(imageSubresource.aspectMask & (VK_IMAGE_ASPECT_PLANE_0_BIT << planeIndex)) && planeIndex < formatInfo.planeCount) {
+                        ++planeIndex;
+                    }
+                    EXPECT_LT(planeIndex, formatInfo.planeCount) << gvk::to_string(format);
+                    if (planeIndex < formatInfo.planeCount) {
+                        const auto& plane = formatInfo.pPlanes[planeIndex];
+                        EXPECT_EQ(bufferImageCopy.bufferOffset % gvk::get_format_info(plane.compatible).blockSize, 0u) << gvk::to_string(format);
+                        EXPECT_EQ(bufferImageCopy.imageExtent.width, (mipLevelExtent.width + plane.widthDivisor - 1) / plane.widthDivisor) << gvk::to_string(format);
+                        EXPECT_EQ(bufferImageCopy.imageExtent.height, (mipLevelExtent.height + plane.heightDivisor - 1) / plane.heightDivisor) << gvk::to_string(format);
+                    }
+                }
+                }
+                bufferOffset = bufferImageCopy.bufferOffset + imageAspectDataSize;
+            }
+            EXPECT_EQ(size, bufferOffset) << gvk::to_string(format);
+            return true;
+        }
+    );
+}
@@ -35,6 +35,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -81,6 +82,13 @@ public:
     using LoaderVkPhysicalDevice = VkPhysicalDevice;
     std::unordered_map<ApplicationVkPhysicalDevice, LoaderVkPhysicalDevice> VkPhysicalDevices;
 
+    // NOTE : Entry points in interceptedEntryPoints are returned from the
+    //  get_*_proc_addr() functions in place of the gvk::layer hooks.  An
+    //  intercepted entry point bypasses every layer's pre_/post_ hooks and is
+    //  responsible for calling down the chain (or not) itself.  Populate this
+    //  from on_load() so it's in place before the loader queries entry points.
+    std::unordered_map<std::string, PFN_vkVoidFunction> interceptedEntryPoints;
+
 private:
     Registry() = default;
     Registry(const Registry&) = delete;
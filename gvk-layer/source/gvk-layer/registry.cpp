@@ -128,6 +128,7 @@ void destroy_instance(VkInstance instance, const VkAllocationCallbacks* pAllocat
         (*layerItr)->post_vkDestroyInstance(instance, pAllocator);
     }
     layers.clear();
+    Registry::get().interceptedEntryPoints.clear();
 }
 
 VkResult get_physical_device_infos(const DispatchTable& dispatchTable, VkInstance instance, std::map<VkPhysicalDeviceProperties, std::vector<VkPhysicalDevice>>& physicalDeviceInfos)
@@ -243,6 +244,14 @@ void destroy_device(VkDevice device, const VkAllocationCallbacks* pAllocator)
     }
 }
 
+PFN_vkVoidFunction get_hook(const char* pName)
+{
+    assert(pName);
+    const auto& interceptedEntryPoints = Registry::get().interceptedEntryPoints;
+    auto itr = interceptedEntryPoints.find(pName);
+    return itr != interceptedEntryPoints.end() ? itr->second : gvk::layer::hooks::get(pName);
+}
+
 PFN_vkVoidFunction get_instance_proc_addr(VkInstance, const char* pName)
 {
     assert(pName);
@@ -255,17 +264,17 @@ PFN_vkVoidFunction get_instance_proc_addr(VkInstance, const char* pName)
     } else if (!strcmp(pName, "vkDestroyDevice")) {
         return (PFN_vkVoidFunction)gvk::layer::destroy_device;
     }
-    return gvk::layer::hooks::get(pName);
+    return get_hook(pName);
 }
 
 PFN_vkVoidFunction get_physical_device_proc_addr(VkInstance, const char* pName)
 {
-    return gvk::layer::hooks::get(pName);
+    return get_hook(pName);
 }
 
 PFN_vkVoidFunction get_device_proc_addr(VkDevice, const char* pName)
 {
-    return gvk::layer::hooks::get(pName);
+    return get_hook(pName);
 }
 
 } // namespace layer
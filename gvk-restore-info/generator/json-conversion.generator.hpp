@@ -0,0 +1,115 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-cppgen.hpp"
+
+#include <vector>
+
+namespace gvk {
+namespace cppgen {
+
+class JsonConversionGenerator final
+{
+public:
+    static void generate(const xml::Manifest& manifest, const std::vector<xml::Structure>& restoreInfoStructures)
+    {
+        FileGenerator file(GVK_RESTORE_INFO_GENERATED_SOURCE_PATH "/restore-info-json-conversion.cpp");
+        file << std::endl;
+        file << "#include \"gvk-restore-info/json-conversion.hpp\"" << std::endl;
+        file << "#include \"gvk-command-structures.hpp\"" << std::endl;
+        file << "#include \"gvk-restore-info.hpp\"" << std::endl;
+        file << "#include \"gvk-structures.hpp\"" << std::endl;
+        file << std::endl;
+        file << "#include <istream>" << std::endl;
+        file << "#include <string>" << std::endl;
+        file << std::endl;
+        NamespaceGenerator namespaceGenerator(file, "gvk::restore_info::detail");
+        file << std::endl;
+        file << "template <typename ObjectType>" << std::endl;
+        file << "static void print_json(std::istream& istrm, PrinterBuffer& buffer, const JsonConversionInfo& conversionInfo)" << std::endl;
+        file << "{" << std::endl;
+        file << "    Auto<ObjectType> obj;" << std::endl;
+        file << "    deserialize(istrm, nullptr, obj);" << std::endl;
+        file << "    Printer printer(buffer, conversionInfo.printerFlags);" << std::endl;
+        file << "    printer.set_blob_options(conversionInfo.blobOptions);" << std::endl;
+        file << "    print(printer, *obj);" << std::endl;
+        file << "    buffer.put('\\n');" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "bool print_restore_info_json(const std::string& type, std::istream& istrm, PrinterBuffer& buffer, const JsonConversionInfo& conversionInfo)" << std::endl;
+        file << "{" << std::endl;
+        file << "    if (type == \"GvkRestorePointManifest\") {" << std::endl;
+        file << "        print_json<GvkRestorePointManifest>(istrm, buffer, conversionInfo);" << std::endl;
+        file << "        return true;" << std::endl;
+        file << "    }" << std::endl;
+        for (const auto& structure : restoreInfoStructures) {
+            // NOTE : Restore info structures are identified by their "handle" member,
+            //  the handle type names the directory the restore info is written to.
+            if (2 < structure.members.size() && structure.members[2].name == "handle") {
+                CompileGuardGenerator compileGuardGenerator(file, structure.compileGuards);
+                file << "    if (type == \"" << structure.members[2].type << "\") {" << std::endl;
+                file << "        print_json<" << structure.name << ">(istrm, buffer, conversionInfo);" << std::endl;
+                file << "        return true;" << std::endl;
+                file << "    }" << std::endl;
+            }
+        }
+        file << "    return false;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "bool print_cmds_json(std::istream& istrm, PrinterBuffer& buffer, const JsonConversionInfo& conversionInfo)" << std::endl;
+        file << "{" << std::endl;
+        file << "    while (istrm.peek() != std::char_traits<char>::eof()) {" << std::endl;
+        file << "        GvkCommandStructureType commandStructureType = GVK_COMMAND_STRUCTURE_TYPE_UNDEFINED;" << std::endl;
+        file << "        istrm.read((char*)&commandStructureType, sizeof(GvkCommandStructureType));" << std::endl;
+        file << "        switch (commandStructureType) {" << std::endl;
+        for (const auto& commandItr : manifest.commands) {
+            const auto& command = commandItr.second;
+            if (command.type == xml::Command::Type::Cmd || command.name == "vkBeginCommandBuffer" || command.name == "vkEndCommandBuffer") {
+                std::string structureType = "GVK_COMMAND_STRUCTURE_TYPE";
+                for (const auto& token : string::split_camel_case(string::strip_vk(command.name))) {
+                    structureType += "_" + string::to_upper(token);
+                }
+                CompileGuardGenerator compileGuardGenerator(file, command.compileGuards);
+                file << "        case " << structureType << ": {" << std::endl;
+                file << "            print_json<GvkCommandStructure" << string::strip_vk(command.name) << ">(istrm, buffer, conversionInfo);" << std::endl;
+                file << "        } break;" << std::endl;
+            }
+        }
+        file << "        default: {" << std::endl;
+        file << "            return false;" << std::endl;
+        file << "        } break;" << std::endl;
+        file << "        }" << std::endl;
+        file << "    }" << std::endl;
+        file << "    return true;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+    }
+};
+
+} // namespace cppgen
+} // namespace gvk
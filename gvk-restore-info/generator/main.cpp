@@ -27,6 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-cppgen.hpp"
 #include "gvk-string.hpp"
 #include "gvk-xml.hpp"
+#include "json-conversion.generator.hpp"
 
 std::vector<gvk::xml::Structure> get_restore_info_structures(const gvk::xml::Manifest& manifest)
 {
@@ -251,10 +252,8 @@ gvk::xml::Enumeration get_restore_point_object_status_bits_enumeration()
 
 int main(int, const char*[])
 {
-    tinyxml2::XMLDocument xmlDocument;
-    auto xmlResult = xmlDocument.LoadFile(GVK_XML_FILE_PATH);
-    if (xmlResult == tinyxml2::XML_SUCCESS) {
-        gvk::xml::Manifest manifest(xmlDocument);
+    gvk::xml::Manifest manifest;
+    if (gvk::xml::load_manifest(GVK_XML_FILE_PATH, GVK_XML_MANIFEST_CACHE_DIRECTORY, manifest)) {
         gvk::cppgen::ApiElementCollectionInfo apiElements { };
         apiElements.name = "restore-info";
         apiElements.headerGuard = "gvk_restore_info_h";
@@ -270,19 +269,23 @@ int main(int, const char*[])
         apiElements.sourceIncludes = {
             "gvk-structures.hpp",
         };
-        gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(apiElements);
-        gvk::cppgen::EnumerationToStringGenerator::generate(apiElements);
-        gvk::cppgen::StructureCerealizationGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
-        gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDeserializationGenerator::generate(apiElements);
-        gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements);
-        gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureSerializationGenerator::generate(apiElements);
-        apiElements.manuallyImplemented.insert("GvkRestorePointObject");
-        gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements);
+        gvk::cppgen::ParallelGenerator generators;
+        generators.add([&]() { gvk::cppgen::ApiElementCollectionDeclarationGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::EnumerationToStringGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureCerealizationGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDeserializationGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureSerializationGenerator::generate(apiElements); });
+        auto toStringApiElements = apiElements;
+        toStringApiElements.manuallyImplemented.insert("GvkRestorePointObject");
+        generators.add([&]() { gvk::cppgen::StructureToStringGenerator::generate(manifest, toStringApiElements); });
+        generators.add([&]() { gvk::cppgen::JsonConversionGenerator::generate(manifest, apiElements.structures); });
+        generators.wait();
     }
     return 0;
 }
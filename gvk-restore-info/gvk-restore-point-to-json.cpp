@@ -0,0 +1,92 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-restore-info/json-conversion.hpp"
+#include "gvk-string.hpp"
+#include "gvk-structures.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+using CmdLine = std::map<std::string, std::string>;
+static CmdLine get_cmd_line(int argc, const char* ppArgv[], CmdLine cmdLine = { })
+{
+    for (int i = 0; i < argc; ++i) {
+        auto itr = cmdLine.insert({ ppArgv[i], { } }).first;
+        if (gvk::string::starts_with(itr->first, "-")) {
+            if (i < argc - 1) {
+                itr->second = ppArgv[i + 1];
+                ++i;
+            }
+        }
+    }
+    return cmdLine;
+}
+
+int main(int argc, const char* ppArgv[])
+{
+    auto cmdLine = get_cmd_line(argc, ppArgv);
+    if (!cmdLine.count("-p") || cmdLine.count("-h")) {
+        std::cout << "-h : Output this help text" << std::endl;
+        std::cout << "-p : Path to the restore point to convert; required" << std::endl;
+        std::cout << "-o : Path to write json files to; if not provided json files are written next to their binary files" << std::endl;
+        std::cout << "-t : Comma separated list of handle types to convert, ie. VkBuffer,VkCommandBuffer; if not provided all types are converted" << std::endl;
+        std::cout << "-H : Comma separated list of captured handle values to convert, ie. 0x1a2b,0x3c4d; if not provided all objects are converted" << std::endl;
+        std::cout << "-j : Number of worker threads to use; if not provided std::thread::hardware_concurrency() is used" << std::endl;
+        std::cout << "-b : Path to write blob files to; if provided trivially copyable arrays are written to files named by the hash of their contents instead of being written inline as base64" << std::endl;
+        return 0;
+    }
+    gvk::restore_info::JsonConversionInfo conversionInfo { };
+    conversionInfo.path = cmdLine["-p"];
+    if (cmdLine.count("-o")) {
+        conversionInfo.outputPath = cmdLine["-o"];
+    }
+    if (cmdLine.count("-t")) {
+        for (const auto& type : gvk::string::split(cmdLine["-t"], ",")) {
+            conversionInfo.types.insert(type);
+        }
+    }
+    if (cmdLine.count("-H")) {
+        for (const auto& handle : gvk::string::split(cmdLine["-H"], ",")) {
+            conversionInfo.handles.insert((uint64_t)std::strtoull(handle.c_str(), nullptr, 0));
+        }
+    }
+    if (cmdLine.count("-j")) {
+        conversionInfo.threadCount = (uint32_t)std::strtoul(cmdLine["-j"].c_str(), nullptr, 0);
+    }
+    if (cmdLine.count("-b")) {
+        conversionInfo.printerFlags |= gvk::Printer::BlobFile;
+        conversionInfo.blobOptions.directory = cmdLine["-b"];
+    }
+    auto vkResult = gvk::restore_info::convert_to_json(conversionInfo);
+    if (vkResult != VK_SUCCESS) {
+        std::cerr << "Failed to convert one or more files in " << conversionInfo.path.string() << " : " << gvk::to_string(vkResult) << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -35,3 +35,4 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-info/generated/restore-info-structure-get-stype.hpp"
 #include "gvk-restore-info/generated/restore-info-structure-serialization.hpp"
 #include "gvk-restore-info/generated/restore-info-structure-to-string.hpp"
+#include "gvk-restore-info/json-conversion.hpp"
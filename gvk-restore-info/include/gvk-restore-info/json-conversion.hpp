@@ -0,0 +1,127 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-string/printer.hpp"
+
+#include <filesystem>
+#include <istream>
+#include <set>
+#include <string>
+
+namespace gvk {
+namespace restore_info {
+
+/**
+Parameters for converting binary restore point files to json
+*/
+class JsonConversionInfo final
+{
+public:
+    /**
+    The directory of the restore point to convert
+    */
+    std::filesystem::path path;
+
+    /**
+    The directory to write json files to
+        @note If empty, json files are written next to their binary counterparts
+    */
+    std::filesystem::path outputPath;
+
+    /**
+    The handle types to convert, ie. "VkBuffer", "VkCommandBuffer", etc.
+        @note If empty, all handle types are converted
+        @note "GvkRestorePointManifest" selects the restore point manifest
+    */
+    std::set<std::string> types;
+
+    /**
+    The captured handle values of the objects to convert
+        @note If empty, all objects are converted
+    */
+    std::set<uint64_t> handles;
+
+    /**
+    The number of worker threads to convert files with
+        @note If 0, std::thread::hardware_concurrency() is used
+    */
+    uint32_t threadCount{ };
+
+    /**
+    The default Printer::Flags to write restore point json with
+        @note Shared with the restore point layer so json written during capture matches json converted offline
+    */
+    static constexpr Printer::Flags DefaultPrinterFlags{ (Printer::Default & ~(Printer::EnumValue | Printer::FlushOnNewline)) | Printer::BlobBase64 };
+
+    /**
+    The Printer::Flags to write json with
+    */
+    Printer::Flags printerFlags{ DefaultPrinterFlags };
+
+    /**
+    The Printer::BlobOptions to write json with
+        @note If Printer::BlobFile is set in printerFlags and BlobOptions::directory is empty, blob files are written to a "blobs" directory in the output directory
+    */
+    Printer::BlobOptions blobOptions;
+};
+
+/**
+Converts the binary files of a restore point to json
+    @note Restore info (.info) files are converted to .json files and command buffer command (.cmds) files are converted to .cmds.json files
+    @note Each file is converted on a worker thread that streams from the binary file to the json file, so memory use is bounded by the largest single object rather than the size of the restore point
+    @note Files that fail to convert are skipped, remaining files are still converted
+@param [in] conversionInfo The JsonConversionInfo to use
+@return VK_SUCCESS if every file was converted, VK_ERROR_INITIALIZATION_FAILED otherwise
+*/
+VkResult convert_to_json(const JsonConversionInfo& conversionInfo);
+
+namespace detail {
+
+/**
+Reads a restore info of a given type from a std::istream and writes it to a PrinterBuffer as json
+@param [in] type The handle type of the restore info, ie. "VkBuffer", or "GvkRestorePointManifest"
+@param [in] istrm The std::istream to read the restore info from
+@param [in] buffer The PrinterBuffer to write json to
+@param [in] conversionInfo The JsonConversionInfo to use
+@return Whether or not the given type was recognized
+*/
+bool print_restore_info_json(const std::string& type, std::istream& istrm, PrinterBuffer& buffer, const JsonConversionInfo& conversionInfo);
+
+/**
+Reads command structures from a std::istream until exhausted and writes each to a PrinterBuffer as json
+@param [in] istrm The std::istream to read command structures from
+@param [in] buffer The PrinterBuffer to write json to
+@param [in] conversionInfo The JsonConversionInfo to use
+@return Whether or not every command structure was recognized
+*/
+bool print_cmds_json(std::istream& istrm, PrinterBuffer& buffer, const JsonConversionInfo& conversionInfo);
+
+} // namespace detail
+} // namespace restore_info
+} // namespace gvk
@@ -0,0 +1,145 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-restore-info/json-conversion.hpp"
+#include "gvk-string.hpp"
+
+#include "asio.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace gvk {
+namespace restore_info {
+
+class JsonConversionItem final
+{
+public:
+    std::string type;
+    std::filesystem::path inputPath;
+    std::filesystem::path outputPath;
+    bool cmds{ };
+};
+
+static std::vector<JsonConversionItem> get_json_conversion_items(const JsonConversionInfo& conversionInfo)
+{
+    // NOTE : Directories and files that can't be read are skipped rather than
+    //  throwing, unreadable entries are treated the same as missing entries.
+    std::vector<JsonConversionItem> items;
+    std::error_code errorCode;
+    const auto& outputPath = !conversionInfo.outputPath.empty() ? conversionInfo.outputPath : conversionInfo.path;
+    auto manifestPath = conversionInfo.path / "GvkRestorePointManifest.info";
+    if (std::filesystem::exists(manifestPath, errorCode) && (conversionInfo.types.empty() || conversionInfo.types.count("GvkRestorePointManifest"))) {
+        items.push_back({ "GvkRestorePointManifest", manifestPath, outputPath / "GvkRestorePointManifest.json" });
+    }
+    for (std::filesystem::directory_iterator directoryItr(conversionInfo.path, errorCode), directoryEnd; !errorCode && directoryItr != directoryEnd; directoryItr.increment(errorCode)) {
+        const auto& directoryEntry = *directoryItr;
+        auto type = directoryEntry.path().filename().string();
+        std::error_code fileErrorCode;
+        if (directoryEntry.is_directory(fileErrorCode) && (conversionInfo.types.empty() || conversionInfo.types.count(type))) {
+            for (std::filesystem::directory_iterator fileItr(directoryEntry.path(), fileErrorCode), fileEnd; !fileErrorCode && fileItr != fileEnd; fileItr.increment(fileErrorCode)) {
+                const auto& fileEntry = *fileItr;
+                const auto& filePath = fileEntry.path();
+                auto extension = filePath.extension().string();
+                std::error_code regularFileErrorCode;
+                if (fileEntry.is_regular_file(regularFileErrorCode) && (extension == ".info" || extension == ".cmds")) {
+                    auto name = filePath.stem().string();
+                    auto handle = (uint64_t)std::strtoull(name.c_str(), nullptr, 0);
+                    if (conversionInfo.handles.empty() || conversionInfo.handles.count(handle)) {
+                        JsonConversionItem item { };
+                        item.type = type;
+                        item.inputPath = filePath;
+                        item.cmds = extension == ".cmds";
+                        item.outputPath = outputPath / type / (name + (item.cmds ? ".cmds.json" : ".json"));
+                        items.push_back(item);
+                    }
+                }
+            }
+        }
+    }
+    return items;
+}
+
+static VkResult convert_item_to_json(const JsonConversionItem& item, const JsonConversionInfo& conversionInfo)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        std::ifstream inputFile(item.inputPath, std::ios::binary);
+        gvk_result(inputFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        std::error_code errorCode;
+        std::filesystem::create_directories(item.outputPath.parent_path(), errorCode);
+        std::ofstream outputFile(item.outputPath);
+        gvk_result(outputFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        // NOTE : cereal reports malformed archives by throwing, a file that fails to
+        //  convert shouldn't prevent the remaining files from being converted.
+        try {
+            PrinterBuffer buffer(outputFile);
+            auto converted = item.cmds ?
+                detail::print_cmds_json(inputFile, buffer, conversionInfo) :
+                detail::print_restore_info_json(item.type, inputFile, buffer, conversionInfo);
+            gvkResult = converted ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED;
+        } catch (const std::exception&) {
+            gvkResult = VK_ERROR_INITIALIZATION_FAILED;
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult convert_to_json(const JsonConversionInfo& conversionInfo)
+{
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        std::error_code errorCode;
+        gvk_result(std::filesystem::is_directory(conversionInfo.path, errorCode) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        auto effectiveConversionInfo = conversionInfo;
+        if ((effectiveConversionInfo.printerFlags & Printer::BlobFile) && effectiveConversionInfo.blobOptions.directory.empty()) {
+            const auto& outputPath = !conversionInfo.outputPath.empty() ? conversionInfo.outputPath : conversionInfo.path;
+            effectiveConversionInfo.blobOptions.directory = (outputPath / "blobs").string();
+        }
+        auto items = get_json_conversion_items(effectiveConversionInfo);
+        std::atomic<uint32_t> failureCount { };
+        auto threadCount = effectiveConversionInfo.threadCount ? effectiveConversionInfo.threadCount : std::thread::hardware_concurrency();
+        if (threadCount <= 1) {
+            for (const auto& item : items) {
+                failureCount += convert_item_to_json(item, effectiveConversionInfo) == VK_SUCCESS ? 0 : 1;
+            }
+        } else {
+            asio::thread_pool threadPool(threadCount);
+            for (const auto& item : items) {
+                asio::post(threadPool, [&, item]() { failureCount += convert_item_to_json(item, effectiveConversionInfo) == VK_SUCCESS ? 0 : 1; });
+            }
+            threadPool.join();
+        }
+        gvk_result(!failureCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+} // namespace restore_info
+} // namespace gvk
@@ -0,0 +1,177 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+
+#include "gvk-restore-info.hpp"
+#include "gvk-command-structures.hpp"
+#include "gvk-structures.hpp"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static std::string read_file(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::stringstream strStrm;
+    strStrm << file.rdbuf();
+    return strStrm.str();
+}
+
+class JsonConversionObjects final
+{
+public:
+    JsonConversionObjects()
+    {
+        restorePointObjects[0] = { VK_OBJECT_TYPE_SEMAPHORE, 0x1a, 0x2b };
+        restorePointObjects[1] = { VK_OBJECT_TYPE_COMMAND_BUFFER, 0x3c, 0x2b };
+        manifest.objectCount = (uint32_t)restorePointObjects.size();
+        manifest.pObjects = restorePointObjects.data();
+
+        semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreRestoreInfo.sType = GVK_STRUCTURE_TYPE_SEMAPHORE_RESTORE_INFO;
+        semaphoreRestoreInfo.handle = (VkSemaphore)restorePointObjects[0].handle;
+        semaphoreRestoreInfo.pName = "semaphore";
+        semaphoreRestoreInfo.pSemaphoreCreateInfo = &semaphoreCreateInfo;
+        semaphoreRestoreInfo.value = 7;
+
+        viewports[0] = { 0, 0, 1280, 720, 0, 1 };
+        viewports[1] = { 0, 0, 1920, 1080, 0, 1 };
+        for (size_t i = 0; i < setViewportCmds.size(); ++i) {
+            setViewportCmds[i].sType = GVK_COMMAND_STRUCTURE_TYPE_CMD_SET_VIEWPORT;
+            setViewportCmds[i].commandBuffer = (VkCommandBuffer)restorePointObjects[1].handle;
+            setViewportCmds[i].firstViewport = 0;
+            setViewportCmds[i].viewportCount = (uint32_t)(i + 1);
+            setViewportCmds[i].pViewports = viewports.data();
+        }
+    }
+
+    void write_cmds(std::ostream& ostrm) const
+    {
+        for (const auto& setViewportCmd : setViewportCmds) {
+            ostrm.write((const char*)&setViewportCmd.sType, sizeof(GvkCommandStructureType));
+            gvk::serialize(ostrm, setViewportCmd);
+        }
+    }
+
+    std::string get_cmds_json(gvk::Printer::Flags printerFlags) const
+    {
+        std::string json;
+        for (const auto& setViewportCmd : setViewportCmds) {
+            json += gvk::to_string(setViewportCmd, printerFlags) + "\n";
+        }
+        return json;
+    }
+
+    std::array<GvkRestorePointObject, 2> restorePointObjects { };
+    GvkRestorePointManifest manifest { };
+    VkSemaphoreCreateInfo semaphoreCreateInfo { };
+    GvkSemaphoreRestoreInfo semaphoreRestoreInfo { };
+    std::array<VkViewport, 2> viewports { };
+    std::array<GvkCommandStructureCmdSetViewport, 2> setViewportCmds { };
+};
+
+TEST(JsonConversion, print_restore_info_json)
+{
+    JsonConversionObjects objects;
+    gvk::restore_info::JsonConversionInfo conversionInfo { };
+    std::stringstream strStrm;
+    gvk::serialize(strStrm, objects.manifest);
+    gvk::serialize(strStrm, objects.semaphoreRestoreInfo);
+    gvk::PrinterBuffer buffer;
+    EXPECT_TRUE(gvk::restore_info::detail::print_restore_info_json("GvkRestorePointManifest", strStrm, buffer, conversionInfo));
+    EXPECT_TRUE(gvk::restore_info::detail::print_restore_info_json("VkSemaphore", strStrm, buffer, conversionInfo));
+    auto expected =
+        gvk::to_string(objects.manifest, conversionInfo.printerFlags) + "\n" +
+        gvk::to_string(objects.semaphoreRestoreInfo, conversionInfo.printerFlags) + "\n";
+    EXPECT_EQ(buffer.get_string(), expected);
+    EXPECT_FALSE(gvk::restore_info::detail::print_restore_info_json("VkUnrecognized", strStrm, buffer, conversionInfo));
+}
+
+TEST(JsonConversion, print_cmds_json)
+{
+    JsonConversionObjects objects;
+    gvk::restore_info::JsonConversionInfo conversionInfo { };
+    conversionInfo.printerFlags = gvk::Printer::EnumIdentifier;
+    std::stringstream strStrm;
+    objects.write_cmds(strStrm);
+    gvk::PrinterBuffer buffer;
+    EXPECT_TRUE(gvk::restore_info::detail::print_cmds_json(strStrm, buffer, conversionInfo));
+    EXPECT_EQ(buffer.get_string(), objects.get_cmds_json(conversionInfo.printerFlags));
+
+    std::stringstream unrecognizedStrStrm;
+    auto commandStructureType = GVK_COMMAND_STRUCTURE_TYPE_UNDEFINED;
+    unrecognizedStrStrm.write((const char*)&commandStructureType, sizeof(GvkCommandStructureType));
+    EXPECT_FALSE(gvk::restore_info::detail::print_cmds_json(unrecognizedStrStrm, buffer, conversionInfo));
+}
+
+TEST(JsonConversion, convert_to_json)
+{
+    JsonConversionObjects objects;
+    auto path = std::filesystem::temp_directory_path() / "gvk-restore-info.tests.convert_to_json";
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path / "VkSemaphore");
+    std::filesystem::create_directories(path / "VkCommandBuffer");
+    {
+        std::ofstream manifestFile(path / "GvkRestorePointManifest.info", std::ios::binary);
+        gvk::serialize(manifestFile, objects.manifest);
+        std::ofstream semaphoreFile(path / "VkSemaphore" / (gvk::to_hex_string(objects.restorePointObjects[0].handle) + ".info"), std::ios::binary);
+        gvk::serialize(semaphoreFile, objects.semaphoreRestoreInfo);
+        std::ofstream cmdsFile(path / "VkCommandBuffer" / (gvk::to_hex_string(objects.restorePointObjects[1].handle) + ".cmds"), std::ios::binary);
+        objects.write_cmds(cmdsFile);
+    }
+
+    gvk::restore_info::JsonConversionInfo conversionInfo { };
+    conversionInfo.path = path;
+    conversionInfo.outputPath = path / "json";
+    conversionInfo.threadCount = 2;
+    ASSERT_EQ(gvk::restore_info::convert_to_json(conversionInfo), VK_SUCCESS);
+    const auto& printerFlags = conversionInfo.printerFlags;
+    EXPECT_EQ(read_file(conversionInfo.outputPath / "GvkRestorePointManifest.json"), gvk::to_string(objects.manifest, printerFlags) + "\n");
+    EXPECT_EQ(read_file(conversionInfo.outputPath / "VkSemaphore" / (gvk::to_hex_string(objects.restorePointObjects[0].handle) + ".json")), gvk::to_string(objects.semaphoreRestoreInfo, printerFlags) + "\n");
+    EXPECT_EQ(read_file(conversionInfo.outputPath / "VkCommandBuffer" / (gvk::to_hex_string(objects.restorePointObjects[1].handle) + ".cmds.json")), objects.get_cmds_json(printerFlags));
+
+    // NOTE : Selecting by handle should only convert the selected object, and a
+    //  malformed file should fail its conversion without preventing the others.
+    std::filesystem::remove_all(conversionInfo.outputPath);
+    conversionInfo.handles = { objects.restorePointObjects[0].handle };
+    ASSERT_EQ(gvk::restore_info::convert_to_json(conversionInfo), VK_SUCCESS);
+    EXPECT_TRUE(std::filesystem::exists(conversionInfo.outputPath / "VkSemaphore" / (gvk::to_hex_string(objects.restorePointObjects[0].handle) + ".json")));
+    EXPECT_FALSE(std::filesystem::exists(conversionInfo.outputPath / "VkCommandBuffer"));
+    {
+        std::ofstream malformedFile(path / "VkSemaphore" / "0x5e.info", std::ios::binary);
+        malformedFile << "malformed";
+    }
+    conversionInfo.handles.clear();
+    conversionInfo.types = { "VkSemaphore" };
+    EXPECT_EQ(gvk::restore_info::convert_to_json(conversionInfo), VK_ERROR_INITIALIZATION_FAILED);
+    EXPECT_EQ(read_file(conversionInfo.outputPath / "VkSemaphore" / (gvk::to_hex_string(objects.restorePointObjects[0].handle) + ".json")), gvk::to_string(objects.semaphoreRestoreInfo, printerFlags) + "\n");
+    std::filesystem::remove_all(path);
+}
@@ -58,7 +58,7 @@ public:
         file << "            std::ifstream cmdsFile(cmdsPath, std::ios::binary);" << std::endl;
         file << "            gvk_result(cmdsFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);" << std::endl;
         file << "            Auto<GvkCommandBufferRestoreInfo> restoreInfo;" << std::endl;
-        file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"VkCommandBuffer\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+        file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"VkCommandBuffer\", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));" << std::endl;
         file << "            auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);" << std::endl;
         file << "            while (!cmdsFile.eof()) {" << std::endl;
         file << "                GvkCommandStructureType commandStructureType = GVK_COMMAND_STRUCTURE_TYPE_UNDEFINED;" << std::endl;
@@ -76,9 +76,9 @@ public:
                 file << "                    Auto<GvkCommandStructure" << string::strip_vk(command.name) << "> commandStructure;" << std::endl;
                 file << "                    deserialize(cmdsFile, nullptr, commandStructure);" << std::endl;
                 file << "                    auto commandBuffer = (VkCommandBuffer)get_restored_object(restorePointObject).handle;" << std::endl;
-                file << "                    const_cast<GvkCommandStructure" << string::strip_vk(command.name) << "&>(*commandStructure).commandBuffer = VK_NULL_HANDLE;" << std::endl;
+                file << "                    commandStructure.detach().commandBuffer = VK_NULL_HANDLE;" << std::endl;
                 file << "                    update_command_structure_handles(mRestorePointObjects, (uint64_t)device, *commandStructure);" << std::endl;
-                file << "                    const_cast<GvkCommandStructure" << string::strip_vk(command.name) << "&>(*commandStructure).commandBuffer = commandBuffer;" << std::endl;
+                file << "                    commandStructure.detach().commandBuffer = commandBuffer;" << std::endl;
                 file << "                    detail::execute_command_structure(mApplyInfo.dispatchTable, commandStructure);" << std::endl;
                 file << "                } break;" << std::endl;
             }
@@ -190,7 +190,7 @@ private:
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << "        case " << handle.vkObjectType << ": {" << std::endl;
                 file << "            Auto<" << get_restore_info_type_name(handle.name) << "> restoreInfo;" << std::endl;
-                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));" << std::endl;
                 file << "            gvk_result(restore_dependencies(restoreInfo->dependencyCount, restoreInfo->pDependencies));" << std::endl;
                 file << "            gvk_result(restore_" << handle.name << "(restorePointObject, *restoreInfo));" << std::endl;
                 file << "        } break;" << std::endl;
@@ -214,7 +214,7 @@ private:
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << "        case " << handle.vkObjectType << ": {" << std::endl;
                 file << "            Auto<" << get_restore_info_type_name(handle.name) << "> restoreInfo;" << std::endl;
-                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));" << std::endl;
                 file << "            gvk_result(restore_dependencies_state(restoreInfo->dependencyCount, restoreInfo->pDependencies));" << std::endl;
                 file << "            gvk_result(restore_" << handle.name << "_state(restorePointObject, *restoreInfo));" << std::endl;
                 file << "        } break;" << std::endl;
@@ -238,7 +238,7 @@ private:
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << "        case " << handle.vkObjectType << ": {" << std::endl;
                 file << "            Auto<" << get_restore_info_type_name(handle.name) << "> restoreInfo;" << std::endl;
-                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+                file << "            gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));" << std::endl;
                 file << "            gvk_result(restore_object_name(restorePointObject, restoreInfo->dependencyCount, restoreInfo->pDependencies, restoreInfo->pName));" << std::endl;
                 file << "        } break;" << std::endl;
             }
@@ -262,7 +262,7 @@ private:
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << "            case " << handle.vkObjectType << ": {" << std::endl;
                 file << "                Auto<" << get_restore_info_type_name(handle.name) << "> restoreInfo;" << std::endl;
-                file << "                gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo));" << std::endl;
+                file << "                gvk_result(read_object_restore_info(mApplyInfo.path, \"" << handle.name << "\", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));" << std::endl;
                 file << "                gvk_result(process_dependencies(restoreInfo->dependencyCount, restoreInfo->pDependencies));" << std::endl;
                 file << "                gvk_result(process_" << handle.name << "(restorePointObject, *restoreInfo));" << std::endl;
                 file << "            } break;" << std::endl;
@@ -84,7 +84,7 @@ public:
                 file << "            serialize(userData.cmdsFile, *(const GvkCommandStructure" << gvk::string::strip_vk(command.name) << "*)pInfo);" << std::endl;
                 file << "        }" << std::endl;
                 file << "        if (userData.pCreateInfo->flags & GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BIT) {" << std::endl;
-                file << "            userData.jsonFile << to_string(*(const GvkCommandStructure" << gvk::string::strip_vk(command.name) << "*)pInfo, gvk::Printer::Default & ~gvk::Printer::EnumValue) << std::endl;" << std::endl;
+                file << "            write_object_json(userData.jsonFile, *userData.pCreateInfo, *(const GvkCommandStructure" << gvk::string::strip_vk(command.name) << "*)pInfo);" << std::endl;
                 file << "        }" << std::endl;
                 file << "    } break;" << std::endl;
             }
@@ -36,16 +36,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 int main(int, const char* [])
 {
-    tinyxml2::XMLDocument xmlDocument;
-    auto xmlResult = xmlDocument.LoadFile(GVK_XML_FILE_PATH);
-    if (xmlResult == tinyxml2::XML_SUCCESS) {
-        gvk::xml::Manifest manifest(xmlDocument);
-        gvk::cppgen::ApplierProcessCommandBufferGenerator::generate(manifest);
-        gvk::cppgen::BasicApplierGenerator::generate(manifest);
-        gvk::cppgen::BasicCreatorGenerator::generate(manifest);
-        gvk::cppgen::BasicLayerGenerator::generate(manifest);
-        gvk::cppgen::CreatorProcessCommandBufferGenerator::generate(manifest);
-        gvk::cppgen::UpdateStructureHandlesGenerator::generate(manifest);
+    gvk::xml::Manifest manifest;
+    if (gvk::xml::load_manifest(GVK_XML_FILE_PATH, GVK_XML_MANIFEST_CACHE_DIRECTORY, manifest)) {
+        gvk::cppgen::ParallelGenerator generators;
+        generators.add([&]() { gvk::cppgen::ApplierProcessCommandBufferGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::BasicApplierGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::BasicCreatorGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::BasicLayerGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::CreatorProcessCommandBufferGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::UpdateStructureHandlesGenerator::generate(manifest); });
+        generators.wait();
     }
     return 0;
 }
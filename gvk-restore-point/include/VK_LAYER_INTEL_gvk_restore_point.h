@@ -52,6 +52,7 @@ typedef enum GvkRestorePointCreateFlagBits {
     GVK_RESTORE_POINT_CREATE_BUFFER_DATA_BIT = 0x00000010,
     GVK_RESTORE_POINT_CREATE_IMAGE_DATA_BIT = 0x00000020,
     GVK_RESTORE_POINT_CREATE_IMAGE_PNG_BIT = 0x00000040,
+    GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BLOB_FILES_BIT = 0x00000080,
     GVK_RESTORE_POINT_CREATE_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
 } GvkRestorePointCreateFlagBits;
 typedef VkFlags GvkRestorePointCreateFlags;
@@ -59,6 +60,7 @@ typedef VkFlags GvkRestorePointCreateFlags;
 typedef enum GvkRestorePointApplyFlagBits {
     GVK_RESTORE_POINT_APPLY_FORCE_FULL_RESTORATION = 0x00000001,
     GVK_RESTORE_POINT_APPLY_FLATTEN_COMMAND_BUFFERS_BIT = 0x00000002,
+    GVK_RESTORE_POINT_APPLY_MAPPED_OBJECT_INFO_BIT = 0x00000004,
     GVK_RESTORE_POINT_APPLY_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
 } GvkRestorePointApplyFlagBits;
 typedef VkFlags GvkRestorePointApplyFlags;
@@ -244,8 +244,8 @@ private:
     CopyEngine& operator=(const CopyEngine&) = delete;
 };
 
-uint32_t get_image_data_size(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange);
-uint32_t get_image_data_size(VkFormat format, const VkExtent3D& extent, const VkImageSubresourceRange& imageSubresourceRange);
+VkDeviceSize get_image_data_size(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange);
+VkDeviceSize get_image_data_size(VkFormat format, const VkExtent3D& extent, const VkImageSubresourceRange& imageSubresourceRange);
 
 } // namespace restore_point
 } // namespace gvk
@@ -31,11 +31,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-restore-info.hpp"
 #include "gvk-runtime.hpp"
 #include "gvk-structures.hpp"
+#include "gvk-structures/detail/mapped-binary-input-archive.hpp"
 #include "VK_LAYER_INTEL_gvk_restore_point.h"
 
 #include <filesystem>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <set>
 
 namespace gvk {
@@ -137,6 +139,27 @@ inline ObjectType get_dependency(uint32_t dependencyCount, const GvkRestorePoint
     return (ObjectType)get_restore_point_object_dependency<ObjectType>(dependencyCount, pDependencies).handle;
 }
 
+// NOTE : Trivially copyable arrays (SPIR-V, pipeline cache data, push constants,
+//  etc.) are printed as base64 blobs, or when
+//  GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BLOB_FILES_BIT is set, written to files in
+//  the restore point's "blobs" directory named by the hash of their contents.
+template <typename ObjectType>
+inline void write_object_json(std::ostream& ostrm, const CreateInfo& restorePointCreateInfo, const ObjectType& obj)
+{
+    Printer::Flags printerFlags = restore_info::JsonConversionInfo::DefaultPrinterFlags;
+    Printer::BlobOptions blobOptions { };
+    if (restorePointCreateInfo.flags & GVK_RESTORE_POINT_CREATE_OBJECT_JSON_BLOB_FILES_BIT) {
+        printerFlags |= Printer::BlobFile;
+        blobOptions.directory = (restorePointCreateInfo.path / "blobs").string();
+    }
+    {
+        Printer printer(ostrm, printerFlags);
+        printer.set_blob_options(blobOptions);
+        print(printer, obj);
+    }
+    ostrm << std::endl;
+}
+
 template <typename RestoreInfoType>
 inline VkResult write_object_restore_info(const CreateInfo& restorePointCreateInfo, const std::string& type, const std::string& name, const RestoreInfoType& objectRestoreInfo)
 {
@@ -153,39 +176,63 @@ inline VkResult write_object_restore_info(const CreateInfo& restorePointCreateIn
             auto jsonPath = (path / name).replace_extension("json");
             std::ofstream jsonFile(jsonPath);
             gvk_result(jsonFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-            auto printerFlags = gvk::Printer::Default & ~gvk::Printer::EnumValue;
-            jsonFile << to_string(objectRestoreInfo, printerFlags) << std::endl;
+            write_object_json(jsonFile, restorePointCreateInfo, objectRestoreInfo);
         }
     } gvk_result_scope_end;
     return gvkResult;
 }
 
+// NOTE : MappedFile provides a copy on write mapping of a file, writes to the
+//  mapped memory are never written back to the file.
+class MappedFile final
+{
+public:
+    static std::shared_ptr<MappedFile> create(const std::filesystem::path& path);
+    ~MappedFile();
+    uint8_t* get_data() const;
+    size_t get_size() const;
+
+private:
+    MappedFile() = default;
+    uint8_t* mpData { nullptr };
+    size_t mSize { 0 };
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE mFile { INVALID_HANDLE_VALUE };
+    HANDLE mFileMapping { nullptr };
+#endif
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+// NOTE : When GVK_RESTORE_POINT_APPLY_MAPPED_OBJECT_INFO_BIT is set, info files
+//  are memory mapped and trivially copyable arrays (SPIR-V, initial data, etc.)
+//  alias the mapping instead of being copied.  Only the structures and arrays
+//  that contain pointers are decerealized, into a single arena per restore info.
 template <typename RestoreInfoType>
-inline VkResult read_object_restore_info(const std::filesystem::path& path, const std::string& type, const std::string& name, Auto<RestoreInfoType>& restoreInfo)
+inline VkResult read_object_restore_info(const std::filesystem::path& path, const std::string& type, const std::string& name, Auto<RestoreInfoType>& restoreInfo, GvkRestorePointApplyFlags flags = 0)
 {
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         auto infoPath = (path / type / name).replace_extension("info");
-        std::ifstream infoFile(infoPath, std::ios::binary);
-        gvk_result(infoFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-        deserialize(infoFile, nullptr, restoreInfo);
+        if (flags & GVK_RESTORE_POINT_APPLY_MAPPED_OBJECT_INFO_BIT) {
+            auto spInfoFile = MappedFile::create(infoPath);
+            gvk_result(spInfoFile ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            detail::MappedBinaryInputArchive archive(spInfoFile->get_data(), spInfoFile->get_size(), spInfoFile);
+            deserialize(archive, restoreInfo);
+        } else {
+            std::ifstream infoFile(infoPath, std::ios::binary);
+            gvk_result(infoFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            deserialize(infoFile, nullptr, restoreInfo);
+        }
     } gvk_result_scope_end;
     return gvkResult;
 }
 
 inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, const std::set<VkStructureType>& structureType)
 {
-    // TODO : Make this function more generic...in its current state it's only safe
-    //  if its safe to use detail::destroy_pnext_copy()
-    while (pNext) {
-        while (pNext->pNext && structureType.count(pNext->pNext->sType)) {
-            auto pRemove = pNext->pNext;
-            pNext->pNext = pRemove->pNext;
-            pRemove->pNext = nullptr;
-            detail::destroy_pnext_copy(pRemove, nullptr);
-        }
-        pNext = pNext->pNext;
-    }
-    return pNext;
+    // NOTE : Removed entries are unlinked but not destroyed, restore infos are read
+    //  into Auto<> arenas which own the memory for every entry in the pNext chain
+    return gvk::detail::unlink_pnext_entries(pNext, structureType);
 }
 
 } // namespace restore_point
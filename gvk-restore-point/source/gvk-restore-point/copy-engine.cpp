@@ -33,6 +33,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "stb/stb_image_write.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <utility>
 
@@ -319,30 +320,20 @@ void CopyEngine::download(DownloadImageInfo downloadInfo)
             );
 
             // Copy
-            VkDeviceSize bufferOffset = 0;
-            std::vector<VkBufferImageCopy> bufferImageCopies;
-            bufferImageCopies.reserve(imageSubresourceCount);
-            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                    auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
-                    if (imageLayouts[subresource]) {
-                        auto bufferImageCopy = get_default<VkBufferImageCopy>();
-                        bufferImageCopy.bufferOffset = bufferOffset;
-                        bufferImageCopy.imageSubresource.aspectMask = get_image_aspect_flags(imageCreateInfo.format) & ~VK_IMAGE_ASPECT_STENCIL_BIT;
-                        bufferImageCopy.imageSubresource.mipLevel = mipLevel;
-                        bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
-                        bufferImageCopy.imageSubresource.layerCount = 1;
-                        bufferImageCopy.imageExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
-                        bufferImageCopies.push_back(bufferImageCopy);
+            uint32_t bufferImageCopyCount = 0;
+            get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, nullptr);
+            std::vector<VkBufferImageCopy> bufferImageCopies(bufferImageCopyCount);
+            get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, bufferImageCopies.data());
+            bufferImageCopies.erase(
+                std::remove_if(bufferImageCopies.begin(), bufferImageCopies.end(),
+                    [&](const VkBufferImageCopy& bufferImageCopy)
+                    {
+                        const auto& imageSubresource = bufferImageCopy.imageSubresource;
+                        return !imageLayouts[imageSubresource.baseArrayLayer * imageCreateInfo.mipLevels + imageSubresource.mipLevel];
                     }
-                    auto arrayLayerSubresourceRange = imageSubresourceRange;
-                    arrayLayerSubresourceRange.baseMipLevel = mipLevel;
-                    arrayLayerSubresourceRange.levelCount = 1;
-                    arrayLayerSubresourceRange.baseArrayLayer = arrayLayer;
-                    arrayLayerSubresourceRange.layerCount = 1;
-                    bufferOffset += get_image_data_size(imageCreateInfo, arrayLayerSubresourceRange);
-                }
-            }
+                ),
+                bufferImageCopies.end()
+            );
             dispatchTable.gvkCmdCopyImageToBuffer(
                 taskResources.vkCommandBuffer,
                 downloadInfo.image,
@@ -703,30 +694,20 @@ void CopyEngine::upload(UploadImageInfo uploadInfo)
             );
 
             // Copy
-            VkDeviceSize bufferOffset = 0;
-            std::vector<VkBufferImageCopy> bufferImageCopies;
-            bufferImageCopies.reserve(imageSubresourceCount);
-            for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                    auto subresource = arrayLayer * imageCreateInfo.mipLevels + mipLevel;
-                    if (newImageLayouts[subresource]) {
-                        auto bufferImageCopy = get_default<VkBufferImageCopy>();
-                        bufferImageCopy.bufferOffset = bufferOffset;
-                        bufferImageCopy.imageSubresource.aspectMask = get_image_aspect_flags(imageCreateInfo.format) & ~VK_IMAGE_ASPECT_STENCIL_BIT;
-                        bufferImageCopy.imageSubresource.mipLevel = mipLevel;
-                        bufferImageCopy.imageSubresource.baseArrayLayer = arrayLayer;
-                        bufferImageCopy.imageSubresource.layerCount = 1;
-                        bufferImageCopy.imageExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
-                        bufferImageCopies.push_back(bufferImageCopy);
+            uint32_t bufferImageCopyCount = 0;
+            get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, nullptr);
+            std::vector<VkBufferImageCopy> bufferImageCopies(bufferImageCopyCount);
+            get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, bufferImageCopies.data());
+            bufferImageCopies.erase(
+                std::remove_if(bufferImageCopies.begin(), bufferImageCopies.end(),
+                    [&](const VkBufferImageCopy& bufferImageCopy)
+                    {
+                        const auto& imageSubresource = bufferImageCopy.imageSubresource;
+                        return !newImageLayouts[imageSubresource.baseArrayLayer * imageCreateInfo.mipLevels + imageSubresource.mipLevel];
                     }
-                    auto arrayLayerSubresourceRange = imageSubresourceRange;
-                    arrayLayerSubresourceRange.baseMipLevel = mipLevel;
-                    arrayLayerSubresourceRange.levelCount = 1;
-                    arrayLayerSubresourceRange.baseArrayLayer = arrayLayer;
-                    arrayLayerSubresourceRange.layerCount = 1;
-                    bufferOffset += get_image_data_size(imageCreateInfo, arrayLayerSubresourceRange);
-                }
-            }
+                ),
+                bufferImageCopies.end()
+            );
 
             // TODO : We kinda don't want to be here if we have no copies to perform...
             //  Need layout transition and transfer logic to be modular.
@@ -1483,37 +1464,22 @@ VkResult CopyEngine::get_acceleration_structure_task_resources(const GvkAccelera
     return gvkResult;
 }
 
-uint32_t get_image_data_size(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange)
+VkDeviceSize get_image_data_size(const VkImageCreateInfo& imageCreateInfo, const VkImageSubresourceRange& imageSubresourceRange)
 {
     assert(imageSubresourceRange.baseMipLevel + imageSubresourceRange.levelCount <= imageCreateInfo.mipLevels);
     assert(imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount <= imageCreateInfo.arrayLayers);
-    return get_image_data_size(imageCreateInfo.format, imageCreateInfo.extent, imageSubresourceRange);
+    uint32_t bufferImageCopyCount = 0;
+    return get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, nullptr);
 }
 
-uint32_t get_image_data_size(VkFormat format, const VkExtent3D& extent, const VkImageSubresourceRange& imageSubresourceRange)
+VkDeviceSize get_image_data_size(VkFormat format, const VkExtent3D& extent, const VkImageSubresourceRange& imageSubresourceRange)
 {
-    // TODO : Revisit get_bytes_per_texel() for compressed formats...
-    uint32_t imageDataSize = 0;
-    GvkFormatInfo formatInfo{ };
-    get_format_info(format, &formatInfo);
-    auto imageAspectFlags = get_image_aspect_flags(format);
-    for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-        for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-            auto mipLevelExtent = get_mip_level_extent(extent, mipLevel);
-            if (!formatInfo.compressionType) {
-                imageDataSize += get_bytes_per_texel(format) * mipLevelExtent.width * mipLevelExtent.height * mipLevelExtent.depth * imageSubresourceRange.layerCount;
-            } else {
-                auto blockCount = (mipLevelExtent.width / formatInfo.blockExtent[0]) * (mipLevelExtent.height / formatInfo.blockExtent[1]) * (mipLevelExtent.depth / formatInfo.blockExtent[2]);
-                imageDataSize += blockCount * formatInfo.blockSize * imageSubresourceRange.layerCount;
-            }
-            // FROM : https://vulkan.lunarg.com/doc/view/1.3.261.1/windows/1.3-extensions/vkspec.html#VUID-vkCmdCopyImageToBuffer-srcImage-07978
-            //  If srcImage has a depth/stencil format, the bufferOffset member of any element of pRegions must be a multiple of 4
-            if (imageAspectFlags & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
-                imageDataSize += imageDataSize % 4;
-            }
-        }
-    }
-    return imageDataSize;
+    auto imageCreateInfo = get_default<VkImageCreateInfo>();
+    imageCreateInfo.format = format;
+    imageCreateInfo.extent = extent;
+    imageCreateInfo.mipLevels = imageSubresourceRange.baseMipLevel + imageSubresourceRange.levelCount;
+    imageCreateInfo.arrayLayers = imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount;
+    return get_image_data_size(imageCreateInfo, imageSubresourceRange);
 }
 
 } // namespace restore_point
@@ -73,7 +73,7 @@ void Applier::apply_VkAccelerationStructure_restore_point(const std::vector<GvkR
         VkDevice device = VK_NULL_HANDLE;
         for (const auto& capturedAccelerationStructure : capturedAccelerationStructures) {
             Auto<GvkAccelerationStructureRestoreInfoKHR> restoreInfo;
-            gvk_result(read_object_restore_info(mApplyInfo.path, "VkAccelerationStructureKHR", to_hex_string(capturedAccelerationStructure.handle), restoreInfo));
+            gvk_result(read_object_restore_info(mApplyInfo.path, "VkAccelerationStructureKHR", to_hex_string(capturedAccelerationStructure.handle), restoreInfo, mApplyInfo.flags));
             assert(!mAccelerationStructureSerializationBuffer == !mAccelerationStructureSerializationMemory);
             if (!mAccelerationStructureSerializationBuffer) {
                 auto pSerializationInfo = restoreInfo->pSerializationInfo;
@@ -167,7 +167,7 @@ VkResult Applier::process_VkAccelerationStructureKHR_builds(const GvkRestorePoin
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkAccelerationStructureRestoreInfoKHR> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkAccelerationStructureKHR", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkAccelerationStructureKHR", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));
         if (restoreInfo->buildGeometryInfo.sType == get_stype<VkAccelerationStructureBuildGeometryInfoKHR>()) {
             auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
             device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
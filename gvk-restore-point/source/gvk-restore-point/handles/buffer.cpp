@@ -172,7 +172,7 @@ VkResult Applier::process_VkBuffer_data(const GvkRestorePointObject& restorePoin
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkBufferRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkBuffer", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkBuffer", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));
         if (restoreInfo->flags & GVK_RESTORE_POINT_OBJECT_STATUS_ACTIVE_BIT) {
             auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
             device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
@@ -130,7 +130,7 @@ VkResult Applier::process_VkDescriptorSet_bindings(const GvkRestorePointObject&
     gvk_result_scope_begin(VK_SUCCESS) {
         std::vector<VkWriteDescriptorSet> descriptorWrites;
         Auto<GvkDescriptorSetRestoreInfo> descriptorSetRestoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDescriptorSet", to_hex_string(capturedDescriptorSet.handle), descriptorSetRestoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDescriptorSet", to_hex_string(capturedDescriptorSet.handle), descriptorSetRestoreInfo, mApplyInfo.flags));
 
         auto pNext = get_pnext<VkDescriptorSetVariableDescriptorCountAllocateInfo>(*descriptorSetRestoreInfo->pDescriptorSetAllocateInfo);
         if (pNext) {
@@ -198,7 +198,7 @@ VkResult Applier::process_VkDeviceMemory(const GvkRestorePointObject& restorePoi
 
             // TODO : Is this the best place for this logic?
             Auto<GvkBufferRestoreInfo> bufferRestoreInfo;
-            gvk_result(read_object_restore_info<GvkBufferRestoreInfo>(mApplyInfo.path, "VkBuffer", to_hex_string(bufferBindInfo.buffer), bufferRestoreInfo));
+            gvk_result(read_object_restore_info<GvkBufferRestoreInfo>(mApplyInfo.path, "VkBuffer", to_hex_string(bufferBindInfo.buffer), bufferRestoreInfo, mApplyInfo.flags));
             if (bufferRestoreInfo->pBufferCreateInfo->usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
                 auto bufferDeviceAddressInfo = get_default<VkBufferDeviceAddressInfo>();
                 bufferDeviceAddressInfo.buffer = buffer;
@@ -224,7 +224,7 @@ VkResult Applier::process_VkDeviceMemory_data(const GvkRestorePointObject& resto
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkDeviceMemoryRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDeviceMemory", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDeviceMemory", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));
         auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
         device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
         CopyEngine::UploadDeviceMemoryInfo uploadInfo{ };
@@ -274,7 +274,7 @@ VkResult Applier::process_VkDeviceMemory_mapping(const GvkRestorePointObject& ca
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkDeviceMemoryRestoreInfo> deviceMemoryRestoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDeviceMemory", to_hex_string(capturedDeviceMemory.handle), deviceMemoryRestoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkDeviceMemory", to_hex_string(capturedDeviceMemory.handle), deviceMemoryRestoreInfo, mApplyInfo.flags));
         if (deviceMemoryRestoreInfo->mappedMemoryInfo.size) {
             auto restoredDeviceMemory = get_restored_object(capturedDeviceMemory);
             auto device = (VkDevice)restoredDeviceMemory.dispatchableHandle;
@@ -121,7 +121,12 @@ void Creator::process_downloaded_VkImage(const CopyEngine::DownloadImageInfo& do
     if (creator.mCreateInfo.flags & GVK_RESTORE_POINT_CREATE_IMAGE_PNG_BIT) {
         GvkFormatInfo formatInfo { };
         get_format_info(imageCreateInfo.format, &formatInfo);
+        // NOTE : Multi-planar formats are downloaded as one region per plane at the
+        //  plane's extent, and formats with blocks larger than 1x1 (ie. 4:2:2) don't
+        //  have a component per texel, neither can be written as a PNG per region.
         bool pngAble = imageCreateInfo.imageType == VK_IMAGE_TYPE_2D && formatInfo.compressionType == GVK_FORMAT_COMPRESSION_TYPE_NONE;
+        pngAble &= formatInfo.planeCount <= 1;
+        pngAble &= formatInfo.blockExtent[0] == 1 && formatInfo.blockExtent[1] == 1 && formatInfo.blockExtent[2] == 1;
         for (uint32_t i = 0; i < formatInfo.componentCount && pngAble; ++i) {
             const auto& component = formatInfo.pComponents[i];
             if (component.name != GVK_FORMAT_COMPONENT_NAME_R &&
@@ -138,30 +143,24 @@ void Creator::process_downloaded_VkImage(const CopyEngine::DownloadImageInfo& do
             }
         }
         if (pngAble) {
-            VkDeviceSize offset = 0;
-            get_format_info(imageCreateInfo.format, &formatInfo);
-            auto bytesPerTexel = get_bytes_per_texel(imageCreateInfo.format);
             const auto& imageSubresourceRange = downloadInfo.imageSubresourceRange;
+            uint32_t bufferImageCopyCount = 0;
+            get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, nullptr);
+            std::vector<VkBufferImageCopy> bufferImageCopies(bufferImageCopyCount);
+            get_buffer_image_copies(imageCreateInfo, imageSubresourceRange, &bufferImageCopyCount, bufferImageCopies.data());
+            auto bytesPerTexel = get_bytes_per_texel(imageCreateInfo.format);
             auto mipLevelStrMaxSize = std::to_string(imageSubresourceRange.baseMipLevel + imageSubresourceRange.levelCount).size();
-            for (uint32_t mipLevel = imageSubresourceRange.baseMipLevel; mipLevel < imageSubresourceRange.levelCount; ++mipLevel) {
-                std::string mipLevelStr = std::to_string(mipLevel);
+            auto arrayLayerStrMaxSize = std::to_string(imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount).size();
+            for (const auto& bufferImageCopy : bufferImageCopies) {
+                std::string mipLevelStr = std::to_string(bufferImageCopy.imageSubresource.mipLevel);
                 mipLevelStr.insert(0, mipLevelStrMaxSize - mipLevelStr.size(), '0');
-                auto mipLevelExtent = get_mip_level_extent(imageCreateInfo.extent, mipLevel);
-                auto arrayLayerStrMaxSize = std::to_string(imageSubresourceRange.baseArrayLayer + imageSubresourceRange.layerCount).size();
-                for (uint32_t arrayLayer = imageSubresourceRange.baseArrayLayer; arrayLayer < imageSubresourceRange.layerCount; ++arrayLayer) {
-                    std::string arrayLayerStr = std::to_string(arrayLayer);
-                    arrayLayerStr.insert(0, arrayLayerStrMaxSize - arrayLayerStr.size(), '0');
-                    auto pngPath = path;
-                    pngPath.replace_extension(mipLevelStr + '.' + arrayLayerStr + '.' + "png");
-                    auto stride = mipLevelExtent.width * bytesPerTexel;
-                    stbi_write_png(pngPath.string().c_str(), (int)mipLevelExtent.width, (int)mipLevelExtent.height, (int)formatInfo.componentCount, pData + offset, stride);
-                    auto arrayElementSubresourceRange = imageSubresourceRange;
-                    arrayElementSubresourceRange.baseMipLevel = mipLevel;
-                    arrayElementSubresourceRange.levelCount = 1;
-                    arrayElementSubresourceRange.baseArrayLayer = arrayLayer;
-                    arrayElementSubresourceRange.layerCount = 1;
-                    offset += get_image_data_size(imageCreateInfo, arrayElementSubresourceRange);
-                }
+                std::string arrayLayerStr = std::to_string(bufferImageCopy.imageSubresource.baseArrayLayer);
+                arrayLayerStr.insert(0, arrayLayerStrMaxSize - arrayLayerStr.size(), '0');
+                auto pngPath = path;
+                pngPath.replace_extension(mipLevelStr + '.' + arrayLayerStr + '.' + "png");
+                const auto& extent = bufferImageCopy.imageExtent;
+                auto stride = extent.width * bytesPerTexel;
+                stbi_write_png(pngPath.string().c_str(), (int)extent.width, (int)extent.height, (int)formatInfo.componentCount, pData + bufferImageCopy.bufferOffset, stride);
             }
         }
     }
@@ -176,7 +175,7 @@ void Creator::process_downloaded_VkImage(const CopyEngine::DownloadImageInfo& do
             creator.mCreateInfo.pfnProcessResourceDataCallback(&restorePointObject, bindBufferMemoryInfo.memory, imageDataSize, pData);
         } else {
             std::ofstream dataFile(path.replace_extension("data"), std::ios::binary);
-            dataFile.write((char*)pData, imageDataSize);
+            dataFile.write((char*)pData, (std::streamsize)imageDataSize);
         }
     }
 }
@@ -202,7 +201,7 @@ VkResult Applier::restore_VkImage_layouts(const GvkRestorePointObject& restorePo
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkImageRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));
         auto vkDevice = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
         vkDevice = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)vkDevice, (uint64_t)vkDevice }).handle;
         auto vkImage = (VkImage)get_restored_object(restorePointObject).handle;
@@ -239,7 +238,7 @@ VkResult Applier::process_VkImage_data(const GvkRestorePointObject& restorePoint
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkImageRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));
         if (!get_dependency<VkSwapchainKHR>(restoreInfo->dependencyCount, restoreInfo->pDependencies)) {
             auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
             device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
@@ -275,7 +274,7 @@ void Applier::process_VkImage_data_upload(const CopyEngine::UploadImageInfo& upl
             if (std::filesystem::exists(uploadInfo.path)) {
                 std::ifstream dataFile(uploadInfo.path, std::ios::binary);
                 gvk_result(dataFile.is_open() ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-                dataFile.read((char*)pData, get_image_data_size(uploadInfo.imageCreateInfo, uploadInfo.imageSubresourceRange));
+                dataFile.read((char*)pData, (std::streamsize)get_image_data_size(uploadInfo.imageCreateInfo, uploadInfo.imageSubresourceRange));
             }
         } else {
             assert(uploadInfo.pUserData);
@@ -296,7 +295,7 @@ VkResult Applier::process_VkImage_layouts(const GvkRestorePointObject& restorePo
 {
     gvk_result_scope_begin(VK_SUCCESS) {
         Auto<GvkImageRestoreInfo> restoreInfo;
-        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo));
+        gvk_result(read_object_restore_info(mApplyInfo.path, "VkImage", to_hex_string(restorePointObject.handle), restoreInfo, mApplyInfo.flags));
         auto device = get_dependency<VkDevice>(restoreInfo->dependencyCount, restoreInfo->pDependencies);
         device = (VkDevice)get_restored_object({ VK_OBJECT_TYPE_DEVICE, (uint64_t)device, (uint64_t)device }).handle;
         CopyEngine::TransitionImageLayoutInfo transitionInfo{ };
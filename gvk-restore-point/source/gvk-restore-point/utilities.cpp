@@ -26,6 +26,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-restore-point/utilities.hpp"
 
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace gvk {
 namespace restore_point {
 
@@ -107,5 +114,70 @@ void LayerInfo::register_object_destruction(const GvkRestorePointObject& restore
     createdObjects.erase(restorePointObject);
 }
 
+std::shared_ptr<MappedFile> MappedFile::create(const std::filesystem::path& path)
+{
+    std::shared_ptr<MappedFile> spMappedFile(new MappedFile);
+#if defined(_WIN32) || defined(_WIN64)
+    spMappedFile->mFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (spMappedFile->mFile == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    LARGE_INTEGER fileSize { };
+    if (!GetFileSizeEx(spMappedFile->mFile, &fileSize) || !fileSize.QuadPart) {
+        return nullptr;
+    }
+    spMappedFile->mFileMapping = CreateFileMappingW(spMappedFile->mFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!spMappedFile->mFileMapping) {
+        return nullptr;
+    }
+    spMappedFile->mpData = (uint8_t*)MapViewOfFile(spMappedFile->mFileMapping, FILE_MAP_COPY, 0, 0, 0);
+    spMappedFile->mSize = spMappedFile->mpData ? (size_t)fileSize.QuadPart : 0;
+#else
+    auto fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor == -1) {
+        return nullptr;
+    }
+    struct stat fileStat { };
+    if (!fstat(fileDescriptor, &fileStat) && fileStat.st_size) {
+        auto pData = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+        if (pData != MAP_FAILED) {
+            spMappedFile->mpData = (uint8_t*)pData;
+            spMappedFile->mSize = (size_t)fileStat.st_size;
+        }
+    }
+    close(fileDescriptor);
+#endif
+    return spMappedFile->mpData ? spMappedFile : nullptr;
+}
+
+MappedFile::~MappedFile()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (mpData) {
+        UnmapViewOfFile(mpData);
+    }
+    if (mFileMapping) {
+        CloseHandle(mFileMapping);
+    }
+    if (mFile != INVALID_HANDLE_VALUE) {
+        CloseHandle(mFile);
+    }
+#else
+    if (mpData) {
+        munmap(mpData, mSize);
+    }
+#endif
+}
+
+uint8_t* MappedFile::get_data() const
+{
+    return mpData;
+}
+
+size_t MappedFile::get_size() const
+{
+    return mSize;
+}
+
 } // namespace restore_point
 } // namespace gvk
@@ -30,13 +30,21 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-handles/handles.hpp"
 
 #include <array>
+#include <chrono>
+#include <filesystem>
 #include <limits>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+namespace asio {
+class thread_pool;
+} // namespace asio
+
 namespace gvk {
 namespace spirv {
 
@@ -63,6 +71,24 @@ public:
     std::vector<std::string> errors;
 };
 
+/**
+Per shader results of a batch compile
+*/
+class CompileResult final
+{
+public:
+    VkResult result{ VK_SUCCESS };
+    std::chrono::nanoseconds duration{ };
+    VkBool32 deduplicated{ VK_FALSE };
+};
+
+class BindingInfo;
+
+namespace detail {
+class CompileCache;
+class ReflectionCache;
+} // namespace detail
+
 /**
 Provides high level control over shader compilation
 */
@@ -74,6 +100,54 @@ public:
     */
     struct CreateInfo final
     {
+        /**
+        Whether or not compiled SPIR-V and errors should be cached
+            @note When enabled, compile() returns cached results for ShaderInfo objects with matching language, stage, line offset, and source
+            @note Cache keys include the compiler options and glslang version, so cached results are invalidated when either changes
+        */
+        VkBool32 enableCache{ VK_FALSE };
+
+        /**
+        The maximum number of bytes of SPIR-V and errors to keep in the in-memory cache
+            @note If 0, the in-memory cache is unbounded
+            @note When exceeded, the least recently used entries are evicted
+        */
+        size_t cacheSize{ };
+
+        /**
+        An optional directory to read and write cached SPIR-V and errors
+            @note When provided, results evicted from (or never loaded into) the in-memory cache may be read back from disk
+            @note The directory is created if it doesn't exist
+            @note Ignored unless enableCache is VK_TRUE
+        */
+        std::filesystem::path cacheDirectory;
+
+        /**
+        The number of threads to use for batch compilation
+            @note If 0, std::thread::hardware_concurrency() threads are used
+            @note If 1, batches are compiled on the calling thread
+            @note Worker threads are created the first time a batch with more than one unique shader is compiled
+        */
+        uint32_t threadCount{ };
+
+        /**
+        The maximum number of shaders to keep SPIR-V reflection results for
+            @note Reflection results are used by BindingInfo::add_shader() when this spirv::Context is provided
+            @note If 0, reflection results aren't cached
+            @note When exceeded, the least recently used results are evicted
+        */
+        size_t reflectionCacheCount{ 256 };
+    };
+
+    /**
+    Statistics for a spirv::Context object's compile cache
+    */
+    struct CacheStatistics final
+    {
+        uint64_t hitCount{ };
+        uint64_t missCount{ };
+        uint64_t evictionCount{ };
+        size_t size{ };
     };
 
     /**
@@ -103,22 +177,88 @@ public:
     /**
     Compiles SPIR-V from a given spirv::ShaderInfo
     @param [in] pShaderInfo
+        @note If this spirv::Context was created with caching enabled, cached SPIR-V and errors are returned when available
     */
     VkResult compile(ShaderInfo* pShaderInfo);
 
+    /**
+    Compiles SPIR-V from a given array of spirv::ShaderInfo objects in parallel
+    @param [in] shaderInfoCount The number of spirv::ShaderInfo objects to compile
+    @param [in,out] pShaderInfos A pointer to an array of spirv::ShaderInfo objects to compile
+    @param [out] (optional = nullptr) pCompileResults A pointer to an array of shaderInfoCount spirv::CompileResult objects to populate with each shader's result and compile time
+        @note spirv::ShaderInfo objects with identical language, stage, line offset, and source are compiled once, the remaining duplicates are populated from that compilation and are marked as deduplicated with a duration of 0
+        @note Each worker thread uses its own glslang objects, so shaders are compiled concurrently without contention apart from the compile cache
+    @return VK_SUCCESS if every shader compiled successfully, otherwise the first failing result
+    */
+    VkResult compile(uint32_t shaderInfoCount, ShaderInfo* pShaderInfos, CompileResult* pCompileResults = nullptr);
+
+    /**
+    Gets this spirv::Context object's compile cache statistics
+    @return This spirv::Context object's compile cache statistics
+        @note If this spirv::Context was created without caching enabled, the returned statistics are zero
+    */
+    CacheStatistics get_cache_statistics() const;
+
 private:
     bool mInitialized{ false };
+    std::unique_ptr<detail::CompileCache> mupCompileCache;
+    std::unique_ptr<detail::ReflectionCache> mupReflectionCache;
+    uint32_t mThreadCount{ };
+    std::unique_ptr<asio::thread_pool> mupThreadPool;
+    std::mutex mThreadPoolMutex;
     static std::mutex sMutex;
     static uint32_t sInstanceCount;
+    friend class BindingInfo;
 };
 
 class BindingInfo final
 {
 public:
-    void add_shader(const ShaderInfo& shaderInfo);
+    /**
+    Describes the range of BindingInfo::descriptorSetLayoutBindings that belongs to a descriptor set
+    */
+    struct DescriptorSet final
+    {
+        uint32_t setIndex{ };
+        uint32_t firstBinding{ };
+        uint32_t bindingCount{ };
+    };
+
+    /**
+    Adds the bindings and push constant ranges used by a given spirv::ShaderInfo
+    @param [in] shaderInfo The spirv::ShaderInfo to add the bindings and push constant ranges of
+    @param [in] (optional = nullptr) pContext A pointer to the spirv::Context to use cached reflection results from
+        @note When pContext is provided, reflection results are cached by the spirv::Context, so adding the same SPIR-V to many BindingInfo objects only reflects it once
+    */
+    void add_shader(const ShaderInfo& shaderInfo, Context* pContext = nullptr);
+
+    /**
+    Adds a VkDescriptorSetLayoutBinding to a given descriptor set
+    @param [in] setIndex The index of the descriptor set to add the given VkDescriptorSetLayoutBinding to
+    @param [in] descriptorSetLayoutBinding The VkDescriptorSetLayoutBinding to add
+        @note If the descriptor set already has a VkDescriptorSetLayoutBinding with the same binding, stageFlags are merged
+    */
     void add_binding(uint32_t setIndex, const VkDescriptorSetLayoutBinding& descriptorSetLayoutBinding);
 
-    std::map<uint32_t, std::vector<VkDescriptorSetLayoutBinding>> descriptorSetLayoutBindings;
+    /**
+    Gets the VkDescriptorSetLayoutBinding objects for a given descriptor set
+    @param [in] setIndex The index of the descriptor set to get VkDescriptorSetLayoutBinding objects for
+    @param [out] pBindingCount A pointer to a uint32_t to populate with the number of VkDescriptorSetLayoutBinding objects
+    @return A pointer to the descriptor set's VkDescriptorSetLayoutBinding objects, or nullptr if the descriptor set has no bindings
+    */
+    const VkDescriptorSetLayoutBinding* get_descriptor_set_layout_bindings(uint32_t setIndex, uint32_t* pBindingCount) const;
+
+    /**
+    The descriptor sets with bindings, sorted by setIndex
+    */
+    std::vector<DescriptorSet> descriptorSets;
+
+    /**
+    VkDescriptorSetLayoutBinding objects for all descriptor sets, sorted by set then by binding
+        @note Each descriptor set's bindings are contiguous so they can be used directly as VkDescriptorSetLayoutCreateInfo::pBindings
+    */
+    std::vector<VkDescriptorSetLayoutBinding> descriptorSetLayoutBindings;
+
     std::map<uint32_t, VkDescriptorSetLayoutCreateInfo> descriptorSetLayoutCreateInfos;
     std::vector<VkPushConstantRange> pushConstantRanges;
 };
@@ -145,6 +285,81 @@ Creates a PipelineLayout from a given spirv::BindingInfo
 */
 VkResult create_pipeline_layout(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, PipelineLayout* pPipelineLayout);
 
+/**
+Provides DescriptorSetLayout and PipelineLayout objects that are shared between identical creation parameters
+    @note Lookups compare the Device, VkAllocationCallbacks pointer, and full creation parameters (including pNext chains)
+    @note Because DescriptorSetLayout objects are shared, PipelineLayout objects created from BindingInfo objects with identical bindings are shared as well
+    @note LayoutCache is thread safe
+*/
+class LayoutCache final
+{
+public:
+    /**
+    Statistics for a spirv::LayoutCache
+    */
+    struct Statistics final
+    {
+        uint64_t hitCount{ };
+        uint64_t missCount{ };
+    };
+
+    /**
+    Gets or creates DescriptorSetLayout objects for a given spirv::BindingInfo
+        @note Parameters and return value match spirv::create_descriptor_set_layouts()
+    */
+    VkResult create_descriptor_set_layouts(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, uint32_t* pDescriptorSetLayoutCount, DescriptorSetLayout* pDescriptorSetLayouts);
+
+    /**
+    Gets or creates a PipelineLayout for a given spirv::BindingInfo
+        @note Parameters and return value match spirv::create_pipeline_layout()
+    */
+    VkResult create_pipeline_layout(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, PipelineLayout* pPipelineLayout);
+
+    /**
+    Gets or creates a DescriptorSetLayout for a given VkDescriptorSetLayoutCreateInfo
+    @param [in] device The Device used to create the DescriptorSetLayout
+    @param [in] descriptorSetLayoutCreateInfo The VkDescriptorSetLayoutCreateInfo to get or create the DescriptorSetLayout for
+    @param [in] (optional) pAllocator A pointer to the VkAllocationCallbacks to use
+    @param [out] pDescriptorSetLayout A pointer to the DescriptorSetLayout to populate
+    @return the VkResult
+    */
+    VkResult get_descriptor_set_layout(const Device& device, const VkDescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo, const VkAllocationCallbacks* pAllocator, DescriptorSetLayout* pDescriptorSetLayout);
+
+    /**
+    Gets or creates a PipelineLayout for a given VkPipelineLayoutCreateInfo
+    @param [in] device The Device used to create the PipelineLayout
+    @param [in] pipelineLayoutCreateInfo The VkPipelineLayoutCreateInfo to get or create the PipelineLayout for
+    @param [in] (optional) pAllocator A pointer to the VkAllocationCallbacks to use
+    @param [out] pPipelineLayout A pointer to the PipelineLayout to populate
+    @return the VkResult
+    */
+    VkResult get_pipeline_layout(const Device& device, const VkPipelineLayoutCreateInfo& pipelineLayoutCreateInfo, const VkAllocationCallbacks* pAllocator, PipelineLayout* pPipelineLayout);
+
+    /**
+    Gets this spirv::LayoutCache object's statistics
+    @return This spirv::LayoutCache object's statistics
+    */
+    Statistics get_statistics() const;
+
+    /**
+    Releases this spirv::LayoutCache object's references to cached DescriptorSetLayout and PipelineLayout objects
+    */
+    void reset();
+
+private:
+    template <typename HandleType>
+    struct Entry final
+    {
+        const VkAllocationCallbacks* pAllocator{ };
+        HandleType handle;
+    };
+
+    std::unordered_multimap<uint64_t, Entry<DescriptorSetLayout>> mDescriptorSetLayouts;
+    std::unordered_multimap<uint64_t, Entry<PipelineLayout>> mPipelineLayouts;
+    Statistics mStatistics{ };
+    mutable std::mutex mMutex;
+};
+
 namespace detail {
 namespace api_types {
 
@@ -25,8 +25,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 
 #include "gvk-spirv/context.hpp"
+#include "gvk-string/to-string.hpp"
+#include "gvk-string/utilities.hpp"
 #include "gvk-structures.hpp"
 
+#include "asio.hpp"
+
 #ifdef GVK_COMPILER_MSVC
 #pragma warning(push, 0)
 #endif // GVK_COMPILER_MSVC
@@ -61,18 +65,346 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma warning(pop)
 #endif // GVK_COMPILER_MSVC
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <fstream>
 #include <iostream>
+#include <list>
+#include <random>
+#include <thread>
+#include <unordered_map>
 
 namespace gvk {
 namespace spirv {
 
+// NOTE : Compiler options are kept in one place because they're part of the
+//  compile cache key; changing any of them must produce a different key.
+static constexpr glslang::EShTargetLanguageVersion CompileTargetVersion = glslang::EShTargetSpv_1_4;
+static constexpr EShMessages CompileMessages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
+static constexpr int CompileDefaultVersion = 100;
+
+namespace detail {
+
+class CompileCache final
+{
+public:
+    CompileCache(size_t maxSize, const std::filesystem::path& directory)
+        : mMaxSize{ maxSize }
+        , mDirectory{ directory }
+    {
+        if (!mDirectory.empty()) {
+            std::error_code errorCode;
+            std::filesystem::create_directories(mDirectory, errorCode);
+        }
+    }
+
+    static uint64_t get_key(const ShaderInfo& shaderInfo)
+    {
+        auto version = glslang::GetVersion();
+        std::string key;
+        key.reserve(shaderInfo.source.size() + 128);
+        key += std::to_string(version.major) + '.' + std::to_string(version.minor) + '.' + std::to_string(version.patch);
+        key += version.flavor ? version.flavor : "";
+        key += '|' + std::to_string((uint32_t)shaderInfo.language);
+        key += '|' + std::to_string((uint32_t)shaderInfo.stage);
+        key += '|' + std::to_string(shaderInfo.lineOffset);
+        key += '|' + std::to_string((uint32_t)CompileTargetVersion);
+        key += '|' + std::to_string((uint32_t)CompileMessages);
+        key += '|' + std::to_string(CompileDefaultVersion);
+        key += '|';
+        key += shaderInfo.source;
+        return string::hash(key.data(), key.size());
+    }
+
+    bool get(uint64_t key, ShaderInfo* pShaderInfo)
+    {
+        assert(pShaderInfo);
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto itr = mEntries.find(key);
+        if (itr != mEntries.end()) {
+            mLru.splice(mLru.begin(), mLru, itr->second.lruItr);
+            pShaderInfo->spirv = itr->second.spirv;
+            pShaderInfo->errors = itr->second.errors;
+            ++mStatistics.hitCount;
+            return true;
+        }
+        if (read_file(key, pShaderInfo)) {
+            insert(key, pShaderInfo->spirv, pShaderInfo->errors);
+            ++mStatistics.hitCount;
+            return true;
+        }
+        ++mStatistics.missCount;
+        return false;
+    }
+
+    void put(uint64_t key, const ShaderInfo& shaderInfo)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mEntries.count(key)) {
+            insert(key, shaderInfo.spirv, shaderInfo.errors);
+            write_file(key, shaderInfo);
+        }
+    }
+
+    Context::CacheStatistics get_statistics() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mStatistics;
+    }
+
+private:
+    static constexpr uint32_t FileMagic = 0x534b5647; // "GVKS"
+    static constexpr uint32_t FileVersion = 1;
+
+    struct Entry final
+    {
+        std::vector<uint32_t> spirv;
+        std::vector<std::string> errors;
+        size_t size{ };
+        std::list<uint64_t>::iterator lruItr;
+    };
+
+    static size_t get_size(const std::vector<uint32_t>& spirv, const std::vector<std::string>& errors)
+    {
+        size_t size = spirv.size() * sizeof(uint32_t);
+        for (const auto& error : errors) {
+            size += error.size();
+        }
+        return size;
+    }
+
+    void insert(uint64_t key, const std::vector<uint32_t>& spirv, const std::vector<std::string>& errors)
+    {
+        auto size = get_size(spirv, errors);
+        mLru.push_front(key);
+        auto& entry = mEntries[key];
+        entry.spirv = spirv;
+        entry.errors = errors;
+        entry.size = size;
+        entry.lruItr = mLru.begin();
+        mStatistics.size += size;
+        // NOTE : The most recently inserted entry is never evicted, even if it
+        //  alone exceeds the cache size, so the next lookup for it still hits.
+        while (mMaxSize && mMaxSize < mStatistics.size && 1 < mLru.size()) {
+            auto evictItr = mEntries.find(mLru.back());
+            assert(evictItr != mEntries.end());
+            mStatistics.size -= evictItr->second.size;
+            mEntries.erase(evictItr);
+            mLru.pop_back();
+            ++mStatistics.evictionCount;
+        }
+    }
+
+    std::filesystem::path get_file_path(uint64_t key) const
+    {
+        return mDirectory / (to_hex_string(key) + ".spv");
+    }
+
+    bool read_file(uint64_t key, ShaderInfo* pShaderInfo) const
+    {
+        assert(pShaderInfo);
+        if (mDirectory.empty()) {
+            return false;
+        }
+        std::ifstream file(get_file_path(key), std::ios::binary);
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint64_t fileKey = 0;
+        uint64_t spirvCount = 0;
+        uint64_t errorCount = 0;
+        auto read = [&](void* pData, size_t size) { return (bool)file.read((char*)pData, (std::streamsize)size); };
+        if (!file || !read(&magic, sizeof(magic)) || !read(&version, sizeof(version)) || !read(&fileKey, sizeof(fileKey))) {
+            return false;
+        }
+        if (magic != FileMagic || version != FileVersion || fileKey != key || !read(&spirvCount, sizeof(spirvCount))) {
+            return false;
+        }
+        std::vector<uint32_t> spirv((size_t)spirvCount);
+        if (!read(spirv.data(), spirv.size() * sizeof(uint32_t)) || !read(&errorCount, sizeof(errorCount))) {
+            return false;
+        }
+        std::vector<std::string> errors((size_t)errorCount);
+        for (auto& error : errors) {
+            uint64_t length = 0;
+            if (!read(&length, sizeof(length))) {
+                return false;
+            }
+            error.resize((size_t)length);
+            if (!read(error.data(), error.size())) {
+                return false;
+            }
+        }
+        pShaderInfo->spirv = std::move(spirv);
+        pShaderInfo->errors = std::move(errors);
+        return true;
+    }
+
+    void write_file(uint64_t key, const ShaderInfo& shaderInfo) const
+    {
+        if (mDirectory.empty()) {
+            return;
+        }
+        // NOTE : Cache files are written to a uniquely named temporary file then
+        //  renamed into place so that concurrent readers (in this or another
+        //  process) never observe a partially written file.
+        auto filePath = get_file_path(key);
+        auto tempFilePath = filePath;
+        tempFilePath += "." + to_hex_string(std::random_device{ }()) + ".tmp";
+        {
+            std::ofstream file(tempFilePath, std::ios::binary);
+            auto write = [&](const void* pData, size_t size) { file.write((const char*)pData, (std::streamsize)size); };
+            uint64_t spirvCount = shaderInfo.spirv.size();
+            uint64_t errorCount = shaderInfo.errors.size();
+            write(&FileMagic, sizeof(FileMagic));
+            write(&FileVersion, sizeof(FileVersion));
+            write(&key, sizeof(key));
+            write(&spirvCount, sizeof(spirvCount));
+            write(shaderInfo.spirv.data(), shaderInfo.spirv.size() * sizeof(uint32_t));
+            write(&errorCount, sizeof(errorCount));
+            for (const auto& error : shaderInfo.errors) {
+                uint64_t length = error.size();
+                write(&length, sizeof(length));
+                write(error.data(), error.size());
+            }
+            if (!file) {
+                file.close();
+                std::error_code errorCode;
+                std::filesystem::remove(tempFilePath, errorCode);
+                return;
+            }
+        }
+        std::error_code errorCode;
+        std::filesystem::rename(tempFilePath, filePath, errorCode);
+        if (errorCode) {
+            std::filesystem::remove(tempFilePath, errorCode);
+        }
+    }
+
+    size_t mMaxSize{ };
+    std::filesystem::path mDirectory;
+    std::unordered_map<uint64_t, Entry> mEntries;
+    std::list<uint64_t> mLru;
+    Context::CacheStatistics mStatistics{ };
+    mutable std::mutex mMutex;
+};
+
+} // namespace detail
+
+// NOTE : Reflection results don't depend on the stage a shader is added for,
+//  so they're cached by SPIR-V and shared by every BindingInfo that adds the
+//  same SPIR-V with the same spirv::Context.  The stage is applied when bindings
+//  are added.
+struct ShaderReflection final
+{
+    std::vector<uint32_t> spirv;
+    std::vector<std::pair<uint32_t, VkDescriptorSetLayoutBinding>> bindings;
+    std::vector<uint32_t> pushConstantSizes;
+};
+
+static std::shared_ptr<const ShaderReflection> reflect_shader(const std::vector<uint32_t>& spirv)
+{
+    auto spShaderReflection = std::make_shared<ShaderReflection>();
+    spShaderReflection->spirv = spirv;
+    spirv_cross::CompilerGLSL compilerGlsl(spirv.data(), spirv.size());
+    auto createBinding =
+    [&](VkDescriptorType descriptorType, const spirv_cross::Resource& resource)
+    {
+        auto descriptorSetLayoutBinding = get_default<VkDescriptorSetLayoutBinding>();
+        descriptorSetLayoutBinding.binding = compilerGlsl.get_decoration(resource.id, spv::DecorationBinding);
+        descriptorSetLayoutBinding.descriptorType = descriptorType;
+        descriptorSetLayoutBinding.descriptorCount = 1;
+        auto setIndex = compilerGlsl.get_decoration(resource.id, spv::DecorationDescriptorSet);
+        spShaderReflection->bindings.push_back({ setIndex, descriptorSetLayoutBinding });
+    };
+    spirv_cross::ShaderResources shaderResources = compilerGlsl.get_shader_resources();
+    for (const auto& shaderResource : shaderResources.uniform_buffers) {
+        createBinding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, shaderResource);
+    }
+    for (const auto& shaderResource : shaderResources.storage_buffers) {
+        createBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, shaderResource);
+    }
+    for (const auto& shaderResource : shaderResources.sampled_images) {
+        createBinding(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, shaderResource);
+    }
+    for (const auto& shaderResource : shaderResources.storage_images) {
+        createBinding(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, shaderResource);
+    }
+    for (const auto& shaderResource : shaderResources.acceleration_structures) {
+        createBinding(VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, shaderResource);
+    }
+    for (const auto& shaderResource : shaderResources.push_constant_buffers) {
+        uint32_t size = 0;
+        for (const auto& range : compilerGlsl.get_active_buffer_ranges(shaderResource.id)) {
+            size += (uint32_t)range.range;
+        }
+        spShaderReflection->pushConstantSizes.push_back(size);
+    }
+    return spShaderReflection;
+}
+
+namespace detail {
+
+class ReflectionCache final
+{
+public:
+    ReflectionCache(size_t maxCount)
+        : mMaxCount{ maxCount }
+    {
+    }
+
+    std::shared_ptr<const ShaderReflection> get(const std::vector<uint32_t>& spirv)
+    {
+        // NOTE : Entries are keyed by a hash of the SPIR-V, the stored SPIR-V is
+        //  compared on lookup so a hash collision is treated as a miss rather than
+        //  returning another shader's reflection.
+        auto key = string::hash(spirv.data(), spirv.size() * sizeof(uint32_t));
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto itr = mEntries.find(key);
+            if (itr != mEntries.end() && itr->second.spShaderReflection->spirv == spirv) {
+                mLru.splice(mLru.begin(), mLru, itr->second.lruItr);
+                return itr->second.spShaderReflection;
+            }
+        }
+        auto spShaderReflection = reflect_shader(spirv);
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto itr = mEntries.find(key);
+        if (itr != mEntries.end()) {
+            mLru.splice(mLru.begin(), mLru, itr->second.lruItr);
+            itr->second.spShaderReflection = spShaderReflection;
+        } else {
+            mLru.push_front(key);
+            mEntries[key] = { spShaderReflection, mLru.begin() };
+            while (mMaxCount < mLru.size()) {
+                mEntries.erase(mLru.back());
+                mLru.pop_back();
+            }
+        }
+        return spShaderReflection;
+    }
+
+private:
+    struct Entry final
+    {
+        std::shared_ptr<const ShaderReflection> spShaderReflection;
+        std::list<uint64_t>::iterator lruItr;
+    };
+
+    size_t mMaxCount{ };
+    std::unordered_map<uint64_t, Entry> mEntries;
+    std::list<uint64_t> mLru;
+    std::mutex mMutex;
+};
+
+} // namespace detail
+
 std::mutex Context::sMutex;
 uint32_t Context::sInstanceCount;
 
 VkResult Context::create(const CreateInfo* pCreateInfo, Context* pContext)
 {
-    (void)pCreateInfo;
     assert(pCreateInfo);
     assert(pContext);
     pContext->reset();
@@ -85,6 +417,13 @@ VkResult Context::create(const CreateInfo* pCreateInfo, Context* pContext)
         }
         sInstanceCount += (uint32_t)pContext->mInitialized;
     }
+    if (pContext->mInitialized && pCreateInfo->enableCache) {
+        pContext->mupCompileCache = std::make_unique<detail::CompileCache>(pCreateInfo->cacheSize, pCreateInfo->cacheDirectory);
+    }
+    if (pContext->mInitialized && pCreateInfo->reflectionCacheCount) {
+        pContext->mupReflectionCache = std::make_unique<detail::ReflectionCache>(pCreateInfo->reflectionCacheCount);
+    }
+    pContext->mThreadCount = pCreateInfo->threadCount ? pCreateInfo->threadCount : std::max(std::thread::hardware_concurrency(), 1u);
     return pContext->mInitialized ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED;
 }
 
@@ -95,11 +434,20 @@ Context::~Context()
 
 void Context::reset()
 {
+    if (mupThreadPool) {
+        mupThreadPool->join();
+        mupThreadPool.reset();
+    }
+    mThreadCount = 0;
+    mupCompileCache.reset();
+    mupReflectionCache.reset();
     if (mInitialized) {
         std::lock_guard<std::mutex> lock(sMutex);
-        glslang::FinalizeProcess();
         assert(sInstanceCount);
-        --sInstanceCount;
+        if (!--sInstanceCount) {
+            glslang::FinalizeProcess();
+        }
+        mInitialized = false;
     }
 }
 
@@ -110,6 +458,13 @@ VkResult Context::compile(ShaderInfo* pShaderInfo)
     assert(pShaderInfo->language == ShadingLanguage::Glsl && "TODO : ShadingLanguage::Hlsl");
     pShaderInfo->spirv.clear();
     pShaderInfo->errors.clear();
+    uint64_t cacheKey = 0;
+    if (mupCompileCache) {
+        cacheKey = detail::CompileCache::get_key(*pShaderInfo);
+        if (mupCompileCache->get(cacheKey, pShaderInfo)) {
+            return pShaderInfo->errors.empty() ? VK_SUCCESS : VK_ERROR_UNKNOWN;
+        }
+    }
     EShLanguage eshStage{ };
     switch (pShaderInfo->stage) {
     case VK_SHADER_STAGE_VERTEX_BIT: eshStage = EShLangVertex; break;
@@ -132,12 +487,12 @@ VkResult Context::compile(ShaderInfo* pShaderInfo)
         glsl.insert(0, pShaderInfo->lineOffset, '\n');
     }
     auto pGlsl = glsl.c_str();
-    shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_4);
+    shader.setEnvTarget(glslang::EShTargetSpv, CompileTargetVersion);
     shader.setStrings(&pGlsl, 1);
-    auto messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
+    auto messages = CompileMessages;
     auto pDefaultResources = GetDefaultResources();
     assert(pDefaultResources);
-    if (shader.parse(pDefaultResources, 100, false, messages)) {
+    if (shader.parse(pDefaultResources, CompileDefaultVersion, false, messages)) {
         glslang::TProgram program;
         program.addShader(&shader);
         if (program.link(messages)) {
@@ -150,64 +505,167 @@ VkResult Context::compile(ShaderInfo* pShaderInfo)
         pShaderInfo->errors.push_back(shader.getInfoLog());
         pShaderInfo->errors.push_back(shader.getInfoDebugLog());
     }
+    if (mupCompileCache) {
+        mupCompileCache->put(cacheKey, *pShaderInfo);
+    }
     return pShaderInfo->errors.empty() ? VK_SUCCESS : VK_ERROR_UNKNOWN;
 }
 
-Context::operator bool() const
+static bool is_same_input(const ShaderInfo& lhs, const ShaderInfo& rhs)
 {
-    return mInitialized;
+    return
+        lhs.language == rhs.language &&
+        lhs.stage == rhs.stage &&
+        lhs.lineOffset == rhs.lineOffset &&
+        lhs.source == rhs.source;
 }
 
-void BindingInfo::add_shader(const ShaderInfo& shaderInfo)
+VkResult Context::compile(uint32_t shaderInfoCount, ShaderInfo* pShaderInfos, CompileResult* pCompileResults)
 {
-    spirv_cross::CompilerGLSL compilerGlsl(shaderInfo.spirv.data(), shaderInfo.spirv.size());
-    auto createBinding =
-    [&](VkDescriptorType descriptorType, const spirv_cross::Resource& resource)
+    assert(mInitialized);
+    assert(!shaderInfoCount || pShaderInfos);
+
+    // Find the unique inputs in the batch...only these are compiled, duplicates
+    //  are populated from the ShaderInfo they duplicate once compilation is done.
+    std::vector<uint32_t> compileIndices;
+    std::vector<uint32_t> sourceIndices(shaderInfoCount);
+    std::unordered_map<uint64_t, std::vector<uint32_t>> uniqueIndices;
+    compileIndices.reserve(shaderInfoCount);
+    uniqueIndices.reserve(shaderInfoCount);
+    for (uint32_t i = 0; i < shaderInfoCount; ++i) {
+        auto& candidateIndices = uniqueIndices[detail::CompileCache::get_key(pShaderInfos[i])];
+        auto candidateItr = std::find_if(candidateIndices.begin(), candidateIndices.end(),
+            [&](uint32_t candidateIndex)
+            {
+                return is_same_input(pShaderInfos[candidateIndex], pShaderInfos[i]);
+            }
+        );
+        if (candidateItr == candidateIndices.end()) {
+            candidateIndices.push_back(i);
+            compileIndices.push_back(i);
+            sourceIndices[i] = i;
+        } else {
+            sourceIndices[i] = *candidateItr;
+        }
+    }
+
+    // Compile unique inputs...workers pull the next index until every unique
+    //  input has been compiled.  The calling thread participates as a worker.
+    std::vector<CompileResult> compileResults(shaderInfoCount);
+    std::atomic_uint32_t compileIndex{ 0 };
+    auto compileShaders =
+    [&]()
     {
-        auto descriptorSetLayoutBinding = get_default<VkDescriptorSetLayoutBinding>();
-        descriptorSetLayoutBinding.binding = compilerGlsl.get_decoration(resource.id, spv::DecorationBinding);
-        descriptorSetLayoutBinding.descriptorType = descriptorType;
-        descriptorSetLayoutBinding.descriptorCount = 1;
-        descriptorSetLayoutBinding.stageFlags = shaderInfo.stage;
-        auto setIndex = compilerGlsl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-        add_binding(setIndex, descriptorSetLayoutBinding);
+        for (uint32_t i = compileIndex++; i < compileIndices.size(); i = compileIndex++) {
+            auto shaderInfoIndex = compileIndices[i];
+            auto begin = std::chrono::high_resolution_clock::now();
+            compileResults[shaderInfoIndex].result = compile(pShaderInfos + shaderInfoIndex);
+            compileResults[shaderInfoIndex].duration = std::chrono::high_resolution_clock::now() - begin;
+        }
     };
-    spirv_cross::ShaderResources shaderResources = compilerGlsl.get_shader_resources();
-    for (const auto& shaderResource : shaderResources.uniform_buffers) {
-        createBinding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, shaderResource);
-    }
-    for (const auto& shaderResource : shaderResources.storage_buffers) {
-        createBinding(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, shaderResource);
-    }
-    for (const auto& shaderResource : shaderResources.sampled_images) {
-        createBinding(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, shaderResource);
+    auto workerCount = (uint32_t)std::min<size_t>(mThreadCount, compileIndices.size()) - (compileIndices.empty() ? 0 : 1);
+    if (workerCount) {
+        {
+            std::lock_guard<std::mutex> lock(mThreadPoolMutex);
+            if (!mupThreadPool) {
+                mupThreadPool = std::make_unique<asio::thread_pool>(mThreadCount - 1);
+            }
+        }
+        std::mutex mutex;
+        std::condition_variable conditionVariable;
+        auto activeWorkerCount = workerCount;
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            asio::post(*mupThreadPool,
+                [&]()
+                {
+                    compileShaders();
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!--activeWorkerCount) {
+                        conditionVariable.notify_one();
+                    }
+                }
+            );
+        }
+        compileShaders();
+        std::unique_lock<std::mutex> lock(mutex);
+        conditionVariable.wait(lock, [&]() { return !activeWorkerCount; });
+    } else {
+        compileShaders();
     }
-    for (const auto& shaderResource : shaderResources.storage_images) {
-        createBinding(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, shaderResource);
+
+    // Populate duplicates and gather results...
+    VkResult vkResult = VK_SUCCESS;
+    for (uint32_t i = 0; i < shaderInfoCount; ++i) {
+        auto sourceIndex = sourceIndices[i];
+        if (sourceIndex != i) {
+            pShaderInfos[i].spirv = pShaderInfos[sourceIndex].spirv;
+            pShaderInfos[i].errors = pShaderInfos[sourceIndex].errors;
+            compileResults[i].result = compileResults[sourceIndex].result;
+            compileResults[i].deduplicated = VK_TRUE;
+        }
+        if (vkResult == VK_SUCCESS) {
+            vkResult = compileResults[i].result;
+        }
+        if (pCompileResults) {
+            pCompileResults[i] = compileResults[i];
+        }
     }
-    for (const auto& shaderResource : shaderResources.acceleration_structures) {
-        createBinding(VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, shaderResource);
+    return vkResult;
+}
+
+Context::CacheStatistics Context::get_cache_statistics() const
+{
+    return mupCompileCache ? mupCompileCache->get_statistics() : CacheStatistics{ };
+}
+
+Context::operator bool() const
+{
+    return mInitialized;
+}
+
+void BindingInfo::add_shader(const ShaderInfo& shaderInfo, Context* pContext)
+{
+    auto spShaderReflection = pContext && pContext->mupReflectionCache ?
+        pContext->mupReflectionCache->get(shaderInfo.spirv) :
+        reflect_shader(shaderInfo.spirv);
+    assert(spShaderReflection);
+    for (auto binding : spShaderReflection->bindings) {
+        binding.second.stageFlags = shaderInfo.stage;
+        add_binding(binding.first, binding.second);
     }
-    for (const auto& shaderResource : shaderResources.push_constant_buffers) {
-        auto ranges = compilerGlsl.get_active_buffer_ranges(shaderResource.id);
-        pushConstantRanges.push_back(VkPushConstantRange{ (VkShaderStageFlags)shaderInfo.stage, 0, 0 } );
-        for (const auto& range : ranges) {
-            pushConstantRanges.back().size += (uint32_t)range.range;
-        }
+    for (auto pushConstantSize : spShaderReflection->pushConstantSizes) {
+        pushConstantRanges.push_back(VkPushConstantRange{ (VkShaderStageFlags)shaderInfo.stage, 0, pushConstantSize });
     }
 }
 
 void BindingInfo::add_binding(uint32_t setIndex, const VkDescriptorSetLayoutBinding& descriptorSetLayoutBinding)
 {
-    auto& bindings = descriptorSetLayoutBindings[setIndex];
-    auto bindingItr = std::lower_bound(bindings.begin(), bindings.end(), descriptorSetLayoutBinding,
+    auto descriptorSetItr = std::lower_bound(descriptorSets.begin(), descriptorSets.end(), setIndex,
+        [](const DescriptorSet& descriptorSet, uint32_t setIndex)
+        {
+            return descriptorSet.setIndex < setIndex;
+        }
+    );
+    if (descriptorSetItr == descriptorSets.end() || descriptorSetItr->setIndex != setIndex) {
+        DescriptorSet descriptorSet{ };
+        descriptorSet.setIndex = setIndex;
+        descriptorSet.firstBinding = descriptorSetItr == descriptorSets.end() ? (uint32_t)descriptorSetLayoutBindings.size() : descriptorSetItr->firstBinding;
+        descriptorSetItr = descriptorSets.insert(descriptorSetItr, descriptorSet);
+    }
+    auto bindingsBegin = descriptorSetLayoutBindings.begin() + descriptorSetItr->firstBinding;
+    auto bindingsEnd = bindingsBegin + descriptorSetItr->bindingCount;
+    auto bindingItr = std::lower_bound(bindingsBegin, bindingsEnd, descriptorSetLayoutBinding,
         [](const VkDescriptorSetLayoutBinding& lhs, const VkDescriptorSetLayoutBinding& rhs)
         {
             return lhs.binding < rhs.binding;
         }
     );
-    if (bindingItr == bindings.end()) {
-        bindings.insert(bindingItr, descriptorSetLayoutBinding);
+    if (bindingItr == bindingsEnd || bindingItr->binding != descriptorSetLayoutBinding.binding) {
+        descriptorSetLayoutBindings.insert(bindingItr, descriptorSetLayoutBinding);
+        ++descriptorSetItr->bindingCount;
+        for (++descriptorSetItr; descriptorSetItr != descriptorSets.end(); ++descriptorSetItr) {
+            ++descriptorSetItr->firstBinding;
+        }
     } else {
         auto stageFlags = bindingItr->stageFlags | descriptorSetLayoutBinding.stageFlags;
         bindingItr->stageFlags = descriptorSetLayoutBinding.stageFlags;
@@ -216,56 +674,188 @@ void BindingInfo::add_binding(uint32_t setIndex, const VkDescriptorSetLayoutBind
     }
 }
 
-VkResult create_descriptor_set_layouts(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, uint32_t* pDescriptorSetLayoutCount, DescriptorSetLayout* pDescriptorSetLayouts)
+const VkDescriptorSetLayoutBinding* BindingInfo::get_descriptor_set_layout_bindings(uint32_t setIndex, uint32_t* pBindingCount) const
+{
+    assert(pBindingCount);
+    auto descriptorSetItr = std::lower_bound(descriptorSets.begin(), descriptorSets.end(), setIndex,
+        [](const DescriptorSet& descriptorSet, uint32_t setIndex)
+        {
+            return descriptorSet.setIndex < setIndex;
+        }
+    );
+    if (descriptorSetItr != descriptorSets.end() && descriptorSetItr->setIndex == setIndex && descriptorSetItr->bindingCount) {
+        *pBindingCount = descriptorSetItr->bindingCount;
+        return descriptorSetLayoutBindings.data() + descriptorSetItr->firstBinding;
+    }
+    *pBindingCount = 0;
+    return nullptr;
+}
+
+template <typename CreateDescriptorSetLayoutFunctionType>
+static VkResult create_descriptor_set_layouts(const BindingInfo& bindingInfo, uint32_t* pDescriptorSetLayoutCount, DescriptorSetLayout* pDescriptorSetLayouts, CreateDescriptorSetLayoutFunctionType createDescriptorSetLayout)
 {
-    assert(device);
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         if (pDescriptorSetLayoutCount) {
             gvk_result(VK_SUCCESS);
             if (pDescriptorSetLayouts) {
-                size_t i = 0;
-                auto itr = bindingInfo.descriptorSetLayoutBindings.begin();
-                while (i < *pDescriptorSetLayoutCount && itr != bindingInfo.descriptorSetLayoutBindings.end()) {
+                for (uint32_t i = 0; i < *pDescriptorSetLayoutCount && i < bindingInfo.descriptorSets.size(); ++i) {
+                    const auto& descriptorSet = bindingInfo.descriptorSets[i];
                     auto descriptorSetLayoutCreateInfo = gvk::get_default<VkDescriptorSetLayoutCreateInfo>();
-                    const auto& descriptorSetLayoutCreateInfoItr = bindingInfo.descriptorSetLayoutCreateInfos.find(itr->first);
+                    const auto& descriptorSetLayoutCreateInfoItr = bindingInfo.descriptorSetLayoutCreateInfos.find(descriptorSet.setIndex);
                     if (descriptorSetLayoutCreateInfoItr != bindingInfo.descriptorSetLayoutCreateInfos.end()) {
                         descriptorSetLayoutCreateInfo = descriptorSetLayoutCreateInfoItr->second;
                     }
-                    const auto& descriptorSetLayoutBindings = itr->second;
-                    descriptorSetLayoutCreateInfo.bindingCount = (uint32_t)descriptorSetLayoutBindings.size();
-                    descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings.data();
-                    gvk_result(DescriptorSetLayout::create(device, &descriptorSetLayoutCreateInfo, pAllocator, pDescriptorSetLayouts + i));
-                    ++itr;
-                    ++i;
+                    descriptorSetLayoutCreateInfo.bindingCount = descriptorSet.bindingCount;
+                    descriptorSetLayoutCreateInfo.pBindings = bindingInfo.descriptorSetLayoutBindings.data() + descriptorSet.firstBinding;
+                    gvk_result(createDescriptorSetLayout(descriptorSetLayoutCreateInfo, pDescriptorSetLayouts + i));
                 }
             } else {
-                *pDescriptorSetLayoutCount = (uint32_t)bindingInfo.descriptorSetLayoutBindings.size();
+                *pDescriptorSetLayoutCount = (uint32_t)bindingInfo.descriptorSets.size();
             }
         }
     } gvk_result_scope_end;
     return gvkResult;
 }
 
-VkResult create_pipeline_layout(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, gvk::PipelineLayout* pPipelineLayout)
+template <typename CreateDescriptorSetLayoutFunctionType, typename CreatePipelineLayoutFunctionType>
+static VkResult create_pipeline_layout(const BindingInfo& bindingInfo, PipelineLayout* pPipelineLayout, CreateDescriptorSetLayoutFunctionType createDescriptorSetLayout, CreatePipelineLayoutFunctionType createPipelineLayout)
 {
-    assert(device);
     assert(pPipelineLayout);
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
-        uint32_t descriptorSetLayoutCount = 0;
-        gvk_result(gvk::spirv::create_descriptor_set_layouts(device, bindingInfo, nullptr, &descriptorSetLayoutCount, nullptr));
+        auto descriptorSetLayoutCount = (uint32_t)bindingInfo.descriptorSets.size();
         std::vector<gvk::DescriptorSetLayout> descriptorSetLayouts(descriptorSetLayoutCount);
-        gvk_result(gvk::spirv::create_descriptor_set_layouts(device, bindingInfo, pAllocator, &descriptorSetLayoutCount, descriptorSetLayouts.data()));
+        gvk_result(create_descriptor_set_layouts(bindingInfo, &descriptorSetLayoutCount, descriptorSetLayouts.data(), createDescriptorSetLayout));
         auto vkDescriptorSetLayouts = gvk::get_vk_handles(descriptorSetLayouts);
         auto pipelineLayoutCreateInfo = gvk::get_default<VkPipelineLayoutCreateInfo>();
         pipelineLayoutCreateInfo.setLayoutCount = (uint32_t)vkDescriptorSetLayouts.size();
         pipelineLayoutCreateInfo.pSetLayouts = vkDescriptorSetLayouts.data();
         pipelineLayoutCreateInfo.pushConstantRangeCount = (uint32_t)bindingInfo.pushConstantRanges.size();
         pipelineLayoutCreateInfo.pPushConstantRanges = bindingInfo.pushConstantRanges.data();
-        gvk_result(gvk::PipelineLayout::create(device, &pipelineLayoutCreateInfo, pAllocator, pPipelineLayout));
+        gvk_result(createPipelineLayout(pipelineLayoutCreateInfo, pPipelineLayout));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult create_descriptor_set_layouts(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, uint32_t* pDescriptorSetLayoutCount, DescriptorSetLayout* pDescriptorSetLayouts)
+{
+    assert(device);
+    return create_descriptor_set_layouts(bindingInfo, pDescriptorSetLayoutCount, pDescriptorSetLayouts,
+        [&](const VkDescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo, DescriptorSetLayout* pDescriptorSetLayout)
+        {
+            return DescriptorSetLayout::create(device, &descriptorSetLayoutCreateInfo, pAllocator, pDescriptorSetLayout);
+        }
+    );
+}
+
+VkResult create_pipeline_layout(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, gvk::PipelineLayout* pPipelineLayout)
+{
+    assert(device);
+    return create_pipeline_layout(bindingInfo, pPipelineLayout,
+        [&](const VkDescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo, DescriptorSetLayout* pDescriptorSetLayout)
+        {
+            return DescriptorSetLayout::create(device, &descriptorSetLayoutCreateInfo, pAllocator, pDescriptorSetLayout);
+        },
+        [&](const VkPipelineLayoutCreateInfo& pipelineLayoutCreateInfo, PipelineLayout* pPipelineLayout)
+        {
+            return PipelineLayout::create(device, &pipelineLayoutCreateInfo, pAllocator, pPipelineLayout);
+        }
+    );
+}
+
+VkResult LayoutCache::create_descriptor_set_layouts(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, uint32_t* pDescriptorSetLayoutCount, DescriptorSetLayout* pDescriptorSetLayouts)
+{
+    assert(device);
+    return spirv::create_descriptor_set_layouts(bindingInfo, pDescriptorSetLayoutCount, pDescriptorSetLayouts,
+        [&](const VkDescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo, DescriptorSetLayout* pDescriptorSetLayout)
+        {
+            return get_descriptor_set_layout(device, descriptorSetLayoutCreateInfo, pAllocator, pDescriptorSetLayout);
+        }
+    );
+}
+
+VkResult LayoutCache::create_pipeline_layout(const Device& device, const BindingInfo& bindingInfo, const VkAllocationCallbacks* pAllocator, PipelineLayout* pPipelineLayout)
+{
+    assert(device);
+    return spirv::create_pipeline_layout(bindingInfo, pPipelineLayout,
+        [&](const VkDescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo, DescriptorSetLayout* pDescriptorSetLayout)
+        {
+            return get_descriptor_set_layout(device, descriptorSetLayoutCreateInfo, pAllocator, pDescriptorSetLayout);
+        },
+        [&](const VkPipelineLayoutCreateInfo& pipelineLayoutCreateInfo, PipelineLayout* pPipelineLayout)
+        {
+            return get_pipeline_layout(device, pipelineLayoutCreateInfo, pAllocator, pPipelineLayout);
+        }
+    );
+}
+
+VkResult LayoutCache::get_descriptor_set_layout(const Device& device, const VkDescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo, const VkAllocationCallbacks* pAllocator, DescriptorSetLayout* pDescriptorSetLayout)
+{
+    assert(device);
+    assert(pDescriptorSetLayout);
+    auto seed = gvk::detail::hash_combine((uint64_t)device.get<VkDevice>(), (uint64_t)pAllocator);
+    auto key = gvk::hash(descriptorSetLayoutCreateInfo, seed, 0);
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto range = mDescriptorSetLayouts.equal_range(key);
+    for (auto itr = range.first; itr != range.second; ++itr) {
+        const auto& entry = itr->second;
+        if (entry.pAllocator == pAllocator && entry.handle.get<Device>() == device && entry.handle.get<VkDescriptorSetLayoutCreateInfo>() == descriptorSetLayoutCreateInfo) {
+            *pDescriptorSetLayout = entry.handle;
+            ++mStatistics.hitCount;
+            return VK_SUCCESS;
+        }
+    }
+    ++mStatistics.missCount;
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        Entry<DescriptorSetLayout> entry{ };
+        entry.pAllocator = pAllocator;
+        gvk_result(DescriptorSetLayout::create(device, &descriptorSetLayoutCreateInfo, pAllocator, &entry.handle));
+        *pDescriptorSetLayout = entry.handle;
+        mDescriptorSetLayouts.insert({ key, std::move(entry) });
     } gvk_result_scope_end;
     return gvkResult;
 }
 
+VkResult LayoutCache::get_pipeline_layout(const Device& device, const VkPipelineLayoutCreateInfo& pipelineLayoutCreateInfo, const VkAllocationCallbacks* pAllocator, PipelineLayout* pPipelineLayout)
+{
+    assert(device);
+    assert(pPipelineLayout);
+    auto seed = gvk::detail::hash_combine((uint64_t)device.get<VkDevice>(), (uint64_t)pAllocator);
+    auto key = gvk::hash(pipelineLayoutCreateInfo, seed, 0);
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto range = mPipelineLayouts.equal_range(key);
+    for (auto itr = range.first; itr != range.second; ++itr) {
+        const auto& entry = itr->second;
+        if (entry.pAllocator == pAllocator && entry.handle.get<Device>() == device && entry.handle.get<VkPipelineLayoutCreateInfo>() == pipelineLayoutCreateInfo) {
+            *pPipelineLayout = entry.handle;
+            ++mStatistics.hitCount;
+            return VK_SUCCESS;
+        }
+    }
+    ++mStatistics.missCount;
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        Entry<PipelineLayout> entry{ };
+        entry.pAllocator = pAllocator;
+        gvk_result(PipelineLayout::create(device, &pipelineLayoutCreateInfo, pAllocator, &entry.handle));
+        *pPipelineLayout = entry.handle;
+        mPipelineLayouts.insert({ key, std::move(entry) });
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+LayoutCache::Statistics LayoutCache::get_statistics() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStatistics;
+}
+
+void LayoutCache::reset()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mPipelineLayouts.clear();
+    mDescriptorSetLayouts.clear();
+    mStatistics = { };
+}
+
 namespace detail {
 
 void EnableGLSLCompiler()
@@ -35,7 +35,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #endif
 #include "gtest/gtest.h"
 
+#include <array>
+#include <chrono>
+#include <filesystem>
 #include <iostream>
+#include <string>
+#include <vector>
 
 TEST(spirv, Context)
 {
@@ -91,6 +96,185 @@ TEST(spirv, Context)
     EXPECT_FALSE(shaderInfo.errors.empty());
 }
 
+TEST(spirv, Context_Cache)
+{
+    auto cacheDirectory = std::filesystem::temp_directory_path() / "gvk-spirv-cache-test";
+    std::filesystem::remove_all(cacheDirectory);
+
+    gvk::spirv::ShaderInfo shaderInfo{
+        /* .language   = */ gvk::spirv::ShadingLanguage::Glsl,
+        /* .stage      = */ VK_SHADER_STAGE_VERTEX_BIT,
+        /* .lineOffset = */ __LINE__,
+        /* .source     = */ R"(
+            #version 450
+
+            out gl_PerVertex
+            {
+                vec4 gl_Position;
+            };
+
+            void main()
+            {
+                gl_Position = vec4(0, 0, 0, 1);
+            }
+        )",
+        /* .spirv  = */ { },
+        /* .errors = */ { }
+    };
+    auto invalidShaderInfo = shaderInfo;
+    invalidShaderInfo.source = R"(
+        #version 450
+        void main()
+        {
+            This shouldn't compile...
+        }
+    )";
+
+    std::vector<uint32_t> spirv;
+    std::vector<std::string> errors;
+    {
+        auto spirvContextCreateInfo = gvk::get_default<gvk::spirv::Context::CreateInfo>();
+        spirvContextCreateInfo.enableCache = VK_TRUE;
+        spirvContextCreateInfo.cacheDirectory = cacheDirectory;
+        gvk::spirv::Context spirvContext;
+        ASSERT_EQ(gvk::spirv::Context::create(&spirvContextCreateInfo, &spirvContext), VK_SUCCESS);
+
+        // The first compile is a miss...
+        EXPECT_EQ(spirvContext.compile(&shaderInfo), VK_SUCCESS);
+        EXPECT_FALSE(shaderInfo.spirv.empty());
+        spirv = shaderInfo.spirv;
+        auto cacheStatistics = spirvContext.get_cache_statistics();
+        EXPECT_EQ(cacheStatistics.hitCount, 0u);
+        EXPECT_EQ(cacheStatistics.missCount, 1u);
+        EXPECT_NE(cacheStatistics.size, 0u);
+
+        // ...the second compile is a hit that returns the same SPIR-V...
+        EXPECT_EQ(spirvContext.compile(&shaderInfo), VK_SUCCESS);
+        EXPECT_EQ(shaderInfo.spirv, spirv);
+        cacheStatistics = spirvContext.get_cache_statistics();
+        EXPECT_EQ(cacheStatistics.hitCount, 1u);
+        EXPECT_EQ(cacheStatistics.missCount, 1u);
+
+        // ...a different line offset is a different cache entry...
+        auto offsetShaderInfo = shaderInfo;
+        offsetShaderInfo.lineOffset += 1;
+        EXPECT_EQ(spirvContext.compile(&offsetShaderInfo), VK_SUCCESS);
+        EXPECT_EQ(spirvContext.get_cache_statistics().missCount, 2u);
+
+        // ...and errors are cached along with SPIR-V.
+        EXPECT_EQ(spirvContext.compile(&invalidShaderInfo), VK_ERROR_UNKNOWN);
+        errors = invalidShaderInfo.errors;
+        EXPECT_FALSE(errors.empty());
+        EXPECT_EQ(spirvContext.compile(&invalidShaderInfo), VK_ERROR_UNKNOWN);
+        EXPECT_TRUE(invalidShaderInfo.spirv.empty());
+        EXPECT_EQ(invalidShaderInfo.errors, errors);
+        cacheStatistics = spirvContext.get_cache_statistics();
+        EXPECT_EQ(cacheStatistics.hitCount, 2u);
+        EXPECT_EQ(cacheStatistics.missCount, 3u);
+    }
+
+    {
+        // A new spirv::Context reads results back from the cache directory and
+        //  evicts entries from its in-memory cache when cacheSize is exceeded.
+        auto spirvContextCreateInfo = gvk::get_default<gvk::spirv::Context::CreateInfo>();
+        spirvContextCreateInfo.enableCache = VK_TRUE;
+        spirvContextCreateInfo.cacheSize = 1;
+        spirvContextCreateInfo.cacheDirectory = cacheDirectory;
+        gvk::spirv::Context spirvContext;
+        ASSERT_EQ(gvk::spirv::Context::create(&spirvContextCreateInfo, &spirvContext), VK_SUCCESS);
+        EXPECT_EQ(spirvContext.compile(&shaderInfo), VK_SUCCESS);
+        EXPECT_EQ(shaderInfo.spirv, spirv);
+        EXPECT_EQ(spirvContext.compile(&invalidShaderInfo), VK_ERROR_UNKNOWN);
+        EXPECT_EQ(invalidShaderInfo.errors, errors);
+        auto cacheStatistics = spirvContext.get_cache_statistics();
+        EXPECT_EQ(cacheStatistics.hitCount, 2u);
+        EXPECT_EQ(cacheStatistics.missCount, 0u);
+        EXPECT_EQ(cacheStatistics.evictionCount, 1u);
+    }
+
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+TEST(spirv, Context_BatchCompile)
+{
+    gvk::spirv::Context spirvContext;
+    ASSERT_EQ(gvk::spirv::Context::create(&gvk::get_default<gvk::spirv::Context::CreateInfo>(), &spirvContext), VK_SUCCESS);
+
+    // Generate permutations of a fragment shader...every eighth ShaderInfo is a
+    //  duplicate of the ShaderInfo before it.
+    const uint32_t PermutationCount = 2048;
+    std::vector<gvk::spirv::ShaderInfo> shaderInfos;
+    shaderInfos.reserve(PermutationCount + PermutationCount / 7);
+    for (uint32_t i = 0; i < PermutationCount; ++i) {
+        shaderInfos.push_back(gvk::spirv::ShaderInfo{
+            /* .language   = */ gvk::spirv::ShadingLanguage::Glsl,
+            /* .stage      = */ VK_SHADER_STAGE_FRAGMENT_BIT,
+            /* .lineOffset = */ __LINE__,
+            /* .source     = */
+                "#version 450\n"
+                "#define PERMUTATION " + std::to_string(i) + "\n"
+                "#define USE_TINT " + std::to_string(i & 1) + "\n"
+                "#define USE_FOG " + std::to_string((i >> 1) & 1) + "\n"
+                R"(
+                    layout(location = 0) in vec2 fsTexcoord;
+                    layout(location = 0) out vec4 fragColor;
+                    void main()
+                    {
+                        fragColor = vec4(fsTexcoord, float(PERMUTATION) / 2048.0, 1);
+                    #if USE_TINT
+                        fragColor.rgb *= vec3(0.5, 0.75, 1.0);
+                    #endif
+                    #if USE_FOG
+                        fragColor.rgb = mix(fragColor.rgb, vec3(0.5), gl_FragCoord.z);
+                    #endif
+                    }
+                )",
+            /* .spirv  = */ { },
+            /* .errors = */ { }
+        });
+        if (i % 7 == 6) {
+            shaderInfos.push_back(shaderInfos.back());
+        }
+    }
+    auto invalidShaderIndex = (uint32_t)shaderInfos.size();
+    shaderInfos.push_back(shaderInfos.front());
+    shaderInfos.back().source += "This shouldn't compile...";
+
+    // Compile every permutation in one batch...
+    std::vector<gvk::spirv::CompileResult> compileResults(shaderInfos.size());
+    auto begin = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(spirvContext.compile((uint32_t)shaderInfos.size(), shaderInfos.data(), compileResults.data()), VK_ERROR_UNKNOWN);
+    auto duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin).count();
+    std::cout << "Compiled " << shaderInfos.size() << " shaders in " << duration << "s" << std::endl;
+
+    uint32_t deduplicatedCount = 0;
+    for (uint32_t i = 0; i < (uint32_t)shaderInfos.size(); ++i) {
+        if (i == invalidShaderIndex) {
+            EXPECT_EQ(compileResults[i].result, VK_ERROR_UNKNOWN);
+            EXPECT_TRUE(shaderInfos[i].spirv.empty());
+            EXPECT_FALSE(shaderInfos[i].errors.empty());
+        } else {
+            EXPECT_EQ(compileResults[i].result, VK_SUCCESS);
+            EXPECT_FALSE(shaderInfos[i].spirv.empty());
+            EXPECT_TRUE(shaderInfos[i].errors.empty());
+        }
+        if (compileResults[i].deduplicated) {
+            ASSERT_NE(i, 0u);
+            EXPECT_EQ(shaderInfos[i].spirv, shaderInfos[i - 1].spirv);
+            EXPECT_EQ(compileResults[i].duration.count(), 0);
+            ++deduplicatedCount;
+        }
+    }
+    EXPECT_EQ(deduplicatedCount, PermutationCount / 7);
+
+    // Verify that batch results match results compiled one at a time...
+    for (uint32_t i = 0; i < (uint32_t)shaderInfos.size(); i += 97) {
+        auto shaderInfo = shaderInfos[i];
+        EXPECT_EQ(spirvContext.compile(&shaderInfo), compileResults[i].result);
+        EXPECT_EQ(shaderInfo.spirv, shaderInfos[i].spirv);
+    }
+}
+
 TEST(spirv, BindingInfo_UniformBuffer)
 {
     gvk::validate_pipeline_layout_creation(
@@ -379,3 +563,193 @@ TEST(spirv, BindingInfo_PushConstants)
         }
     );
 }
+
+TEST(spirv, BindingInfo_AddBinding)
+{
+    auto create_binding =
+    [](uint32_t binding, VkShaderStageFlags stageFlags)
+    {
+        auto descriptorSetLayoutBinding = gvk::get_default<VkDescriptorSetLayoutBinding>();
+        descriptorSetLayoutBinding.binding = binding;
+        descriptorSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        descriptorSetLayoutBinding.descriptorCount = 1;
+        descriptorSetLayoutBinding.stageFlags = stageFlags;
+        return descriptorSetLayoutBinding;
+    };
+
+    // Add bindings out of order, including a binding used by two stages...
+    gvk::spirv::BindingInfo bindingInfo;
+    bindingInfo.add_binding(2, create_binding(5, VK_SHADER_STAGE_VERTEX_BIT));
+    bindingInfo.add_binding(0, create_binding(3, VK_SHADER_STAGE_VERTEX_BIT));
+    bindingInfo.add_binding(2, create_binding(1, VK_SHADER_STAGE_VERTEX_BIT));
+    bindingInfo.add_binding(0, create_binding(0, VK_SHADER_STAGE_VERTEX_BIT));
+    bindingInfo.add_binding(0, create_binding(3, VK_SHADER_STAGE_FRAGMENT_BIT));
+
+    // ...bindings are sorted by set then binding, and each set is contiguous.
+    ASSERT_EQ(bindingInfo.descriptorSets.size(), 2u);
+    EXPECT_EQ(bindingInfo.descriptorSets[0].setIndex, 0u);
+    EXPECT_EQ(bindingInfo.descriptorSets[0].firstBinding, 0u);
+    EXPECT_EQ(bindingInfo.descriptorSets[0].bindingCount, 2u);
+    EXPECT_EQ(bindingInfo.descriptorSets[1].setIndex, 2u);
+    EXPECT_EQ(bindingInfo.descriptorSets[1].firstBinding, 2u);
+    EXPECT_EQ(bindingInfo.descriptorSets[1].bindingCount, 2u);
+    ASSERT_EQ(bindingInfo.descriptorSetLayoutBindings.size(), 4u);
+    EXPECT_EQ(bindingInfo.descriptorSetLayoutBindings[0], create_binding(0, VK_SHADER_STAGE_VERTEX_BIT));
+    EXPECT_EQ(bindingInfo.descriptorSetLayoutBindings[1], create_binding(3, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT));
+    EXPECT_EQ(bindingInfo.descriptorSetLayoutBindings[2], create_binding(1, VK_SHADER_STAGE_VERTEX_BIT));
+    EXPECT_EQ(bindingInfo.descriptorSetLayoutBindings[3], create_binding(5, VK_SHADER_STAGE_VERTEX_BIT));
+
+    uint32_t bindingCount = 0;
+    EXPECT_EQ(bindingInfo.get_descriptor_set_layout_bindings(2, &bindingCount), bindingInfo.descriptorSetLayoutBindings.data() + 2);
+    EXPECT_EQ(bindingCount, 2u);
+    EXPECT_EQ(bindingInfo.get_descriptor_set_layout_bindings(1, &bindingCount), nullptr);
+    EXPECT_EQ(bindingCount, 0u);
+}
+
+TEST(spirv, LayoutCache)
+{
+    gvk::spirv::Context spirvContext;
+    ASSERT_EQ(gvk::spirv::Context::create(&gvk::get_default<gvk::spirv::Context::CreateInfo>(), &spirvContext), VK_SUCCESS);
+    std::array<gvk::spirv::ShaderInfo, 3> shaderInfos{
+        gvk::spirv::ShaderInfo{
+            /* .language   = */ gvk::spirv::ShadingLanguage::Glsl,
+            /* .stage      = */ VK_SHADER_STAGE_VERTEX_BIT,
+            /* .lineOffset = */ __LINE__,
+            /* .source     = */ R"(
+                #version 450
+                layout(set = 0, binding = 0) uniform Camera { mat4 viewProjection; } camera;
+                void main()
+                {
+                    gl_Position = camera.viewProjection * vec4(0, 0, 0, 1);
+                }
+            )",
+            /* .spirv  = */ { },
+            /* .errors = */ { }
+        },
+        gvk::spirv::ShaderInfo{
+            /* .language   = */ gvk::spirv::ShadingLanguage::Glsl,
+            /* .stage      = */ VK_SHADER_STAGE_FRAGMENT_BIT,
+            /* .lineOffset = */ __LINE__,
+            /* .source     = */ R"(
+                #version 450
+                layout(set = 1, binding = 0) uniform sampler2D image;
+                layout(location = 0) out vec4 fragColor;
+                void main()
+                {
+                    fragColor = texture(image, vec2(0));
+                }
+            )",
+            /* .spirv  = */ { },
+            /* .errors = */ { }
+        },
+        gvk::spirv::ShaderInfo{
+            /* .language   = */ gvk::spirv::ShadingLanguage::Glsl,
+            /* .stage      = */ VK_SHADER_STAGE_FRAGMENT_BIT,
+            /* .lineOffset = */ __LINE__,
+            /* .source     = */ R"(
+                #version 450
+                layout(set = 1, binding = 0) uniform sampler2D image;
+                layout(set = 1, binding = 1) uniform sampler2D normals;
+                layout(location = 0) out vec4 fragColor;
+                void main()
+                {
+                    fragColor = texture(image, vec2(0)) + texture(normals, vec2(0));
+                }
+            )",
+            /* .spirv  = */ { },
+            /* .errors = */ { }
+        },
+    };
+    ASSERT_EQ(spirvContext.compile((uint32_t)shaderInfos.size(), shaderInfos.data()), VK_SUCCESS);
+
+    gvk::Context context;
+    ASSERT_EQ(gvk::Context::create(&gvk::get_default<gvk::Context::CreateInfo>(), nullptr, &context), VK_SUCCESS);
+    const auto& device = context.get_devices()[0];
+    gvk::spirv::LayoutCache layoutCache;
+
+    // BindingInfo objects built from the same shaders get the same PipelineLayout...
+    std::array<gvk::PipelineLayout, 3> pipelineLayouts;
+    for (uint32_t i = 0; i < 2; ++i) {
+        gvk::spirv::BindingInfo bindingInfo;
+        bindingInfo.add_shader(shaderInfos[0]);
+        bindingInfo.add_shader(shaderInfos[1]);
+        ASSERT_EQ(layoutCache.create_pipeline_layout(device, bindingInfo, nullptr, &pipelineLayouts[i]), VK_SUCCESS);
+    }
+    EXPECT_EQ(pipelineLayouts[0], pipelineLayouts[1]);
+    auto statistics = layoutCache.get_statistics();
+    EXPECT_EQ(statistics.missCount, 3u);
+    EXPECT_EQ(statistics.hitCount, 3u);
+
+    // ...and a BindingInfo with a different set 1 gets a different PipelineLayout
+    //  that shares the DescriptorSetLayout for set 0.
+    gvk::spirv::BindingInfo bindingInfo;
+    bindingInfo.add_shader(shaderInfos[0]);
+    bindingInfo.add_shader(shaderInfos[2]);
+    ASSERT_EQ(layoutCache.create_pipeline_layout(device, bindingInfo, nullptr, &pipelineLayouts[2]), VK_SUCCESS);
+    EXPECT_NE(pipelineLayouts[0], pipelineLayouts[2]);
+    const auto& descriptorSetLayouts0 = pipelineLayouts[0].get<gvk::DescriptorSetLayouts>();
+    const auto& descriptorSetLayouts2 = pipelineLayouts[2].get<gvk::DescriptorSetLayouts>();
+    ASSERT_EQ(descriptorSetLayouts0.size(), 2u);
+    ASSERT_EQ(descriptorSetLayouts2.size(), 2u);
+    EXPECT_EQ(descriptorSetLayouts0[0], descriptorSetLayouts2[0]);
+    EXPECT_NE(descriptorSetLayouts0[1], descriptorSetLayouts2[1]);
+    statistics = layoutCache.get_statistics();
+    EXPECT_EQ(statistics.missCount, 5u);
+    EXPECT_EQ(statistics.hitCount, 4u);
+}
+
+TEST(spirv, BindingInfo_ReflectionCache)
+{
+    // NOTE : With a reflection cache that only holds one shader, alternating
+    //  between shaders evicts on every add, results must match uncached reflection.
+    auto spirvContextCreateInfo = gvk::get_default<gvk::spirv::Context::CreateInfo>();
+    spirvContextCreateInfo.reflectionCacheCount = 1;
+    gvk::spirv::Context spirvContext;
+    ASSERT_EQ(gvk::spirv::Context::create(&spirvContextCreateInfo, &spirvContext), VK_SUCCESS);
+    std::array<gvk::spirv::ShaderInfo, 2> shaderInfos{
+        gvk::spirv::ShaderInfo{
+            /* .language   = */ gvk::spirv::ShadingLanguage::Glsl,
+            /* .stage      = */ VK_SHADER_STAGE_VERTEX_BIT,
+            /* .lineOffset = */ __LINE__,
+            /* .source     = */ R"(
+                #version 450
+                layout(set = 0, binding = 0) uniform Camera { mat4 viewProjection; } camera;
+                void main()
+                {
+                    gl_Position = camera.viewProjection * vec4(0, 0, 0, 1);
+                }
+            )",
+            /* .spirv  = */ { },
+            /* .errors = */ { }
+        },
+        gvk::spirv::ShaderInfo{
+            /* .language   = */ gvk::spirv::ShadingLanguage::Glsl,
+            /* .stage      = */ VK_SHADER_STAGE_FRAGMENT_BIT,
+            /* .lineOffset = */ __LINE__,
+            /* .source     = */ R"(
+                #version 450
+                layout(set = 1, binding = 2) uniform sampler2D image;
+                layout(location = 0) out vec4 fragColor;
+                void main()
+                {
+                    fragColor = texture(image, vec2(0));
+                }
+            )",
+            /* .spirv  = */ { },
+            /* .errors = */ { }
+        },
+    };
+    ASSERT_EQ(spirvContext.compile((uint32_t)shaderInfos.size(), shaderInfos.data()), VK_SUCCESS);
+    for (uint32_t i = 0; i < 4; ++i) {
+        const auto& shaderInfo = shaderInfos[i % shaderInfos.size()];
+        gvk::spirv::BindingInfo cachedBindingInfo;
+        cachedBindingInfo.add_shader(shaderInfo, &spirvContext);
+        gvk::spirv::BindingInfo bindingInfo;
+        bindingInfo.add_shader(shaderInfo);
+        ASSERT_EQ(cachedBindingInfo.descriptorSetLayoutBindings.size(), 1u);
+        ASSERT_EQ(cachedBindingInfo.descriptorSetLayoutBindings.size(), bindingInfo.descriptorSetLayoutBindings.size());
+        EXPECT_EQ(cachedBindingInfo.descriptorSetLayoutBindings[0], bindingInfo.descriptorSetLayoutBindings[0]);
+        ASSERT_EQ(cachedBindingInfo.descriptorSets.size(), 1u);
+        EXPECT_EQ(cachedBindingInfo.descriptorSets[0].setIndex, i % 2 ? 1u : 0u);
+    }
+}
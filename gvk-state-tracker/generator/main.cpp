@@ -35,17 +35,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 int main(int, const char*[])
 {
-    tinyxml2::XMLDocument xmlDocument;
-    auto xmlResult = xmlDocument.LoadFile(GVK_XML_FILE_PATH);
-    if (xmlResult == tinyxml2::XML_SUCCESS) {
-        gvk::xml::Manifest manifest(xmlDocument);
-        gvk::cppgen::BasicCmdTrackerGenerator::generate(manifest);
-        gvk::cppgen::BasicStateTrackerGenerator::generate(manifest);
-        gvk::cppgen::EnumerateStateTrackedObjectsGenerator::generate(manifest);
-        gvk::cppgen::GetStateTrackedObjectCreateInfoGenerator::generate(manifest);
-        gvk::cppgen::GetStateTrackedObjectInfoGenerator::generate(manifest);
-        gvk::cppgen::SetStateTrackedObjectNameGenerator::generate(manifest);
-        gvk::cppgen::StateTrackedHandlesGenerator::generate(manifest);
+    gvk::xml::Manifest manifest;
+    if (gvk::xml::load_manifest(GVK_XML_FILE_PATH, GVK_XML_MANIFEST_CACHE_DIRECTORY, manifest)) {
+        gvk::cppgen::ParallelGenerator generators;
+        generators.add([&]() { gvk::cppgen::BasicCmdTrackerGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::BasicStateTrackerGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::EnumerateStateTrackedObjectsGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::GetStateTrackedObjectCreateInfoGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::GetStateTrackedObjectInfoGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::SetStateTrackedObjectNameGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::StateTrackedHandlesGenerator::generate(manifest); });
+        generators.wait();
     }
     return 0;
 }
@@ -49,6 +49,7 @@ public:
         if (handle.name == "VkDevice") {
             add_member(MemberInfo("ObjectTracker<Queue>", "mQueueTracker"));
             add_member(MemberInfo("DeviceAddressTracker", "mDeviceAddressTracker", "DeviceAddressTracker"));
+            add_member(MemberInfo("PipelineStateCache", "mPipelineStateCache"));
         }
         if (handle.name == "VkQueue") {
             add_member(MemberInfo("VkDevice", "mVkDevice", "VkDevice"));
@@ -56,6 +57,17 @@ public:
         }
         if (handle.name == "VkPipeline") {
             add_member(MemberInfo("std::vector<ShaderModule>", "mShaderModules"));
+            for (const auto& pipelineCreateInfoType : {
+                "VkComputePipelineCreateInfo",
+                "VkGraphicsPipelineCreateInfo",
+                "VkRayTracingPipelineCreateInfoKHR",
+                "VkRayTracingPipelineCreateInfoNV",
+            }) {
+                erase_member(string::replace("gvk::Auto<{pipelineCreateInfoType}>", "{pipelineCreateInfoType}", pipelineCreateInfoType));
+                auto storageType = string::replace("InternedPipelineCreateInfo<{pipelineCreateInfoType}>", "{pipelineCreateInfoType}", pipelineCreateInfoType);
+                auto storageName = "m" + string::strip_vk(pipelineCreateInfoType);
+                add_member(MemberInfo(storageType, storageName, pipelineCreateInfoType));
+            }
         }
         if (handle.name == "VkAccelerationStructureKHR") {
             add_member(MemberInfo("std::vector<Buffer>", "mBuildBuffers"));
@@ -273,6 +285,7 @@ private:
         file << "#include \"gvk-state-tracker/image-layout-tracker.hpp\"" << std::endl;
         file << "#include \"gvk-state-tracker/memory-map-info.hpp\"" << std::endl;
         file << "#include \"gvk-state-tracker/object-tracker.hpp\"" << std::endl;
+        file << "#include \"gvk-state-tracker/pipeline-state-cache.hpp\"" << std::endl;
         file << "#include \"gvk-reference.hpp\"" << std::endl;
         file << "#include \"gvk-structures.hpp\"" << std::endl;
         file << "#include \"VK_LAYER_INTEL_gvk_state_tracker.h\"" << std::endl;
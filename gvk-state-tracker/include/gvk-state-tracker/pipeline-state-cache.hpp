@@ -0,0 +1,189 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/auto.hpp"
+#include "gvk-structures/copy.hpp"
+#include "gvk-structures/hash.hpp"
+
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace gvk {
+namespace state_tracker {
+
+// NOTE : PipelineStateCache stores a single deep copy of each unique pipeline
+//  sub-state structure (shader stages, viewport state, rasterization state, etc.)
+//  so that tracked pipelines can reference shared copies rather than storing
+//  their own.  Interned copies are released when the last referencing pipeline
+//  is destroyed.
+class PipelineStateCache final
+{
+public:
+    template <typename StructureType>
+    inline std::shared_ptr<const Auto<StructureType>> intern(const StructureType& obj)
+    {
+        auto hash = gvk::hash(obj);
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto range = mEntries.equal_range(hash);
+        for (auto itr = range.first; itr != range.second;) {
+            auto spEntry = itr->second.wpObj.lock();
+            if (!spEntry) {
+                itr = mEntries.erase(itr);
+            } else {
+                if (itr->second.type == typeid(StructureType)) {
+                    auto spObj = std::static_pointer_cast<const Auto<StructureType>>(spEntry);
+                    if (**spObj == obj) {
+                        return spObj;
+                    }
+                }
+                ++itr;
+            }
+        }
+        auto spObj = std::make_shared<const Auto<StructureType>>(obj);
+        mEntries.emplace(hash, Entry { typeid(StructureType), spObj });
+        if (mPruneThreshold <= mEntries.size()) {
+            prune_expired_entries();
+        }
+        return spObj;
+    }
+
+    size_t size() const;
+    void prune();
+    void reset();
+
+private:
+    struct Entry final
+    {
+        std::type_index type;
+        std::weak_ptr<const void> wpObj;
+    };
+
+    void prune_expired_entries();
+
+    mutable std::mutex mMutex;
+    std::unordered_multimap<uint64_t, Entry> mEntries;
+    size_t mPruneThreshold { 256 };
+};
+
+// NOTE : InternedPipelineCreateInfo owns its top level create info and pNext
+//  chain, all sub-state pointers reference copies interned in the Device's
+//  PipelineStateCache.
+template <typename PipelineCreateInfoType>
+class InternedPipelineCreateInfo final
+{
+public:
+    InternedPipelineCreateInfo() = default;
+
+    inline InternedPipelineCreateInfo(PipelineStateCache& pipelineStateCache, const PipelineCreateInfoType& createInfo)
+        : mCreateInfo { createInfo }
+    {
+        if (mCreateInfo.pNext) {
+            mspPNext.reset(detail::create_pnext_copy(createInfo.pNext, nullptr), [](const void* pNext) { detail::destroy_pnext_copy(pNext, nullptr); });
+            mCreateInfo.pNext = mspPNext.get();
+        }
+        if constexpr (std::is_same_v<PipelineCreateInfoType, VkComputePipelineCreateInfo>) {
+            mCreateInfo.stage = *intern(pipelineStateCache, &createInfo.stage);
+        }
+        if constexpr (std::is_same_v<PipelineCreateInfoType, VkGraphicsPipelineCreateInfo>) {
+            mCreateInfo.pStages = intern(pipelineStateCache, createInfo.stageCount, createInfo.pStages);
+            mCreateInfo.pVertexInputState = intern(pipelineStateCache, createInfo.pVertexInputState);
+            mCreateInfo.pInputAssemblyState = intern(pipelineStateCache, createInfo.pInputAssemblyState);
+            mCreateInfo.pTessellationState = intern(pipelineStateCache, createInfo.pTessellationState);
+            mCreateInfo.pViewportState = intern(pipelineStateCache, createInfo.pViewportState);
+            mCreateInfo.pRasterizationState = intern(pipelineStateCache, createInfo.pRasterizationState);
+            mCreateInfo.pMultisampleState = intern(pipelineStateCache, createInfo.pMultisampleState);
+            mCreateInfo.pDepthStencilState = intern(pipelineStateCache, createInfo.pDepthStencilState);
+            mCreateInfo.pColorBlendState = intern(pipelineStateCache, createInfo.pColorBlendState);
+            mCreateInfo.pDynamicState = intern(pipelineStateCache, createInfo.pDynamicState);
+        }
+        if constexpr (std::is_same_v<PipelineCreateInfoType, VkRayTracingPipelineCreateInfoKHR>) {
+            mCreateInfo.pStages = intern(pipelineStateCache, createInfo.stageCount, createInfo.pStages);
+            mCreateInfo.pGroups = intern(pipelineStateCache, createInfo.groupCount, createInfo.pGroups);
+            mCreateInfo.pLibraryInfo = intern(pipelineStateCache, createInfo.pLibraryInfo);
+            mCreateInfo.pLibraryInterface = intern(pipelineStateCache, createInfo.pLibraryInterface);
+            mCreateInfo.pDynamicState = intern(pipelineStateCache, createInfo.pDynamicState);
+        }
+        if constexpr (std::is_same_v<PipelineCreateInfoType, VkRayTracingPipelineCreateInfoNV>) {
+            mCreateInfo.pStages = intern(pipelineStateCache, createInfo.stageCount, createInfo.pStages);
+            mCreateInfo.pGroups = intern(pipelineStateCache, createInfo.groupCount, createInfo.pGroups);
+        }
+    }
+
+    inline operator const PipelineCreateInfoType&() const
+    {
+        return mCreateInfo;
+    }
+
+    inline const PipelineCreateInfoType& operator*() const
+    {
+        return mCreateInfo;
+    }
+
+    inline const PipelineCreateInfoType* operator->() const
+    {
+        return &mCreateInfo;
+    }
+
+private:
+    template <typename StructureType>
+    inline const StructureType* intern(PipelineStateCache& pipelineStateCache, const StructureType* pObj)
+    {
+        if (pObj) {
+            auto spObj = pipelineStateCache.intern(*pObj);
+            mInternedState.push_back(spObj);
+            return &**spObj;
+        }
+        return nullptr;
+    }
+
+    template <typename StructureType>
+    inline const StructureType* intern(PipelineStateCache& pipelineStateCache, uint32_t count, const StructureType* pObjs)
+    {
+        if (count && pObjs) {
+            auto spObjs = std::make_shared<std::vector<StructureType>>();
+            spObjs->reserve(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                spObjs->push_back(*intern(pipelineStateCache, &pObjs[i]));
+            }
+            mInternedState.push_back(spObjs);
+            return spObjs->data();
+        }
+        return nullptr;
+    }
+
+    PipelineCreateInfoType mCreateInfo { };
+    std::shared_ptr<const void> mspPNext;
+    std::vector<std::shared_ptr<const void>> mInternedState;
+};
+
+} // namespace state_tracker
+} // namespace gvk
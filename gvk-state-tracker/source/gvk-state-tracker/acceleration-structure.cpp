@@ -51,7 +51,7 @@ VkResult StateTracker::post_vkCreateAccelerationStructureKHR(VkDevice device, co
         assert(gvkAccelerationStructure);
         assert(gvkAccelerationStructure.mReference);
         auto& accelerationStructureControlBlock = gvkAccelerationStructure.mReference.get_obj();
-        auto& accelerationStructureCreateInfo = const_cast<VkAccelerationStructureCreateInfoKHR&>(*accelerationStructureControlBlock.mAccelerationStructureCreateInfoKHR);
+        auto& accelerationStructureCreateInfo = accelerationStructureControlBlock.mAccelerationStructureCreateInfoKHR.detach();
 
         const auto& dispatchTableItr = layer::Registry::get().VkDeviceDispatchTables.find(layer::get_dispatch_key(device));
         assert(dispatchTableItr != layer::Registry::get().VkDeviceDispatchTables.end());
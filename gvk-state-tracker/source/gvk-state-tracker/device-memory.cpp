@@ -50,7 +50,7 @@ VkResult StateTracker::post_vkAllocateMemory(VkDevice device, const VkMemoryAllo
     if (gvkResult == VK_SUCCESS) {
         DeviceMemory gvkDeviceMemory({ device, *pMemory });
         assert(gvkDeviceMemory);
-        auto& allocateInfo = const_cast<VkMemoryAllocateInfo&>(*gvkDeviceMemory.mReference.get_obj().mMemoryAllocateInfo);
+        auto& allocateInfo = gvkDeviceMemory.mReference.get_obj().mMemoryAllocateInfo.detach();
 
         VkMemoryAllocateFlagsInfo* pMemoryAllocateFlagsInfo = nullptr;
         VkMemoryOpaqueCaptureAddressAllocateInfo* pMemoryOpaqueCaptureAddressAllocateInfo = nullptr;
@@ -86,10 +86,13 @@ VkResult StateTracker::post_vkAllocateMemory(VkDevice device, const VkMemoryAllo
             auto deviceMemoryCaptureAddressInfo = get_default<VkDeviceMemoryOpaqueCaptureAddressInfo>();
             deviceMemoryCaptureAddressInfo.memory = *pMemory;
 
+            // NOTE : The Auto<> arena can't take ownership of a separately allocated
+            //  pNext entry, if one needs to be added the Auto<> is rebuilt from a chain
+            //  that includes a local VkMemoryOpaqueCaptureAddressAllocateInfo.
+            auto memoryOpaqueCaptureAddressAllocateInfo = get_default<VkMemoryOpaqueCaptureAddressAllocateInfo>();
             if (!pMemoryOpaqueCaptureAddressAllocateInfo) {
-                pMemoryOpaqueCaptureAddressAllocateInfo = (VkMemoryOpaqueCaptureAddressAllocateInfo*)detail::create_pnext_copy(&get_default<VkMemoryOpaqueCaptureAddressAllocateInfo>(), nullptr);
-                pMemoryOpaqueCaptureAddressAllocateInfo->pNext = allocateInfo.pNext;
-                allocateInfo.pNext = pMemoryOpaqueCaptureAddressAllocateInfo;
+                memoryOpaqueCaptureAddressAllocateInfo.pNext = allocateInfo.pNext;
+                pMemoryOpaqueCaptureAddressAllocateInfo = &memoryOpaqueCaptureAddressAllocateInfo;
             }
 
             uint64_t opaqueCaptureAddress = 0;
@@ -100,6 +103,11 @@ VkResult StateTracker::post_vkAllocateMemory(VkDevice device, const VkMemoryAllo
             }
             assert(!pMemoryOpaqueCaptureAddressAllocateInfo->opaqueCaptureAddress || pMemoryOpaqueCaptureAddressAllocateInfo->opaqueCaptureAddress == opaqueCaptureAddress);
             pMemoryOpaqueCaptureAddressAllocateInfo->opaqueCaptureAddress = opaqueCaptureAddress;
+            if (pMemoryOpaqueCaptureAddressAllocateInfo == &memoryOpaqueCaptureAddressAllocateInfo) {
+                auto memoryAllocateInfo = allocateInfo;
+                memoryAllocateInfo.pNext = &memoryOpaqueCaptureAddressAllocateInfo;
+                gvkDeviceMemory.mReference.get_obj().mMemoryAllocateInfo = memoryAllocateInfo;
+            }
         }
     }
     *const_cast<VkMemoryAllocateInfo*>(pAllocateInfo) = tlApplicationMemoryAllocateInfo;
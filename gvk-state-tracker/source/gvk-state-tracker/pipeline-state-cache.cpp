@@ -0,0 +1,70 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-state-tracker/pipeline-state-cache.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace gvk {
+namespace state_tracker {
+
+size_t PipelineStateCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    size_t size = 0;
+    for (const auto& entryItr : mEntries) {
+        size += entryItr.second.wpObj.expired() ? 0 : 1;
+    }
+    return size;
+}
+
+void PipelineStateCache::prune()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    prune_expired_entries();
+}
+
+void PipelineStateCache::reset()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+    mPruneThreshold = 256;
+}
+
+void PipelineStateCache::prune_expired_entries()
+{
+    // NOTE : Entries for released structures are only removed lazily, so the
+    //  threshold is scaled with the number of live entries to keep the cost of
+    //  pruning amortized across calls to intern().
+    for (auto itr = mEntries.begin(); itr != mEntries.end();) {
+        itr = itr->second.wpObj.expired() ? mEntries.erase(itr) : std::next(itr);
+    }
+    mPruneThreshold = std::max(mEntries.size() * 2, (size_t)256);
+}
+
+} // namespace state_tracker
+} // namespace gvk
@@ -71,7 +71,7 @@ VkResult StateTracker::post_vkCreateComputePipelines(VkDevice device, VkPipeline
             controlBlock.mPipelineCache = PipelineCache({ device, pipelineCache });
             controlBlock.mPipelineLayout = PipelineLayout({ device, createInfo.layout });
             controlBlock.mAllocationCallbacks = pAllocator ? *pAllocator : VkAllocationCallbacks { };
-            controlBlock.mComputePipelineCreateInfo = createInfo;
+            controlBlock.mComputePipelineCreateInfo = InternedPipelineCreateInfo<VkComputePipelineCreateInfo>(gvkDevice.mReference.get_obj().mPipelineStateCache, createInfo);
             controlBlock.mShaderModules.push_back(ShaderModule({ device, createInfo.stage.module }));
             assert(controlBlock.mShaderModules.back());
             gvkDevice.mReference.get_obj().mPipelineTracker.insert(gvkPipeline);
@@ -100,7 +100,7 @@ VkResult StateTracker::post_vkCreateGraphicsPipelines(VkDevice device, VkPipelin
             controlBlock.mPipelineLayout = PipelineLayout({ device, createInfo.layout });
             controlBlock.mRenderPass = RenderPass({ device, createInfo.renderPass });
             controlBlock.mAllocationCallbacks = pAllocator ? *pAllocator : VkAllocationCallbacks { };
-            controlBlock.mGraphicsPipelineCreateInfo = createInfo;
+            controlBlock.mGraphicsPipelineCreateInfo = InternedPipelineCreateInfo<VkGraphicsPipelineCreateInfo>(gvkDevice.mReference.get_obj().mPipelineStateCache, createInfo);
             controlBlock.mShaderModules.reserve(createInfo.stageCount);
             for (uint32_t stage_i = 0; stage_i < createInfo.stageCount; ++stage_i) {
                 controlBlock.mShaderModules.push_back(ShaderModule({ device, createInfo.pStages[stage_i].module }));
@@ -132,7 +132,7 @@ VkResult StateTracker::post_vkCreateRayTracingPipelinesKHR(VkDevice device, VkDe
             controlBlock.mPipelineCache = PipelineCache({ device, pipelineCache });
             controlBlock.mPipelineLayout = PipelineLayout({ device, createInfo.layout });
             controlBlock.mAllocationCallbacks = pAllocator ? *pAllocator : VkAllocationCallbacks { };
-            controlBlock.mRayTracingPipelineCreateInfoKHR = createInfo;
+            controlBlock.mRayTracingPipelineCreateInfoKHR = InternedPipelineCreateInfo<VkRayTracingPipelineCreateInfoKHR>(gvkDevice.mReference.get_obj().mPipelineStateCache, createInfo);
             controlBlock.mShaderModules.reserve(createInfo.stageCount);
             for (uint32_t stage_i = 0; stage_i < createInfo.stageCount; ++stage_i) {
                 controlBlock.mShaderModules.push_back(ShaderModule({ device, createInfo.pStages[stage_i].module }));
@@ -163,7 +163,7 @@ VkResult StateTracker::post_vkCreateRayTracingPipelinesNV(VkDevice device, VkPip
             controlBlock.mPipelineCache = PipelineCache({ device, pipelineCache });
             controlBlock.mPipelineLayout = PipelineLayout({ device, createInfo.layout });
             controlBlock.mAllocationCallbacks = pAllocator ? *pAllocator : VkAllocationCallbacks { };
-            controlBlock.mRayTracingPipelineCreateInfoNV = createInfo;
+            controlBlock.mRayTracingPipelineCreateInfoNV = InternedPipelineCreateInfo<VkRayTracingPipelineCreateInfoNV>(gvkDevice.mReference.get_obj().mPipelineStateCache, createInfo);
             controlBlock.mShaderModules.reserve(createInfo.stageCount);
             for (uint32_t stage_i = 0; stage_i < createInfo.stageCount; ++stage_i) {
                 controlBlock.mShaderModules.push_back(ShaderModule({ device, createInfo.pStages[stage_i].module }));
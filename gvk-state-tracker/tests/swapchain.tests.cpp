@@ -85,8 +85,12 @@ TEST(Swapchain, SwapchainResourceLifetime)
     for (const auto& fence : wsiManager.get_fences()) {
         ASSERT_TRUE(create_state_tracked_object_record(fence, fence.get<VkFenceCreateInfo>(), expectedInstanceObjects));
     }
-    ASSERT_TRUE(create_state_tracked_object_record(wsiManager.get_image_acquired_semaphore(), wsiManager.get_image_acquired_semaphore().get<VkSemaphoreCreateInfo>(), expectedInstanceObjects));
-    ASSERT_TRUE(create_state_tracked_object_record(wsiManager.get_image_rendered_semaphore(), wsiManager.get_image_rendered_semaphore().get<VkSemaphoreCreateInfo>(), expectedInstanceObjects));
+    for (const auto& semaphore : wsiManager.get_image_acquired_semaphores()) {
+        ASSERT_TRUE(create_state_tracked_object_record(semaphore, semaphore.get<VkSemaphoreCreateInfo>(), expectedInstanceObjects));
+    }
+    for (const auto& semaphore : wsiManager.get_image_rendered_semaphores()) {
+        ASSERT_TRUE(create_state_tracked_object_record(semaphore, semaphore.get<VkSemaphoreCreateInfo>(), expectedInstanceObjects));
+    }
 
     std::map<GvkStateTrackedObject, ObjectRecord> expectedImageDependencies;
     ASSERT_TRUE(create_state_tracked_object_record(wsiManager.get_swapchain(), wsiManager.get_swapchain().get<VkSwapchainCreateInfoKHR>(), expectedImageDependencies));
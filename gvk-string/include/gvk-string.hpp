@@ -27,5 +27,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "gvk-string/printer.hpp"
+#include "gvk-string/printer-buffer.hpp"
 #include "gvk-string/to-string.hpp"
 #include "gvk-string/utilities.hpp"
@@ -0,0 +1,328 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <locale>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace gvk {
+
+/**
+Provides a contiguous character buffer for Printer output
+    @note PrinterBuffer formats strings, characters, and integers directly into its buffer without going through std::ostream or std::locale
+    @note When given a target std::ostream, buffered output is written to the target in batches when the buffer reaches its flush threshold, when flush() is called, and when the PrinterBuffer is destroyed
+*/
+class PrinterBuffer final
+{
+public:
+    /**
+    The default number of buffered bytes that triggers a write to a PrinterBuffer object's target std::ostream
+    */
+    static constexpr size_t DefaultFlushThreshold = 64 * 1024;
+
+    /**
+    Constructs an instance of PrinterBuffer that accumulates output without a target std::ostream
+    */
+    inline PrinterBuffer() = default;
+
+    /**
+    Constructs an instance of PrinterBuffer that writes output to a given std::ostream
+    @param [in] ostrm The target std::ostream to write buffered output to
+    @param [in] flushThreshold (optional = PrinterBuffer::DefaultFlushThreshold) The number of buffered bytes that triggers a write to the target std::ostream
+    */
+    inline PrinterBuffer(std::ostream& ostrm, size_t flushThreshold = DefaultFlushThreshold)
+        : mpOstrm { &ostrm }
+        , mFlushThreshold { flushThreshold }
+    {
+        mBuffer.reserve(mFlushThreshold);
+    }
+
+    /**
+    Destroys this instance of PrinterBuffer, writing any buffered output to its target std::ostream
+    */
+    inline ~PrinterBuffer()
+    {
+        flush();
+    }
+
+    /**
+    Gets this PrinterBuffer object's buffered output
+    @return This PrinterBuffer object's buffered output
+    */
+    inline const std::string& get_string() const
+    {
+        return mBuffer;
+    }
+
+    /**
+    Moves this PrinterBuffer object's buffered output out of this PrinterBuffer
+    @return This PrinterBuffer object's buffered output
+    */
+    inline std::string release()
+    {
+        auto str = std::move(mBuffer);
+        mBuffer.clear();
+        return str;
+    }
+
+    /**
+    Reserves storage for a given number of bytes
+    @param [in] size The number of bytes to reserve storage for
+    */
+    inline void reserve(size_t size)
+    {
+        mBuffer.reserve(size);
+    }
+
+    /**
+    Writes any buffered output to this PrinterBuffer object's target std::ostream and flushes the target std::ostream
+        @note If this PrinterBuffer doesn't have a target std::ostream this method is a no-op
+    */
+    inline void flush()
+    {
+        if (mpOstrm) {
+            write_to_ostream();
+            mpOstrm->flush();
+        }
+    }
+
+    /**
+    Writes a given range of characters to this PrinterBuffer
+    @param [in] pData The characters to write
+    @param [in] size The number of characters to write
+    */
+    inline void write(const char* pData, size_t size)
+    {
+        mBuffer.append(pData, size);
+        on_write();
+    }
+
+    /**
+    Writes a given character to this PrinterBuffer
+    @param [in] c The character to write
+    */
+    inline void put(char c)
+    {
+        mBuffer.push_back(c);
+        on_write();
+    }
+
+    /**
+    Writes a given character to this PrinterBuffer a given number of times
+    @param [in] c The character to write
+    @param [in] count The number of times to write the given character
+    */
+    inline void fill(char c, size_t count)
+    {
+        mBuffer.append(count, c);
+        on_write();
+    }
+
+    /**
+    Writes a given range of bytes to this PrinterBuffer as lowercase hexadecimal characters
+    @param [in] pData The bytes to write
+    @param [in] size The number of bytes to write
+    */
+    inline void write_hex(const void* pData, size_t size)
+    {
+        static constexpr char Digits[] = "0123456789abcdef";
+        auto pBytes = (const uint8_t*)pData;
+        auto offset = mBuffer.size();
+        mBuffer.resize(offset + size * 2);
+        for (size_t i = 0; i < size; ++i) {
+            mBuffer[offset++] = Digits[pBytes[i] >> 4];
+            mBuffer[offset++] = Digits[pBytes[i] & 0xf];
+        }
+        on_write();
+    }
+
+    /**
+    Writes a given range of bytes to this PrinterBuffer as padded base64 characters
+    @param [in] pData The bytes to write
+    @param [in] size The number of bytes to write
+    */
+    inline void write_base64(const void* pData, size_t size)
+    {
+        static constexpr char Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        auto pBytes = (const uint8_t*)pData;
+        auto offset = mBuffer.size();
+        mBuffer.resize(offset + (size + 2) / 3 * 4);
+        size_t i = 0;
+        for (; i + 2 < size; i += 3) {
+            uint32_t bits = (uint32_t)pBytes[i] << 16 | (uint32_t)pBytes[i + 1] << 8 | (uint32_t)pBytes[i + 2];
+            mBuffer[offset++] = Digits[bits >> 18 & 0x3f];
+            mBuffer[offset++] = Digits[bits >> 12 & 0x3f];
+            mBuffer[offset++] = Digits[bits >> 6 & 0x3f];
+            mBuffer[offset++] = Digits[bits & 0x3f];
+        }
+        if (i < size) {
+            uint32_t bits = (uint32_t)pBytes[i] << 16 | (i + 1 < size ? (uint32_t)pBytes[i + 1] << 8 : 0);
+            mBuffer[offset++] = Digits[bits >> 18 & 0x3f];
+            mBuffer[offset++] = Digits[bits >> 12 & 0x3f];
+            mBuffer[offset++] = i + 1 < size ? Digits[bits >> 6 & 0x3f] : '=';
+            mBuffer[offset++] = '=';
+        }
+        on_write();
+    }
+
+    /**
+    Writes a given floating point value to this PrinterBuffer in scientific notation
+        @note Output matches std::ostream configured with std::scientific and std::setprecision()
+    @typename <FloatingPointType> The type of the floating point value to write
+    @param [in] value The floating point value to write
+    @param [in] precision The number of digits to write after the decimal point
+    */
+    template <typename FloatingPointType>
+    inline void write_scientific(FloatingPointType value, int precision)
+    {
+        static_assert(std::is_floating_point_v<FloatingPointType>);
+        char str[64] { };
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        auto result = std::to_chars(str, str + sizeof(str), value, std::chars_format::scientific, precision);
+        assert(result.ec == std::errc());
+        write(str, result.ptr - str);
+#else
+        int length = 0;
+        if constexpr (std::is_same_v<FloatingPointType, long double>) {
+            length = snprintf(str, sizeof(str), "%.*Le", precision, value);
+        } else {
+            length = snprintf(str, sizeof(str), "%.*e", precision, (double)value);
+        }
+        assert(0 < length && (size_t)length < sizeof(str));
+        write(str, (size_t)length);
+#endif
+    }
+
+    /**
+    Writes a given value to this PrinterBuffer
+        @note Strings, characters, bools, and integers are formatted directly into this PrinterBuffer, all other types are formatted with std::ostream using the classic locale
+    @typename <T> The type of the value to write
+    @param [in] value The value to write
+    @return This PrinterBuffer
+    */
+    template <typename T>
+    inline PrinterBuffer& operator<<(const T& value)
+    {
+        if constexpr (std::is_convertible_v<const T&, const char*>) {
+            const char* pStr = value;
+            if (pStr) {
+                write(pStr, std::char_traits<char>::length(pStr));
+            }
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            std::string_view str = value;
+            write(str.data(), str.size());
+        } else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>) {
+            put((char)value);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            put(value ? '1' : '0');
+        } else if constexpr (std::is_integral_v<T>) {
+            char str[24] { };
+            auto result = std::to_chars(str, str + sizeof(str), value);
+            assert(result.ec == std::errc());
+            write(str, result.ptr - str);
+        } else {
+            get_fallback_ostream() << value;
+            on_write();
+        }
+        return *this;
+    }
+
+private:
+    class StreamBuffer final
+        : public std::streambuf
+    {
+    public:
+        inline StreamBuffer(std::string& buffer)
+            : mBuffer { buffer }
+        {
+        }
+
+    protected:
+        inline int_type overflow(int_type c) override final
+        {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                mBuffer.push_back(traits_type::to_char_type(c));
+            }
+            return traits_type::not_eof(c);
+        }
+
+        inline std::streamsize xsputn(const char_type* pData, std::streamsize count) override final
+        {
+            mBuffer.append(pData, (size_t)count);
+            return count;
+        }
+
+    private:
+        std::string& mBuffer;
+    };
+
+    inline std::ostream& get_fallback_ostream()
+    {
+        if (!mupFallbackOstrm) {
+            mupStreamBuffer = std::make_unique<StreamBuffer>(mBuffer);
+            mupFallbackOstrm = std::make_unique<std::ostream>(mupStreamBuffer.get());
+            mupFallbackOstrm->imbue(std::locale::classic());
+        }
+        return *mupFallbackOstrm;
+    }
+
+    inline void on_write()
+    {
+        if (mpOstrm && mFlushThreshold <= mBuffer.size()) {
+            write_to_ostream();
+        }
+    }
+
+    inline void write_to_ostream()
+    {
+        assert(mpOstrm);
+        if (!mBuffer.empty()) {
+            mpOstrm->write(mBuffer.data(), (std::streamsize)mBuffer.size());
+            mBuffer.clear();
+        }
+    }
+
+    std::string mBuffer;
+    std::ostream* mpOstrm{ nullptr };
+    size_t mFlushThreshold{ DefaultFlushThreshold };
+    std::unique_ptr<StreamBuffer> mupStreamBuffer;
+    std::unique_ptr<std::ostream> mupFallbackOstrm;
+
+    PrinterBuffer(const PrinterBuffer&) = delete;
+    PrinterBuffer& operator=(const PrinterBuffer&) = delete;
+};
+
+} // namespace gvk
@@ -26,10 +26,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
+#include "gvk-string/printer-buffer.hpp"
+
 #include <cassert>
-#include <iterator>
-#include <iomanip>
+#include <charconv>
+#include <memory>
 #include <ostream>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -55,7 +58,7 @@ template <typename FlagBitsType>
 void print(gvk::Printer& printer, std::underlying_type_t<FlagBitsType> flags);
 
 /**
-Provides an interface for writing objects composed of name/value pairs to a std::ostream
+Provides an interface for writing objects composed of name/value pairs to a PrinterBuffer or std::ostream
 */
 class Printer
 {
@@ -69,6 +72,10 @@ public:
         FlushOnNewline = 1 << 1,
         EnumIdentifier = 1 << 2,
         EnumValue      = 1 << 3,
+        BlobHex        = 1 << 4,
+        BlobBase64     = 1 << 5,
+        BlobTruncate   = 1 << 6,
+        BlobFile       = 1 << 7,
         Default        = Formatted | FlushOnNewline | EnumIdentifier | EnumValue
     };
 
@@ -77,8 +84,20 @@ public:
     */
     using Flags = uint32_t;
 
+    /**
+    Options for printing arrays with print_blob() and print_array()
+        @note When Printer::FlagBits::BlobTruncate is set, arrays with more than truncateCount elements are printed as an object with the array's element count, a hash of the array's contents (for arrays of arithmetic or enum values), and the first truncateCount elements
+        @note When Printer::FlagBits::BlobFile is set and directory isn't empty, print_blob() writes array contents to a file in directory named by the hash of the contents and prints the file name in place of the array
+    */
+    struct BlobOptions
+    {
+        size_t truncateCount{ 16 };
+        std::string directory;
+    };
+
     /**
     Constructs an instance of Printer
+        @note Output is buffered and written to the given std::ostream in batches, when Printer::FlagBits::FlushOnNewline is set the given std::ostream is also flushed on each newline
     @param [in] ostrm The target std::ostream to print to
     @param [in] flags (optional = Printer::FlagBits::Default) Bitmask of Printer::FlagBits configuring printer output
     @param [in] tabCount (optional = 0) The tab count to begin printing at
@@ -86,7 +105,25 @@ public:
     @param [in] pUserData (optional = nullptr) A pointer to user data to pass along while printing
     */
     inline Printer(std::ostream& ostrm, Flags flags = Default, int tabCount = 0, int tabSize = 4, const void* pUserData = nullptr)
-        : mOstrm { ostrm }
+        : mupBuffer { std::make_unique<PrinterBuffer>(ostrm) }
+        , mBuffer { *mupBuffer }
+        , mFlags { flags }
+        , mTabCount { tabCount }
+        , mTabSize { tabSize }
+        , mpUserData { pUserData }
+    {
+    }
+
+    /**
+    Constructs an instance of Printer
+    @param [in] buffer The target PrinterBuffer to print to
+    @param [in] flags (optional = Printer::FlagBits::Default) Bitmask of Printer::FlagBits configuring printer output
+    @param [in] tabCount (optional = 0) The tab count to begin printing at
+    @param [in] tabSize (optional = 4) The tab size to use when printing tabs
+    @param [in] pUserData (optional = nullptr) A pointer to user data to pass along while printing
+    */
+    inline Printer(PrinterBuffer& buffer, Flags flags = Default, int tabCount = 0, int tabSize = 4, const void* pUserData = nullptr)
+        : mBuffer { buffer }
         , mFlags { flags }
         , mTabCount { tabCount }
         , mTabSize { tabSize }
@@ -101,6 +138,27 @@ public:
     {
     }
 
+    /**
+    Gets this Printer object's Printer::BlobOptions
+    @return This Printer object's Printer::BlobOptions
+    */
+    inline const BlobOptions& get_blob_options() const
+    {
+        static const BlobOptions sDefaultBlobOptions;
+        return mpBlobOptions ? *mpBlobOptions : sDefaultBlobOptions;
+    }
+
+    /**
+    Sets this Printer object's Printer::BlobOptions
+        @note Printer::BlobOptions are shared with the Printer objects created to print nested fields
+    @param [in] blobOptions The Printer::BlobOptions to use
+    */
+    inline void set_blob_options(const BlobOptions& blobOptions)
+    {
+        mupBlobOptions = std::make_unique<BlobOptions>(blobOptions);
+        mpBlobOptions = mupBlobOptions.get();
+    }
+
     /**
     Gets this Printer object's Printer::FlagBits
     */
@@ -131,7 +189,7 @@ public:
     {
         print_comma();
         print_name(pName);
-        Printer printer(mOstrm, mFlags, mTabCount, mTabSize, mpUserData);
+        Printer printer(mBuffer, mFlags, mTabCount, mTabSize, mpUserData, mpBlobOptions);
         print(printer, obj);
     }
 
@@ -148,10 +206,10 @@ public:
         print_comma();
         print_name(pName);
         if (pObj) {
-            Printer printer(mOstrm, mFlags, mTabCount, mTabSize, mpUserData);
+            Printer printer(mBuffer, mFlags, mTabCount, mTabSize, mpUserData, mpBlobOptions);
             print(printer, *pObj);
         } else {
-            mOstrm << "null";
+            mBuffer << "null";
         }
     }
 
@@ -171,21 +229,26 @@ public:
         print_comma();
         print_name(pName);
         if (count && pObjs) {
-            print_object(
-                '[',
-                [&]()
-                {
-                    for (CountType i = 0; i < count; ++i) {
-                        print_comma(i);
-                        print_newline();
-                        Printer printer(mOstrm, mFlags, mTabCount, mTabSize, mpUserData);
-                        processArrayElement(printer, pObjs[i]);
+            auto truncateCount = get_blob_options().truncateCount;
+            if (mFlags & BlobTruncate && truncateCount < (size_t)count) {
+                Printer printer(mBuffer, mFlags, mTabCount, mTabSize, mpUserData, mpBlobOptions);
+                printer.print_object(
+                    [&]()
+                    {
+                        printer.print_field("count", (size_t)count);
+                        if constexpr (std::is_arithmetic_v<ObjectType> || std::is_enum_v<ObjectType>) {
+                            printer.print_hash(pObjs, (size_t)count * sizeof(ObjectType));
+                        }
+                        printer.print_comma();
+                        printer.print_name("elements");
+                        printer.print_array_elements((CountType)truncateCount, pObjs, processArrayElement);
                     }
-                },
-                ']'
-            );
+                );
+            } else {
+                print_array_elements(count, pObjs, processArrayElement);
+            }
         } else {
-            mOstrm << "null";
+            mBuffer << "null";
         }
     }
 
@@ -220,6 +283,69 @@ public:
         }
     }
 
+    /**
+    Prints an array of trivially copyable objects if given a valid count and pointer, otherwise prints null
+        @note When none of Printer::FlagBits::BlobHex, Printer::FlagBits::BlobBase64, or Printer::FlagBits::BlobFile are set the array is printed with print_array()
+        @note Otherwise the array is printed as an object with its element count, byte size, content hash, and either its encoded bytes or the name of the file its bytes were written to
+    @typename <CountType> The type of the given array's count
+    @typename <ObjectType> The type of objects of the given array
+    @param [in] pName The name of the array
+    @param [in] count The number of objects in the array
+    @param [in] pObjs The array of objects
+    */
+    template <typename CountType, typename ObjectType>
+    inline void print_blob(const char* pName, CountType count, const ObjectType* pObjs)
+    {
+        static_assert(std::is_trivially_copyable_v<ObjectType>);
+        if (!(mFlags & (BlobHex | BlobBase64 | BlobFile)) || !count || !pObjs) {
+            print_array(
+                pName, count, pObjs,
+                [](Printer& printer, const ObjectType& obj)
+                {
+                    if constexpr (std::is_integral_v<ObjectType> && sizeof(ObjectType) == 1) {
+                        print(printer, (uint32_t)obj);
+                    } else {
+                        print(printer, obj);
+                    }
+                }
+            );
+        } else {
+            print_comma();
+            print_name(pName);
+            const auto& blobOptions = get_blob_options();
+            auto size = (size_t)count * sizeof(ObjectType);
+            Printer printer(mBuffer, mFlags, mTabCount, mTabSize, mpUserData, mpBlobOptions);
+            printer.print_object(
+                [&]()
+                {
+                    printer.print_field("count", (size_t)count);
+                    printer.print_field("size", size);
+                    auto hash = printer.print_hash(pObjs, size);
+                    std::string fileName;
+                    if (mFlags & BlobFile && !blobOptions.directory.empty()) {
+                        fileName = write_blob_file(blobOptions.directory, hash, pObjs, size);
+                    }
+                    if (!fileName.empty()) {
+                        printer.print_field("file", fileName);
+                    } else {
+                        if (mFlags & BlobTruncate && blobOptions.truncateCount < (size_t)count) {
+                            size = blobOptions.truncateCount * sizeof(ObjectType);
+                        }
+                        printer.print_comma();
+                        printer.print_name("data");
+                        printer.mBuffer.put('"');
+                        if (mFlags & BlobBase64) {
+                            printer.mBuffer.write_base64(pObjs, size);
+                        } else {
+                            printer.mBuffer.write_hex(pObjs, size);
+                        }
+                        printer.mBuffer.put('"');
+                    }
+                }
+            );
+        }
+    }
+
     /**
     Prints a collection of objects
     @typename <CollectionType> The type of the given collection
@@ -246,7 +372,7 @@ public:
                 for (const auto& element : collection) {
                     print_comma(elementCount++);
                     print_newline();
-                    Printer printer(mOstrm, mFlags, mTabCount, mTabSize, mpUserData);
+                    Printer printer(mBuffer, mFlags, mTabCount, mTabSize, mpUserData, mpBlobOptions);
                     print(printer, processCollectionItr(element));
                 }
             },
@@ -304,7 +430,7 @@ public:
     {
         print_comma();
         print_name(pIdentifier);
-        Printer printer(mOstrm, mFlags, mTabCount, mTabSize, mpUserData);
+        Printer printer(mBuffer, mFlags, mTabCount, mTabSize, mpUserData, mpBlobOptions);
         print<FlagBitsType>(printer, flags);
     }
 
@@ -328,18 +454,63 @@ public:
     }
 
 private:
+    inline Printer(PrinterBuffer& buffer, Flags flags, int tabCount, int tabSize, const void* pUserData, const BlobOptions* pBlobOptions)
+        : mBuffer { buffer }
+        , mFlags { flags }
+        , mTabCount { tabCount }
+        , mTabSize { tabSize }
+        , mpUserData { pUserData }
+        , mpBlobOptions { pBlobOptions }
+    {
+    }
+
+    static std::string write_blob_file(const std::string& directory, uint64_t hash, const void* pData, size_t size);
+
+    template <typename CountType, typename ObjectType, typename ProcessArrayElementFunctionType>
+    inline void print_array_elements(CountType count, const ObjectType* pObjs, ProcessArrayElementFunctionType processArrayElement)
+    {
+        print_object(
+            '[',
+            [&]()
+            {
+                for (CountType i = 0; i < count; ++i) {
+                    print_comma(i);
+                    print_newline();
+                    Printer printer(mBuffer, mFlags, mTabCount, mTabSize, mpUserData, mpBlobOptions);
+                    processArrayElement(printer, pObjs[i]);
+                }
+            },
+            ']'
+        );
+    }
+
+    inline uint64_t print_hash(const void* pData, size_t size)
+    {
+        auto hash = get_hash(pData, size);
+        char str[] = "\"0x0000000000000000\"";
+        auto result = std::to_chars(str + 3, str + sizeof(str) - 2, hash, 16);
+        assert(result.ec == std::errc());
+        *result.ptr++ = '"';
+        print_comma();
+        print_name("hash");
+        mBuffer.write(str, result.ptr - str);
+        return hash;
+    }
+
+    static uint64_t get_hash(const void* pData, size_t size);
+
     inline void print_name(const char* pName)
     {
         assert(pName);
         print_newline();
-        mOstrm << "\"" << pName << "\""; mOstrm << ":"; print_whitespace(1);
+        mBuffer << "\"" << pName << "\":"; print_whitespace(1);
     }
 
     template <typename IndexType>
     inline void print_comma(IndexType index)
     {
         if (index) {
-            mOstrm << ",";
+            mBuffer.put(',');
         }
     }
 
@@ -351,7 +522,7 @@ private:
     inline void print_whitespace(int count)
     {
         if (mFlags & Formatted) {
-            std::fill_n(std::ostream_iterator<char>(mOstrm), count, ' ');
+            mBuffer.fill(' ', (size_t)count);
         }
     }
 
@@ -363,10 +534,9 @@ private:
     inline void print_newline()
     {
         if (mFlags & Formatted) {
+            mBuffer.put('\n');
             if (mFlags & FlushOnNewline) {
-                mOstrm << std::endl;
-            } else {
-                mOstrm << "\n";
+                mBuffer.flush();
             }
             print_tab();
         }
@@ -375,20 +545,23 @@ private:
     template <typename PrintObjectFunctionType>
     inline void print_object(char openBrace, PrintObjectFunctionType printObject, char closeBrace)
     {
-        mOstrm << openBrace;
+        mBuffer.put(openBrace);
         ++mTabCount;
         printObject();
         --mTabCount;
         print_newline();
-        mOstrm << closeBrace;
+        mBuffer.put(closeBrace);
     }
 
-    std::ostream& mOstrm;
+    std::unique_ptr<PrinterBuffer> mupBuffer;
+    PrinterBuffer& mBuffer;
     Flags mFlags{ Default };
     int mTabCount{ };
     int mTabSize{ 4 };
     int mFieldCount{ };
     const void* mpUserData{ nullptr };
+    std::unique_ptr<BlobOptions> mupBlobOptions;
+    const BlobOptions* mpBlobOptions{ nullptr };
 
     template <typename ObjectType>
     friend void print(Printer&, const ObjectType&);
@@ -403,7 +576,7 @@ Prints a given object using a given Printer
 template <typename ObjectType>
 void print(Printer& printer, const ObjectType& obj)
 {
-    printer.mOstrm << obj;
+    printer.mBuffer << obj;
 }
 
 /**
@@ -427,9 +600,9 @@ template <>
 inline void print<const char*>(Printer& printer, const char* const& pStr)
 {
     if (pStr) {
-        printer.mOstrm << "\"" << pStr << "\"";
+        printer.mBuffer << "\"" << pStr << "\"";
     } else {
-        printer.mOstrm << "null";
+        printer.mBuffer << "null";
     }
 }
 
@@ -441,7 +614,7 @@ Prints a given std::string using a given Printer
 template <>
 inline void print<std::string>(Printer& printer, const std::string& str)
 {
-    printer.mOstrm << "\"" << str << "\"";
+    printer.mBuffer << "\"" << str << "\"";
 }
 
 /**
@@ -452,7 +625,7 @@ Prints a given bool using a given Printer
 template <>
 inline void print<bool>(Printer& printer, const bool& value)
 {
-    printer.mOstrm << (value ? "true" : "false");
+    printer.mBuffer << (value ? "true" : "false");
 }
 
 /**
@@ -463,7 +636,7 @@ Prints a given float using a given Printer
 template <>
 inline void print<float>(Printer& printer, const float& value)
 {
-    printer.mOstrm << std::scientific << std::setprecision(8) << value;
+    printer.mBuffer.write_scientific(value, 8);
 }
 
 /**
@@ -474,7 +647,7 @@ Prints a given double using a given Printer
 template <>
 inline void print<double>(Printer& printer, const double& value)
 {
-    printer.mOstrm << std::scientific << std::setprecision(16) << value;
+    printer.mBuffer.write_scientific(value, 16);
 }
 
 /**
@@ -485,7 +658,7 @@ Prints a given long double using a given Printer
 template <>
 inline void print<long double>(Printer& printer, const long double& value)
 {
-    printer.mOstrm << std::scientific << std::setprecision(32) << value;
+    printer.mBuffer.write_scientific(value, 32);
 }
 
 } // namespace gvk
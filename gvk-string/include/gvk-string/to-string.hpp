@@ -27,9 +27,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "gvk-string/printer.hpp"
+#include "gvk-string/printer-buffer.hpp"
 
+#include <charconv>
 #include <initializer_list>
-#include <sstream>
 #include <string>
 #include <utility>
 
@@ -47,10 +48,10 @@ Gets the std::string representation of a given object with a given configuration
 template <typename ObjectType>
 inline std::string to_string(const ObjectType& obj, Printer::Flags flags = Printer::Default, int tabCount = 0, int tabSize = 4)
 {
-    std::stringstream strStrm;
-    Printer printer(strStrm, flags, tabCount, tabSize);
+    PrinterBuffer buffer;
+    Printer printer(buffer, flags, tabCount, tabSize);
     print(printer, obj);
-    return strStrm.str();
+    return buffer.release();
 }
 
 /**
@@ -63,8 +64,9 @@ template <typename T>
 inline std::string to_hex_string(const T& value)
 {
     char str[] = "0x0000000000000000";
-    snprintf(str + 2, sizeof(str) - 2, "%llx", (long long unsigned int)value);
-    return str;
+    auto result = std::to_chars(str + 2, str + sizeof(str) - 1, (long long unsigned int)value, 16);
+    assert(result.ec == std::errc());
+    return std::string(str, result.ptr);
 }
 
 /**
@@ -79,14 +81,14 @@ Gets a std::string of concatenated bitmask flag identifiers
 template <typename FlagBitsType, typename FlagsType>
 inline std::string flags_to_string(FlagsType flags, std::initializer_list<std::pair<FlagBitsType, const char*>> flagIdentifiers)
 {
-    std::stringstream strStrm;
+    std::string str;
     for (const auto& flagIdentifier : flagIdentifiers) {
         if (flags & flagIdentifier.first) {
             assert(flagIdentifier.second);
-            strStrm << flagIdentifier.second << "|";
+            str += flagIdentifier.second;
+            str += '|';
         }
     }
-    auto str = strStrm.str();
     if (!str.empty()) {
         str.pop_back();
     }
@@ -261,6 +261,14 @@ Gets a 32-bit hash for a given string
 */
 uint32_t hash(const std::string& str);
 
+/**
+Gets a 64-bit hash for a given range of bytes
+@param [in] pData A pointer to the bytes to get the 64-bit hash for
+@param [in] size The number of bytes to get the 64-bit hash for
+@return The 64-bit hash of the given bytes
+*/
+uint64_t hash(const void* pData, size_t size);
+
 /**
 Converts a given string to a number of a specified type
 @typename T The type of number to convert the given string to
@@ -0,0 +1,90 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-string/printer.hpp"
+#include "gvk-string/utilities.hpp"
+
+#include <cassert>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+
+namespace gvk {
+
+std::string Printer::write_blob_file(const std::string& directory, uint64_t hash, const void* pData, size_t size)
+{
+    // NOTE : Blob files are named by the hash of their contents so identical blobs
+    //  printed from different objects share a single file.  An existing file is
+    //  only reused if its size matches, otherwise the hash collided with a
+    //  different blob and the file can't be used.
+    char str[16] { };
+    auto result = std::to_chars(str, str + sizeof(str), hash, 16);
+    assert(result.ec == std::errc());
+    auto fileName = std::string(str, result.ptr) + ".blob";
+    std::error_code errorCode;
+    auto path = std::filesystem::path(directory) / fileName;
+    auto isReusable = [&]()
+    {
+        auto fileSize = std::filesystem::file_size(path, errorCode);
+        return !errorCode && fileSize == size;
+    };
+    if (std::filesystem::exists(path, errorCode)) {
+        if (!isReusable()) {
+            return { };
+        }
+    } else {
+        std::filesystem::create_directories(directory, errorCode);
+        auto tmpPath = path;
+        tmpPath += "." + std::to_string(std::hash<const void*>()(pData)) + ".tmp";
+        std::ofstream file(tmpPath, std::ios::binary);
+        if (!file.is_open()) {
+            return { };
+        }
+        file.write((const char*)pData, (std::streamsize)size);
+        file.close();
+        // NOTE : A failed write or close may leave a partial temp file behind, it
+        //  must be removed so failed prints don't accumulate files in directory.
+        if (file.fail()) {
+            std::filesystem::remove(tmpPath, errorCode);
+            return { };
+        }
+        std::filesystem::rename(tmpPath, path, errorCode);
+        if (errorCode) {
+            std::filesystem::remove(tmpPath, errorCode);
+            if (!std::filesystem::exists(path, errorCode) || !isReusable()) {
+                return { };
+            }
+        }
+    }
+    return fileName;
+}
+
+uint64_t Printer::get_hash(const void* pData, size_t size)
+{
+    return string::hash(pData, size);
+}
+
+} // namespace gvk
@@ -247,5 +247,19 @@ uint32_t hash(const std::string& str)
     return hash;
 }
 
+uint64_t hash(const void* pData, size_t size)
+{
+    // 64-bit Fowler-Noll-Vo (FNV-1a) hash function
+    // https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+    const uint64_t FnvPrime = 1099511628211ull;
+    const uint64_t FnvOffsetBasis = 14695981039346656037ull;
+    auto hash = FnvOffsetBasis;
+    auto pBytes = (const uint8_t*)pData;
+    for (size_t i = 0; pBytes && i < size; ++i) {
+        hash = (hash ^ pBytes[i]) * FnvPrime;
+    }
+    return hash;
+}
+
 } // namespace string
 } // namespace gvk
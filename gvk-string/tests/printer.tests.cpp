@@ -25,10 +25,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 
 #include "gvk-string/printer.hpp"
+#include "gvk-string/printer-buffer.hpp"
 #include "gvk-string/to-string.hpp"
+#include "gvk-string/utilities.hpp"
 
 #include "gtest/gtest.h"
 
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
 class Foo final
 {
 public:
@@ -375,3 +381,157 @@ TEST(Printer, to_hex_string)
 {
     EXPECT_EQ(gvk::to_hex_string(3735928559), "0xdeadbeef");
 }
+
+TEST(PrinterBuffer, write)
+{
+    gvk::PrinterBuffer buffer;
+    buffer << "The" << ' ' << std::string("quick") << ' ' << (uint8_t)'b' << (int8_t)'r' << "own" << ' ';
+    buffer << -64 << ' ' << 64u << ' ' << (uint64_t)18446744073709551615ull << ' ' << true << false;
+    buffer.put(' ');
+    buffer.fill('-', 3);
+    buffer.put(' ');
+    buffer.write_scientific(3.14f, 8);
+    buffer.put(' ');
+    buffer.write_scientific(-2.5, 16);
+    EXPECT_EQ(buffer.get_string(), "The quick brown -64 64 18446744073709551615 10 --- 3.14000010e+00 -2.5000000000000000e+00");
+    EXPECT_EQ(buffer.release(), "The quick brown -64 64 18446744073709551615 10 --- 3.14000010e+00 -2.5000000000000000e+00");
+    EXPECT_TRUE(buffer.get_string().empty());
+}
+
+TEST(PrinterBuffer, flush)
+{
+    std::stringstream strStrm;
+    {
+        gvk::PrinterBuffer buffer(strStrm, 8);
+        buffer << "1234";
+        EXPECT_TRUE(strStrm.str().empty());
+        buffer << "5678";
+        EXPECT_EQ(strStrm.str(), "12345678");
+        EXPECT_TRUE(buffer.get_string().empty());
+        buffer << "90";
+        EXPECT_EQ(strStrm.str(), "12345678");
+        buffer.flush();
+        EXPECT_EQ(strStrm.str(), "1234567890");
+        buffer << "abc";
+    }
+    EXPECT_EQ(strStrm.str(), "1234567890abc");
+}
+
+TEST(PrinterBuffer, ostream)
+{
+    Foo foo{ };
+    foo.intValue = 64;
+    foo.floatValue = 3.14f;
+    Baz baz{ };
+    baz.pName = "Baz";
+    baz.pFoo = &foo;
+    for (auto flags : { gvk::Printer::Flags { 0 }, gvk::Printer::Flags { gvk::Printer::Formatted }, gvk::Printer::Flags { gvk::Printer::Default } }) {
+        std::stringstream strStrm;
+        {
+            gvk::Printer printer(strStrm, flags);
+            gvk::print(printer, baz);
+        }
+        EXPECT_EQ(strStrm.str(), gvk::to_string(baz, flags));
+    }
+}
+
+class Blob final
+{
+public:
+    size_t dataSize{ };
+    const uint8_t* pData{ nullptr };
+    size_t valueCount{ };
+    const uint32_t* pValues{ nullptr };
+};
+
+template <>
+void gvk::print<Blob>(gvk::Printer& printer, const Blob& obj)
+{
+    printer.print_object(
+        [&]()
+        {
+            printer.print_blob("pData", obj.dataSize, obj.pData);
+            printer.print_blob("pValues", obj.valueCount, obj.pValues);
+        }
+    );
+}
+
+TEST(Printer, print_blob)
+{
+    std::vector<uint8_t> data { 'g', 'v', 'k', 0xff };
+    std::vector<uint32_t> values(20);
+    for (uint32_t i = 0; i < values.size(); ++i) {
+        values[i] = i;
+    }
+    Blob blob { };
+    blob.dataSize = data.size();
+    blob.pData = data.data();
+    blob.valueCount = 2;
+    blob.pValues = values.data();
+    EXPECT_EQ(gvk::to_string(blob, 0), R"({"pData":[103,118,107,255],"pValues":[0,1]})");
+    auto dataHash = gvk::to_hex_string(gvk::string::hash(data.data(), data.size()));
+    auto valuesHash = gvk::to_hex_string(gvk::string::hash(values.data(), 2 * sizeof(uint32_t)));
+    EXPECT_EQ(gvk::to_string(blob, gvk::Printer::BlobHex), R"({"pData":{"count":4,"size":4,"hash":")" + dataHash + R"(","data":"67766bff"},"pValues":{"count":2,"size":8,"hash":")" + valuesHash + R"(","data":"0000000001000000"}})");
+    EXPECT_EQ(gvk::to_string(blob, gvk::Printer::BlobBase64), R"({"pData":{"count":4,"size":4,"hash":")" + dataHash + R"(","data":"Z3Zr/w=="},"pValues":{"count":2,"size":8,"hash":")" + valuesHash + R"(","data":"AAAAAAEAAAA="}})");
+
+    blob.dataSize = 0;
+    blob.valueCount = values.size();
+    valuesHash = gvk::to_hex_string(gvk::string::hash(values.data(), values.size() * sizeof(uint32_t)));
+    EXPECT_EQ(gvk::to_string(blob, gvk::Printer::BlobTruncate), R"({"pData":null,"pValues":{"count":20,"hash":")" + valuesHash + R"(","elements":[0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15]}})");
+    EXPECT_EQ(gvk::to_string(blob, gvk::Printer::BlobTruncate | gvk::Printer::BlobHex), R"({"pData":null,"pValues":{"count":20,"size":80,"hash":")" + valuesHash + R"(","data":"000000000100000002000000030000000400000005000000060000000700000008000000090000000a0000000b0000000c0000000d0000000e0000000f000000"}})");
+}
+
+TEST(Printer, print_blob_file)
+{
+    auto directory = std::filesystem::temp_directory_path() / "gvk-string.Printer.print_blob_file";
+    std::filesystem::remove_all(directory);
+    gvk::Printer::BlobOptions blobOptions { };
+    blobOptions.directory = directory.string();
+    auto printBlob = [&](const Blob& blob)
+    {
+        std::stringstream strStrm;
+        {
+            gvk::Printer printer(strStrm, gvk::Printer::BlobHex | gvk::Printer::BlobFile);
+            printer.set_blob_options(blobOptions);
+            gvk::print(printer, blob);
+        }
+        return strStrm.str();
+    };
+    std::vector<uint8_t> data { 'g', 'v', 'k', 0xff };
+    Blob blob { };
+    blob.dataSize = data.size();
+    blob.pData = data.data();
+    auto str = printBlob(blob);
+    EXPECT_NE(str.find(R"("file":")"), std::string::npos);
+    EXPECT_EQ(str.find(R"("data":")"), std::string::npos);
+    ASSERT_TRUE(std::filesystem::is_directory(directory));
+    std::filesystem::directory_iterator directoryItr(directory);
+    ASSERT_NE(directoryItr, std::filesystem::directory_iterator());
+    auto blobPath = directoryItr->path();
+    EXPECT_EQ(std::filesystem::file_size(blobPath), data.size());
+    EXPECT_EQ(printBlob(blob), str);
+
+    // An existing blob file with a matching name but a different size isn't reused
+    {
+        std::ofstream blobFile(blobPath, std::ios::binary | std::ios::trunc);
+        blobFile << "collision";
+    }
+    str = printBlob(blob);
+    EXPECT_EQ(str.find(R"("file":")"), std::string::npos);
+    EXPECT_NE(str.find(R"("data":"67766bff")"), std::string::npos);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(Printer, print_array_truncate_pointers)
+{
+    // NOTE : Pointer values differ from run to run so arrays of pointers are
+    //  truncated without a content hash.
+    std::vector<const char*> strs(20, "gvk");
+    std::stringstream strStrm;
+    {
+        gvk::Printer printer(strStrm, gvk::Printer::BlobTruncate);
+        printer.print_object([&]() { printer.print_array("ppStrs", strs.size(), strs.data()); });
+    }
+    EXPECT_EQ(strStrm.str().find(R"("hash":")"), std::string::npos);
+    EXPECT_NE(strStrm.str().find(R"("count":20)"), std::string::npos);
+}
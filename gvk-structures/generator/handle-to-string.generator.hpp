@@ -75,7 +75,7 @@ private:
                 CompileGuardGenerator compileGuardGenerator(file, handle.compileGuards);
                 file << string::replace("template <> void print<{handleType}>(Printer& printer, const {handleType}& handle)", "{handleType}", handle.name) << std::endl;
                 file << "{" << std::endl;
-                file << R"(    printer.mOstrm << "\"" << (handle ? to_hex_string(handle) : "VK_NULL_HANDLE") << "\"";)" << std::endl;
+                file << R"(    printer.mBuffer << "\"" << (handle ? to_hex_string(handle) : "VK_NULL_HANDLE") << "\"";)" << std::endl;
                 file << "}" << std::endl;
             }
         }
@@ -0,0 +1,88 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-cppgen.hpp"
+
+namespace gvk {
+namespace cppgen {
+
+class HashPNextGenerator final
+{
+public:
+    static void generate(const xml::Manifest& manifest)
+    {
+        FileGenerator file(GVK_STRUCTURES_GENERATED_SOURCE_PATH "/hash-pnext.cpp");
+        file << std::endl;
+        file << "#include \"gvk-structures/generated/core-structure-hash.hpp\"" << std::endl;
+        file << "#include \"gvk-structures/detail/hash-utilities.hpp\"" << std::endl;
+        file << std::endl;
+        file << "#include <cassert>" << std::endl;
+        file << std::endl;
+        NamespaceGenerator namespaceGenerator(file, "gvk::detail");
+        file << std::endl;
+        file << "uint64_t hash_pnext(const void* pNext, uint64_t seed, HashFlags flags)" << std::endl;
+        file << "{" << std::endl;
+        file << "    if (pNext) {" << std::endl;
+        generate_pnext_switch(
+            file,
+            manifest,
+            "        ",
+            "((const VkBaseInStructure*)pNext)->sType",
+            "return gvk::hash(*(const {structureType}*)pNext, seed, flags);",
+            "assert(false && \"Unsupported VkStructureType\");"
+        );
+        file << "        return hash_combine(seed, (uint64_t)((const VkBaseInStructure*)pNext)->sType);" << std::endl;
+        file << "    }" << std::endl;
+        file << "    return hash_combine(seed, 0);" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+        file << "bool equal_pnext(const void* pLhsNext, const void* pRhsNext, HashFlags flags)" << std::endl;
+        file << "{" << std::endl;
+        file << "    if (pLhsNext && pRhsNext) {" << std::endl;
+        file << "        auto lhsSType = ((const VkBaseInStructure*)pLhsNext)->sType;" << std::endl;
+        file << "        auto rhsSType = ((const VkBaseInStructure*)pRhsNext)->sType;" << std::endl;
+        file << "        if (lhsSType != rhsSType) {" << std::endl;
+        file << "            return false;" << std::endl;
+        file << "        }" << std::endl;
+        generate_pnext_switch(
+            file,
+            manifest,
+            "        ",
+            "lhsSType",
+            "return gvk::equal(*(const {structureType}*)pLhsNext, *(const {structureType}*)pRhsNext, flags);",
+            "assert(false && \"Unsupported VkStructureType\");"
+        );
+        file << "    }" << std::endl;
+        file << "    return !pLhsNext == !pRhsNext;" << std::endl;
+        file << "}" << std::endl;
+        file << std::endl;
+    }
+};
+
+} // namespace cppgen
+} // namespace gvk
@@ -32,26 +32,29 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "destroy-pnext-copy.generator.hpp"
 #include "enumerate-pnext-handles.generator.hpp"
 #include "get-object-type.generator.hpp"
+#include "get-pnext-copy-size.generator.hpp"
 #include "handle-to-string.generator.hpp"
+#include "hash-pnext.generator.hpp"
 #include "pnext-to-string.generator.hpp"
 #include "pnext-tuple-element-wrapper.generator.hpp"
 
 int main(int, const char*[])
 {
-    tinyxml2::XMLDocument xmlDocument;
-    auto xmlResult = xmlDocument.LoadFile(GVK_XML_FILE_PATH);
-    if (xmlResult == tinyxml2::XML_SUCCESS) {
-        gvk::xml::Manifest manifest(xmlDocument);
+    gvk::xml::Manifest manifest;
+    if (gvk::xml::load_manifest(GVK_XML_FILE_PATH, GVK_XML_MANIFEST_CACHE_DIRECTORY, manifest)) {
 
-        gvk::cppgen::CerealizePNextGenerator::generate(manifest);
-        gvk::cppgen::CreatePNextCopyGenerator::generate(manifest);
-        gvk::cppgen::DecerealizePNextGenerator::generate(manifest);
-        gvk::cppgen::DestroyPNextCopyGenerator::generate(manifest);
-        gvk::cppgen::EnumeratePNextHandlesGenerator::generate(manifest);
-        gvk::cppgen::GetObjectTypeGenerator::generate(manifest);
-        gvk::cppgen::HandleToStringGenerator::generate(manifest);
-        gvk::cppgen::PNextToStringGenerator::generate(manifest);
-        gvk::cppgen::PNextTupleElementWrapperGenerator::generate(manifest);
+        gvk::cppgen::ParallelGenerator generators;
+        generators.add([&]() { gvk::cppgen::CerealizePNextGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::CreatePNextCopyGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::DecerealizePNextGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::DestroyPNextCopyGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::EnumeratePNextHandlesGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::GetObjectTypeGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::GetPNextCopySizeGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::HandleToStringGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::HashPNextGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::PNextToStringGenerator::generate(manifest); });
+        generators.add([&]() { gvk::cppgen::PNextTupleElementWrapperGenerator::generate(manifest); });
 
         gvk::cppgen::ApiElementCollectionInfo apiElements { };
         apiElements.name = "core";
@@ -108,26 +111,29 @@ int main(int, const char*[])
         apiElements.manuallyImplemented.insert("VkPerformanceValueDataINTEL");
         apiElements.manuallyImplemented.insert("VkPipelineExecutableStatisticValueKHR");
 
-        gvk::cppgen::EnumerationToStringGenerator::generate(apiElements);
-        gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements);
-        gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureEnumerateHandlesGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements);
-        gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements);
+        generators.add([&]() { gvk::cppgen::EnumerationToStringGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureComparisonOperatorsGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureCreateCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDestroyCopyGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureEnumerateHandlesGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureGetSTypeGenerator::generate(apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureHashGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureMakeTupleGenerator::generate(manifest, apiElements); });
+        generators.add([&]() { gvk::cppgen::StructureToStringGenerator::generate(manifest, apiElements); });
 
         // Manually implemented serialization
-        apiElements.manuallyImplemented.insert("VkAccelerationStructureInstanceKHR");
-        apiElements.manuallyImplemented.insert("VkAccelerationStructureMatrixMotionInstanceNV");
-        apiElements.manuallyImplemented.insert("VkAccelerationStructureSRTMotionInstanceNV");
-        apiElements.manuallyImplemented.insert("VkSurfaceFullScreenExclusiveWin32InfoEXT");
-        apiElements.manuallyImplemented.insert("VkWin32SurfaceCreateInfoKHR");
+        auto serializationApiElements = apiElements;
+        serializationApiElements.manuallyImplemented.insert("VkAccelerationStructureInstanceKHR");
+        serializationApiElements.manuallyImplemented.insert("VkAccelerationStructureMatrixMotionInstanceNV");
+        serializationApiElements.manuallyImplemented.insert("VkAccelerationStructureSRTMotionInstanceNV");
+        serializationApiElements.manuallyImplemented.insert("VkSurfaceFullScreenExclusiveWin32InfoEXT");
+        serializationApiElements.manuallyImplemented.insert("VkWin32SurfaceCreateInfoKHR");
 
-        gvk::cppgen::StructureCerealizationGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, apiElements);
-        gvk::cppgen::StructureDeserializationGenerator::generate(apiElements);
-        gvk::cppgen::StructureSerializationGenerator::generate(apiElements);
+        generators.add([&]() { gvk::cppgen::StructureCerealizationGenerator::generate(manifest, serializationApiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDecerealizationGenerator::generate(manifest, serializationApiElements); });
+        generators.add([&]() { gvk::cppgen::StructureDeserializationGenerator::generate(serializationApiElements); });
+        generators.add([&]() { gvk::cppgen::StructureSerializationGenerator::generate(serializationApiElements); });
+        generators.wait();
     }
     return 0;
 }
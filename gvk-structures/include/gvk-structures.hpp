@@ -34,6 +34,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-structures/enumerate-handles.hpp"
 #include "gvk-structures/get-object-type.hpp"
 #include "gvk-structures/get-stype.hpp"
+#include "gvk-structures/hash.hpp"
 #include "gvk-structures/pnext.hpp"
 #include "gvk-structures/serialization.hpp"
 #include "gvk-structures/to-string.hpp"
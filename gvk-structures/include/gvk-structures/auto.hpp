@@ -34,6 +34,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace gvk {
 
+// NOTE : Auto<> stores its deep copy in a single reference counted arena (see
+//  gvk-structures/detail/arena-copy-utilities.hpp).  Copies of an Auto<> share
+//  the same arena, detach() must be used to get a mutable structure, it deep
+//  copies the arena if it is shared.
 template <typename StructureType>
 class Auto final
 {
@@ -41,7 +45,7 @@ public:
     Auto() = default;
 
     inline Auto(const StructureType& other)
-        : mStructure { detail::create_structure_copy(other, nullptr) }
+        : mpStructure { detail::create_structure_arena_copy(other, nullptr) }
     {
     }
 
@@ -64,7 +68,8 @@ public:
     {
         if (this != &other) {
             reset();
-            mStructure = detail::create_structure_copy(other.mStructure, nullptr);
+            detail::retain_arena_copy(other.mpStructure);
+            mpStructure = other.mpStructure;
         }
         return *this;
     }
@@ -72,35 +77,67 @@ public:
     inline Auto<StructureType>& operator=(Auto<StructureType>&& other)
     {
         if (this != &other) {
-            mStructure = other.mStructure;
-            other.mStructure = { };
+            reset();
+            mpStructure = other.mpStructure;
+            other.mpStructure = nullptr;
         }
         return *this;
     }
 
     inline operator const StructureType&() const
     {
-        return mStructure;
+        return mpStructure ? *mpStructure : get_empty_structure();
     }
 
     inline const StructureType& operator*() const
     {
-        return mStructure;
+        return mpStructure ? *mpStructure : get_empty_structure();
     }
 
     inline const StructureType* operator->() const
     {
-        return &mStructure;
+        return mpStructure ? mpStructure : &get_empty_structure();
+    }
+
+    inline bool is_shared() const
+    {
+        return 1 < detail::get_arena_copy_reference_count(mpStructure);
+    }
+
+    inline StructureType& detach()
+    {
+        if (!mpStructure || is_shared()) {
+            auto pStructure = detail::create_structure_arena_copy(**this, nullptr);
+            reset();
+            mpStructure = pStructure;
+        }
+        return *const_cast<StructureType*>(mpStructure);
     }
 
     inline void reset()
     {
-        detail::destroy_structure_copy(mStructure, nullptr);
-        mStructure = { };
+        detail::destroy_structure_arena_copy(mpStructure);
+        mpStructure = nullptr;
+    }
+
+    // NOTE : Takes ownership of an arena copy created by one of the
+    //  detail::*_arena_copy() functions
+    inline void reset(const StructureType* pArenaCopy)
+    {
+        if (mpStructure != pArenaCopy) {
+            reset();
+            mpStructure = pArenaCopy;
+        }
     }
 
 private:
-    StructureType mStructure { };
+    static inline const StructureType& get_empty_structure()
+    {
+        static const StructureType sEmptyStructure { };
+        return sEmptyStructure;
+    }
+
+    const StructureType* mpStructure { nullptr };
 };
 
 } // namespace gvk
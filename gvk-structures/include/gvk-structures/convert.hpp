@@ -38,8 +38,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 namespace gvk {
 namespace detail {
 
-// NOTE : These functions operate on Auto<> structures that we are allocating
-//  storage for and populating manually.  Auto<>'s dtor takes care of cleanup.
+// NOTE : These functions operate on structures that we are allocating storage for
+//  and populating manually.  The populated structures are copied into an Auto<>
+//  then cleaned up with detail::destroy_structure_copy().
 
 template <typename T>
 inline void set_stypes(uint32_t objCount, const T* pObjs)
@@ -179,8 +180,7 @@ inline Auto<DstType> convert(const SrcType& src)
 template<>
 inline Auto<VkRenderPassCreateInfo2> convert<VkRenderPassCreateInfo, VkRenderPassCreateInfo2>(const VkRenderPassCreateInfo& src)
 {
-    Auto<VkRenderPassCreateInfo2> dst;
-    auto& renderPassCreateInfo = const_cast<VkRenderPassCreateInfo2&>(*dst);
+    VkRenderPassCreateInfo2 renderPassCreateInfo { };
     detail::convert_render_pass_create_info<VkRenderPassCreateInfo, VkRenderPassCreateInfo2>(src, renderPassCreateInfo);
     renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2;
     renderPassCreateInfo.pNext = detail::create_pnext_copy(src.pNext, nullptr);
@@ -196,17 +196,20 @@ inline Auto<VkRenderPassCreateInfo2> convert<VkRenderPassCreateInfo, VkRenderPas
         }
     }
     detail::set_stypes(renderPassCreateInfo.dependencyCount, renderPassCreateInfo.pDependencies);
+    Auto<VkRenderPassCreateInfo2> dst(renderPassCreateInfo);
+    detail::destroy_structure_copy(renderPassCreateInfo, nullptr);
     return dst;
 }
 
 template<>
 inline Auto<VkRenderPassCreateInfo> convert<VkRenderPassCreateInfo2, VkRenderPassCreateInfo>(const VkRenderPassCreateInfo2& src)
 {
-    Auto<VkRenderPassCreateInfo> dst;
-    auto& renderPassCreateInfo = const_cast<VkRenderPassCreateInfo&>(*dst);
+    VkRenderPassCreateInfo renderPassCreateInfo { };
     detail::convert_render_pass_create_info<VkRenderPassCreateInfo2, VkRenderPassCreateInfo>(src, renderPassCreateInfo);
     renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
     renderPassCreateInfo.pNext = detail::create_pnext_copy(src.pNext, nullptr);
+    Auto<VkRenderPassCreateInfo> dst(renderPassCreateInfo);
+    detail::destroy_structure_copy(renderPassCreateInfo, nullptr);
     return dst;
 }
 
@@ -28,4 +28,5 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-structures/generated/core-structure-create-copy.hpp"
 #include "gvk-structures/generated/core-structure-destroy-copy.hpp"
+#include "gvk-structures/detail/arena-copy-utilities.hpp"
 #include "gvk-defines.hpp"
@@ -0,0 +1,115 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/detail/copy-utilities.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace gvk {
+namespace detail {
+
+// NOTE : Arena copies are created by measuring the total size of all nested
+//  allocations with get_structure_copy_size(), making a single allocation, then
+//  running create_structure_copy() once, placing the structure and all of its
+//  nested allocations linearly in the arena.  Arena copies are reference counted
+//  and are released with a single free.
+
+struct ArenaCopyHeader final
+{
+    std::atomic<uint32_t> referenceCount;
+    VkAllocationCallbacks allocator;
+};
+
+static constexpr size_t ArenaCopyStructureOffset = align_copy_allocation_size(sizeof(ArenaCopyHeader));
+
+// NOTE : ArenaCopyAllocator throws std::bad_alloc if an allocation would overrun
+//  the arena, create_structure_arena_copy() throws std::bad_alloc if the arena
+//  can't be allocated and releases the arena if the copy throws.
+class ArenaCopyAllocator final
+{
+public:
+    ArenaCopyAllocator(uint8_t* pData, size_t size);
+    const VkAllocationCallbacks& get_allocation_callbacks() const;
+    size_t get_allocation_size() const;
+
+private:
+    static void* VKAPI_PTR allocate(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+    static void VKAPI_PTR free(void* pUserData, void* pMemory);
+
+    VkAllocationCallbacks mAllocationCallbacks { };
+    uint8_t* mpData { };
+    size_t mSize { };
+    size_t mAllocationSize { };
+
+    ArenaCopyAllocator(const ArenaCopyAllocator&) = delete;
+    ArenaCopyAllocator& operator=(const ArenaCopyAllocator&) = delete;
+};
+
+void retain_arena_copy(const void* pObj);
+void release_arena_copy(const void* pObj);
+uint32_t get_arena_copy_reference_count(const void* pObj);
+
+template <typename StructureType>
+inline StructureType* create_structure_arena_copy(const StructureType& obj, const VkAllocationCallbacks* pAllocator)
+{
+    auto dataSize = get_structure_copy_size(obj);
+    pAllocator = validate_allocation_callbacks(pAllocator);
+    auto dataOffset = align_copy_allocation_size(ArenaCopyStructureOffset + sizeof(StructureType));
+    auto pArena = (uint8_t*)pAllocator->pfnAllocation(pAllocator->pUserData, dataOffset + dataSize, CopyAllocationAlignment, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    if (!pArena) {
+        throw std::bad_alloc();
+    }
+    auto pHeader = new(pArena) ArenaCopyHeader;
+    pHeader->referenceCount.store(1);
+    pHeader->allocator = *pAllocator;
+    ArenaCopyAllocator arenaAllocator(pArena + dataOffset, dataSize);
+    StructureType* pStructure = nullptr;
+    try {
+        pStructure = new(pArena + ArenaCopyStructureOffset) StructureType(create_structure_copy(obj, &arenaAllocator.get_allocation_callbacks()));
+    } catch (...) {
+        pHeader->~ArenaCopyHeader();
+        pAllocator->pfnFree(pAllocator->pUserData, pArena);
+        throw;
+    }
+    assert(arenaAllocator.get_allocation_size() == dataSize);
+    return pStructure;
+}
+
+template <typename StructureType>
+inline void destroy_structure_arena_copy(const StructureType* pObj)
+{
+    release_arena_copy(pObj);
+}
+
+} // namespace detail
+} // namespace gvk
@@ -588,7 +588,9 @@ inline void load(ArchiveType& archive, VkShaderCreateInfoEXT& obj)
     archive(obj.nextStage);
     archive(obj.codeType);
     archive(obj.codeSize);
-    obj.pCode = gvk::detail::decerealize_dynamic_array<uint8_t>(archive);
+    // NOTE : SPIR-V must be 4 byte aligned, aliased code is aligned accordingly
+    auto codeAlignment = obj.codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT ? alignof(uint32_t) : alignof(uint8_t);
+    obj.pCode = gvk::detail::decerealize_dynamic_array<uint8_t>(archive, codeAlignment);
     obj.pName = gvk::detail::decerealize_dynamic_string(archive);
     archive(obj.setLayoutCount);
     obj.pSetLayouts = gvk::detail::decerealize_dynamic_handle_array<VkDescriptorSetLayout>(archive);
@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-defines.hpp"
 #include "gvk-structures/detail/copy-utilities.hpp"
 #include "gvk-structures/detail/get-count.hpp"
+#include "gvk-structures/detail/mapped-binary-input-archive.hpp"
 
 #include "cereal/archives/binary.hpp"
 #include "cereal/types/common.hpp"
@@ -53,6 +54,41 @@ namespace detail {
 
 extern thread_local const VkAllocationCallbacks* tlpDecerealizationAllocator;
 
+// NOTE : Arrays of BinaryCerealizable objects are archived with a single
+//  cereal::binary_data() instead of element by element.  Arithmetic and enum
+//  types are BinaryCerealizable, structures are specialized in the generated
+//  cerealization headers when all of their members are BinaryCerealizable and
+//  they have no padding, so the archived bytes are identical either way.
+template <typename ObjectType>
+struct BinaryCerealizable
+    : std::integral_constant<bool, std::is_arithmetic<ObjectType>::value || std::is_enum<ObjectType>::value>
+{
+};
+
+template <typename ArchiveType, typename ObjectType>
+inline void cerealize_array_elements(ArchiveType& archive, size_t count, const ObjectType* pObjs)
+{
+    if constexpr (BinaryCerealizable<ObjectType>::value) {
+        archive(cereal::binary_data(pObjs, count * sizeof(ObjectType)));
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            archive(pObjs[i]);
+        }
+    }
+}
+
+template <typename ArchiveType, typename ObjectType>
+inline void decerealize_array_elements(ArchiveType& archive, size_t count, ObjectType* pObjs)
+{
+    if constexpr (BinaryCerealizable<ObjectType>::value) {
+        archive(cereal::binary_data(pObjs, count * sizeof(ObjectType)));
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            archive(pObjs[i]);
+        }
+    }
+}
+
 template <typename ArchiveType>
 void cerealize_pnext(ArchiveType& archive, const void* const& pNext);
 
@@ -70,9 +106,7 @@ inline void cerealize_dynamic_array(ArchiveType& archive, size_t count, const Ob
 {
     if (count && pObjs) {
         archive(count);
-        for (size_t i = 0; i < count; ++i) {
-            archive(pObjs[i]);
-        }
+        cerealize_array_elements(archive, count, pObjs);
     } else {
         archive(size_t{ 0 });
     }
@@ -136,9 +170,7 @@ inline void cerealize_dynamic_string_array(ArchiveType& archive, size_t count, c
 template <size_t Count, typename ArchiveType, typename ObjectType>
 inline void cerealize_static_array(ArchiveType& archive, const ObjectType* pObjs)
 {
-    for (size_t i = 0; i < Count; ++i) {
-        archive(pObjs[i]);
-    }
+    cerealize_array_elements(archive, Count, pObjs);
 }
 
 template <size_t Count, typename ArchiveType, typename HandleType>
@@ -157,19 +189,26 @@ inline HandleType decerealize_handle(ArchiveType& archive)
     return (HandleType)decerealizedHandle;
 }
 
+// NOTE : alignment can be used to request stricter alignment than alignof(ObjectType)
+//  for aliased arrays, allocated arrays are always aligned to the allocator's
+//  alignment (ie. CopyAllocationAlignment for arena copies).
 template <typename ObjectType, typename ArchiveType>
-inline ObjectType* decerealize_dynamic_array(ArchiveType& archive)
+inline ObjectType* decerealize_dynamic_array(ArchiveType& archive, size_t alignment = alignof(ObjectType))
 {
     ObjectType* pObjs = nullptr;
     size_t count = 0;
     archive(count);
     if (count) {
+        if constexpr (BinaryCerealizable<ObjectType>::value && std::is_same<ArchiveType, MappedBinaryInputArchive>::value) {
+            pObjs = (ObjectType*)archive.alias(count * sizeof(ObjectType), alignment);
+            if (pObjs) {
+                return pObjs;
+            }
+        }
         assert(tlpDecerealizationAllocator);
         auto pAllocator = tlpDecerealizationAllocator;
         pObjs = (ObjectType*)pAllocator->pfnAllocation(pAllocator->pUserData, count * sizeof(ObjectType), 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
-        for (size_t i = 0; i < count; ++i) {
-            archive(pObjs[i]);
-        }
+        decerealize_array_elements(archive, count, pObjs);
     }
     return pObjs;
 }
@@ -245,9 +284,7 @@ inline CharType** decerealize_dynamic_string_array(ArchiveType& archive)
 template <size_t Count, typename ArchiveType, typename ObjectType>
 inline void decerealize_static_array(ArchiveType& archive, ObjectType* pObjs)
 {
-    for (size_t i = 0; i < Count; ++i) {
-        archive(pObjs[i]);
-    }
+    decerealize_array_elements(archive, Count, pObjs);
 }
 
 template <size_t Count, typename ArchiveType, typename HandleType>
@@ -29,12 +29,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-defines.hpp"
 
 #include <cassert>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 
 #define GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VK_STRUCTURE_TYPE)                                                                             \
 template <> VK_STRUCTURE_TYPE create_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE& obj, const VkAllocationCallbacks*) { return obj; } \
-template <> void destroy_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&, const VkAllocationCallbacks*) { }
+template <> void destroy_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&, const VkAllocationCallbacks*) { }                             \
+template <> size_t get_structure_copy_size<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&) { return 0; }
 
 #define GVK_STUB_STRUCTURE_COPY_FUNCTIONS(VK_STRUCTURE_TYPE)                                                                       \
 template <> VK_STRUCTURE_TYPE create_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE& obj, const VkAllocationCallbacks*) \
@@ -46,13 +48,30 @@ template <> VK_STRUCTURE_TYPE create_structure_copy<VK_STRUCTURE_TYPE>(const VK_
 template <> void destroy_structure_copy<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&, const VkAllocationCallbacks*)                 \
 {                                                                                                                                  \
     assert(false && "gvk::detail::destroy_structure_copy<" #VK_STRUCTURE_TYPE ">() unserviced; gvk maintenance required");         \
+}                                                                                                                                  \
+                                                                                                                                   \
+template <> size_t get_structure_copy_size<VK_STRUCTURE_TYPE>(const VK_STRUCTURE_TYPE&)                                            \
+{                                                                                                                                  \
+    assert(false && "gvk::detail::get_structure_copy_size<" #VK_STRUCTURE_TYPE ">() unserviced; gvk maintenance required");        \
+    return 0;                                                                                                                      \
 }
 
 namespace gvk {
 namespace detail {
 
+// NOTE : Every allocation made by create_structure_copy() is padded to
+//  CopyAllocationAlignment when measured by get_structure_copy_size(), so the
+//  returned size can back a linear allocator that services an entire copy.
+static constexpr size_t CopyAllocationAlignment = alignof(std::max_align_t);
+
+inline constexpr size_t align_copy_allocation_size(size_t size)
+{
+    return (size + CopyAllocationAlignment - 1) & ~(CopyAllocationAlignment - 1);
+}
+
 void* create_pnext_copy(const void* pNext, const VkAllocationCallbacks* pAllocator);
 void destroy_pnext_copy(const void* pNext, const VkAllocationCallbacks* pAllocator);
+size_t get_pnext_copy_size(const void* pNext);
 
 template <typename ObjectType>
 inline ObjectType create_structure_copy(const ObjectType& obj, const VkAllocationCallbacks*)
@@ -65,6 +84,12 @@ inline void destroy_structure_copy(const ObjectType&, const VkAllocationCallback
 {
 }
 
+template <typename ObjectType>
+inline size_t get_structure_copy_size(const ObjectType&)
+{
+    return 0;
+}
+
 inline const VkAllocationCallbacks* validate_allocation_callbacks(const VkAllocationCallbacks* pAllocator)
 {
     static const VkAllocationCallbacks sAllocator{
@@ -217,9 +242,75 @@ inline void destroy_static_array_copy(const ObjectType* pObjs, const VkAllocatio
     }
 }
 
+template <typename CountType, typename ObjectType>
+inline size_t get_dynamic_array_copy_size(CountType objCount, const ObjectType* pObjs)
+{
+    size_t size = 0;
+    if (objCount && pObjs) {
+        size += align_copy_allocation_size(objCount * sizeof(ObjectType));
+        for (CountType i = 0; i < objCount; ++i) {
+            size += get_structure_copy_size(pObjs[i]);
+        }
+    }
+    return size;
+}
+
+template <typename CountType, typename ObjectType>
+inline size_t get_dynamic_pointer_array_copy_size(CountType objCount, const ObjectType* const* ppObjs)
+{
+    size_t size = 0;
+    if (objCount && ppObjs) {
+        size += align_copy_allocation_size(objCount * sizeof(ObjectType*));
+        for (CountType i = 0; i < objCount; ++i) {
+            size += get_dynamic_array_copy_size(1, ppObjs[i]);
+        }
+    }
+    return size;
+}
+
+template <typename CharType>
+inline size_t get_dynamic_string_copy_size(const CharType* pStr)
+{
+    size_t size = 0;
+    if (pStr) {
+        auto pEnd = pStr;
+        while (*pEnd) {
+            ++pEnd;
+        }
+        size += align_copy_allocation_size(sizeof(CharType) * (pEnd - pStr + 1));
+    }
+    return size;
+}
+
+template <typename CountType, typename CharType>
+inline size_t get_dynamic_string_array_copy_size(CountType strCount, const CharType* const* ppStrs)
+{
+    size_t size = 0;
+    if (strCount && ppStrs) {
+        size += align_copy_allocation_size(sizeof(CharType*) * strCount);
+        for (CountType i = 0; i < strCount; ++i) {
+            size += get_dynamic_string_copy_size(ppStrs[i]);
+        }
+    }
+    return size;
+}
+
+template <size_t Count, typename ObjectType>
+inline size_t get_static_array_copy_size(const ObjectType* pObjs)
+{
+    assert(Count);
+    assert(pObjs);
+    size_t size = 0;
+    for (size_t i = 0; i < Count; ++i) {
+        size += get_structure_copy_size(pObjs[i]);
+    }
+    return size;
+}
+
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 template <> SECURITY_ATTRIBUTES create_structure_copy<SECURITY_ATTRIBUTES>(const SECURITY_ATTRIBUTES& obj, const VkAllocationCallbacks* pAllocator);
 template <> void destroy_structure_copy<SECURITY_ATTRIBUTES>(const SECURITY_ATTRIBUTES& obj, const VkAllocationCallbacks* pAllocator);
+template <> size_t get_structure_copy_size<SECURITY_ATTRIBUTES>(const SECURITY_ATTRIBUTES& obj);
 #endif
 
 } // namespace detail
@@ -0,0 +1,49 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace gvk {
+
+/**
+Bitmask specifying configuration options for gvk::hash() and gvk::equal()
+    @note HashIgnoreHandles excludes Vulkan handle values from hashes and comparisons so that structures that only
+        differ by handle values hash and compare equal, operator==() always compares handle values so hash containers
+        using gvk::Hash<> with HashIgnoreHandles should also use gvk::Equal<> with HashIgnoreHandles
+*/
+enum HashFlagBits
+{
+    HashIgnoreHandles = 1,
+};
+
+/**
+Bitmask of gvk::HashFlagBits
+*/
+using HashFlags = uint32_t;
+
+} // namespace gvk
@@ -0,0 +1,313 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/generated/core-structure-hash.hpp"
+#include "gvk-structures/detail/hash-flags.hpp"
+#include "gvk-structures/detail/make-tuple-utilities.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace gvk {
+namespace detail {
+
+inline uint64_t hash_combine(uint64_t seed, uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ull;
+    value ^= value >> 33;
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+uint64_t hash_bytes(const void* pData, size_t size, uint64_t seed);
+uint64_t hash_string(const char* pStr, uint64_t seed);
+uint64_t hash_string(const wchar_t* pwStr, uint64_t seed);
+uint64_t hash_string_array(size_t count, const char* const* ppStrs, uint64_t seed);
+uint64_t hash_pnext(const void* pNext, uint64_t seed, HashFlags flags);
+bool equal_pnext(const void* pLhsNext, const void* pRhsNext, HashFlags flags);
+
+template <typename T>
+inline uint64_t hash_value(const T& value, uint64_t seed, HashFlags flags)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        // NOTE : -0.0 and 0.0 compare equal so they must hash equal
+        double normalized = value == 0 ? 0.0 : (double)value;
+        uint64_t bits = 0;
+        memcpy(&bits, &normalized, sizeof(bits));
+        return hash_combine(seed, bits);
+    } else if constexpr (std::is_enum_v<T> || std::is_integral_v<T>) {
+        return hash_combine(seed, (uint64_t)value);
+    } else if constexpr (std::is_pointer_v<T>) {
+        // NOTE : Vulkan handles are routed through hash_handle() and
+        //  HandleTupleElementWrapper<>, so any remaining pointers are hashed by
+        //  address regardless of HashIgnoreHandles.
+        return hash_combine(seed, (uint64_t)(uintptr_t)value);
+    } else {
+        return gvk::hash(value, seed, flags);
+    }
+}
+
+template <typename T>
+inline uint64_t hash_handle(const T& handle, uint64_t seed, HashFlags flags)
+{
+    return flags & HashIgnoreHandles ? seed : hash_combine(seed, (uint64_t)handle);
+}
+
+template <typename T>
+inline uint64_t hash_value(const HandleTupleElementWrapper<T>& value, uint64_t seed, HashFlags flags)
+{
+    return hash_handle(value.handle, seed, flags);
+}
+
+template <typename T>
+inline uint64_t hash_array(size_t count, const T* pValues, uint64_t seed, HashFlags flags)
+{
+    count = count && pValues ? count : 0;
+    if constexpr (std::is_enum_v<T> || std::is_integral_v<T>) {
+        return hash_bytes(pValues, count * sizeof(T), seed);
+    } else {
+        seed = hash_combine(seed, count);
+        for (size_t i = 0; i < count; ++i) {
+            seed = hash_value(pValues[i], seed, flags);
+        }
+        return seed;
+    }
+}
+
+template <typename T>
+inline uint64_t hash_handle_array(size_t count, const T* pHandles, uint64_t seed, HashFlags flags)
+{
+    count = count && pHandles ? count : 0;
+    if (flags & HashIgnoreHandles) {
+        return hash_combine(seed, count);
+    }
+    seed = hash_combine(seed, count);
+    for (size_t i = 0; i < count; ++i) {
+        seed = hash_combine(seed, (uint64_t)pHandles[i]);
+    }
+    return seed;
+}
+
+template <typename T>
+inline uint64_t hash_tuple_element(const T& value, uint64_t seed, HashFlags flags)
+{
+    return hash_value(value, seed, flags);
+}
+
+template <typename T>
+inline uint64_t hash_tuple_element(const HandleTupleElementWrapper<T>& value, uint64_t seed, HashFlags flags)
+{
+    return hash_handle(value.handle, seed, flags);
+}
+
+template <typename T>
+inline uint64_t hash_tuple_element(const ArrayTupleElementWrapper<T>& value, uint64_t seed, HashFlags flags)
+{
+    return hash_array(value.count, value.ptr, seed, flags);
+}
+
+template <typename T>
+inline uint64_t hash_tuple_element(const PointerArrayTupleElementWrapper<T>& value, uint64_t seed, HashFlags flags)
+{
+    auto count = value.count && value.ptr ? value.count : 0;
+    seed = hash_combine(seed, count);
+    for (size_t i = 0; i < count; ++i) {
+        seed = hash_array(1, value.ptr[i], seed, flags);
+    }
+    return seed;
+}
+
+inline uint64_t hash_tuple_element(const StringTupleElementWrapper& value, uint64_t seed, HashFlags)
+{
+    return hash_string(value.pStr, seed);
+}
+
+inline uint64_t hash_tuple_element(const WStringTupleElementWrapper& value, uint64_t seed, HashFlags)
+{
+    return hash_string(value.pwStr, seed);
+}
+
+inline uint64_t hash_tuple_element(const StringArrayTupleElementWrapper& value, uint64_t seed, HashFlags)
+{
+    return hash_string_array(value.count, value.ppStrs, seed);
+}
+
+inline uint64_t hash_tuple_element(const PNextTupleElementWrapper& value, uint64_t seed, HashFlags flags)
+{
+    return hash_pnext(value.pNext, seed, flags);
+}
+
+template <typename ...Ts>
+inline uint64_t hash_tuple(const std::tuple<Ts...>& tuple, uint64_t seed, HashFlags flags)
+{
+    std::apply([&](const auto& ...elements) { ((seed = hash_tuple_element(elements, seed, flags)), ...); }, tuple);
+    return seed;
+}
+
+// NOTE : The equal_*() functions mirror the hash_*() functions above, they match
+//  the generated comparison operators except that HashIgnoreHandles is honored.
+
+template <typename T>
+inline bool equal_value(const T& lhs, const T& rhs, HashFlags flags)
+{
+    if constexpr (std::is_floating_point_v<T> || std::is_enum_v<T> || std::is_integral_v<T> || std::is_pointer_v<T>) {
+        (void)flags;
+        return lhs == rhs;
+    } else {
+        return gvk::equal(lhs, rhs, flags);
+    }
+}
+
+template <typename T>
+inline bool equal_handle(const T& lhs, const T& rhs, HashFlags flags)
+{
+    return flags & HashIgnoreHandles || lhs == rhs;
+}
+
+template <typename T>
+inline bool equal_value(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs, HashFlags flags)
+{
+    return equal_handle(lhs.handle, rhs.handle, flags);
+}
+
+template <typename T>
+inline bool equal_array(size_t lhsCount, const T* pLhsValues, size_t rhsCount, const T* pRhsValues, HashFlags flags)
+{
+    lhsCount = lhsCount && pLhsValues ? lhsCount : 0;
+    rhsCount = rhsCount && pRhsValues ? rhsCount : 0;
+    if (lhsCount != rhsCount) {
+        return false;
+    }
+    for (size_t i = 0; i < lhsCount; ++i) {
+        if (!equal_value(pLhsValues[i], pRhsValues[i], flags)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline bool equal_handle_array(size_t lhsCount, const T* pLhsHandles, size_t rhsCount, const T* pRhsHandles, HashFlags flags)
+{
+    lhsCount = lhsCount && pLhsHandles ? lhsCount : 0;
+    rhsCount = rhsCount && pRhsHandles ? rhsCount : 0;
+    if (lhsCount != rhsCount) {
+        return false;
+    }
+    if (flags & HashIgnoreHandles) {
+        return true;
+    }
+    return std::equal(pLhsHandles, pLhsHandles + lhsCount, pRhsHandles);
+}
+
+inline bool equal_string(const char* pLhsStr, const char* pRhsStr)
+{
+    return StringTupleElementWrapper { pLhsStr } == StringTupleElementWrapper { pRhsStr };
+}
+
+inline bool equal_string_array(size_t lhsCount, const char* const* ppLhsStrs, size_t rhsCount, const char* const* ppRhsStrs)
+{
+    return StringArrayTupleElementWrapper { lhsCount, ppLhsStrs } == StringArrayTupleElementWrapper { rhsCount, ppRhsStrs };
+}
+
+template <typename T>
+inline bool equal_tuple_element(const T& lhs, const T& rhs, HashFlags flags)
+{
+    return equal_value(lhs, rhs, flags);
+}
+
+template <typename T>
+inline bool equal_tuple_element(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs, HashFlags flags)
+{
+    return equal_handle(lhs.handle, rhs.handle, flags);
+}
+
+template <typename T>
+inline bool equal_tuple_element(const ArrayTupleElementWrapper<T>& lhs, const ArrayTupleElementWrapper<T>& rhs, HashFlags flags)
+{
+    return equal_array(lhs.count, lhs.ptr, rhs.count, rhs.ptr, flags);
+}
+
+template <typename T>
+inline bool equal_tuple_element(const PointerArrayTupleElementWrapper<T>& lhs, const PointerArrayTupleElementWrapper<T>& rhs, HashFlags flags)
+{
+    auto lhsCount = lhs.count && lhs.ptr ? lhs.count : 0;
+    auto rhsCount = rhs.count && rhs.ptr ? rhs.count : 0;
+    if (lhsCount != rhsCount) {
+        return false;
+    }
+    for (size_t i = 0; i < lhsCount; ++i) {
+        if (!equal_array(1, lhs.ptr[i], 1, rhs.ptr[i], flags)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool equal_tuple_element(const StringTupleElementWrapper& lhs, const StringTupleElementWrapper& rhs, HashFlags)
+{
+    return lhs == rhs;
+}
+
+inline bool equal_tuple_element(const WStringTupleElementWrapper& lhs, const WStringTupleElementWrapper& rhs, HashFlags)
+{
+    return lhs == rhs;
+}
+
+inline bool equal_tuple_element(const StringArrayTupleElementWrapper& lhs, const StringArrayTupleElementWrapper& rhs, HashFlags)
+{
+    return lhs == rhs;
+}
+
+inline bool equal_tuple_element(const PNextTupleElementWrapper& lhs, const PNextTupleElementWrapper& rhs, HashFlags flags)
+{
+    return equal_pnext(lhs.pNext, rhs.pNext, flags);
+}
+
+template <typename ...Ts, size_t ...Is>
+inline bool equal_tuple(const std::tuple<Ts...>& lhs, const std::tuple<Ts...>& rhs, HashFlags flags, std::index_sequence<Is...>)
+{
+    (void)flags;
+    return (equal_tuple_element(std::get<Is>(lhs), std::get<Is>(rhs), flags) && ...);
+}
+
+template <typename ...Ts>
+inline bool equal_tuple(const std::tuple<Ts...>& lhs, const std::tuple<Ts...>& rhs, HashFlags flags)
+{
+    return equal_tuple(lhs, rhs, flags, std::index_sequence_for<Ts...> { });
+}
+
+} // namespace detail
+} // namespace gvk
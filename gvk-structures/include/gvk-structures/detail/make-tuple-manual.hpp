@@ -90,7 +90,7 @@ inline auto make_tuple(const VkImportFenceWin32HandleInfoKHR& obj)
     return std::make_tuple(
         obj.sType,
         detail::PNextTupleElementWrapper { obj.pNext },
-        obj.fence,
+        detail::HandleTupleElementWrapper<VkFence> { obj.fence },
         obj.flags,
         obj.handleType,
         obj.handle,
@@ -124,7 +124,7 @@ inline auto make_tuple(const VkImportSemaphoreWin32HandleInfoKHR& obj)
     return std::make_tuple(
         obj.sType,
         detail::PNextTupleElementWrapper { obj.pNext },
-        obj.semaphore,
+        detail::HandleTupleElementWrapper<VkSemaphore> { obj.semaphore },
         obj.flags,
         obj.handleType,
         obj.handle,
@@ -216,8 +216,8 @@ inline auto make_tuple(const VkAccelerationStructureBuildGeometryInfoKHR& obj)
         obj.type,
         obj.flags,
         obj.mode,
-        obj.srcAccelerationStructure,
-        obj.dstAccelerationStructure,
+        detail::HandleTupleElementWrapper<VkAccelerationStructureKHR> { obj.srcAccelerationStructure },
+        detail::HandleTupleElementWrapper<VkAccelerationStructureKHR> { obj.dstAccelerationStructure },
         obj.geometryCount,
         detail::ArrayTupleElementWrapper<VkAccelerationStructureGeometryKHR>{ (size_t)obj.geometryCount, obj.pGeometries },
         detail::PointerArrayTupleElementWrapper<VkAccelerationStructureGeometryKHR>{ (size_t)obj.geometryCount, obj.ppGeometries },
@@ -245,7 +245,7 @@ inline auto make_tuple(const VkAccelerationStructureTrianglesDisplacementMicroma
         obj.usageCountsCount,
         detail::ArrayTupleElementWrapper<VkMicromapUsageEXT> { (size_t)obj.usageCountsCount, obj.pUsageCounts },
         detail::PointerArrayTupleElementWrapper<VkMicromapUsageEXT> { (size_t)obj.usageCountsCount, obj.ppUsageCounts },
-        obj.micromap
+        detail::HandleTupleElementWrapper<VkMicromapEXT> { obj.micromap }
     );
 }
 
@@ -261,7 +261,7 @@ inline auto make_tuple(const VkAccelerationStructureTrianglesOpacityMicromapEXT&
         obj.usageCountsCount,
         detail::ArrayTupleElementWrapper<VkMicromapUsageEXT>{ (size_t)obj.usageCountsCount, obj.pUsageCounts },
         detail::PointerArrayTupleElementWrapper<VkMicromapUsageEXT>{ (size_t)obj.usageCountsCount, obj.ppUsageCounts },
-        obj.micromap
+        detail::HandleTupleElementWrapper<VkMicromapEXT> { obj.micromap }
     );
 }
 
@@ -285,7 +285,7 @@ inline auto make_tuple(const VkMicromapBuildInfoEXT& obj)
         obj.type,
         obj.flags,
         obj.mode,
-        obj.dstMicromap,
+        detail::HandleTupleElementWrapper<VkMicromapEXT> { obj.dstMicromap },
         obj.usageCountsCount,
         detail::ArrayTupleElementWrapper<VkMicromapUsageEXT>{ (size_t)obj.usageCountsCount, obj.pUsageCounts },
         detail::PointerArrayTupleElementWrapper<VkMicromapUsageEXT>{ (size_t)obj.usageCountsCount, obj.ppUsageCounts },
@@ -347,7 +347,7 @@ inline auto make_tuple(const VkShaderCreateInfoEXT& obj)
         detail::ArrayTupleElementWrapper<uint8_t> { obj.codeSize, (const uint8_t*)obj.pCode },
         detail::StringTupleElementWrapper { obj.pName },
         obj.setLayoutCount,
-        detail::ArrayTupleElementWrapper<VkDescriptorSetLayout> { obj.setLayoutCount, obj.pSetLayouts },
+        detail::make_handle_array_tuple_element(obj.setLayoutCount, obj.pSetLayouts),
         obj.pushConstantRangeCount,
         detail::ArrayTupleElementWrapper<VkPushConstantRange> { obj.pushConstantRangeCount, obj.pPushConstantRanges },
         detail::ArrayTupleElementWrapper<VkSpecializationInfo> { 1, obj.pSpecializationInfo }
@@ -160,6 +160,57 @@ inline bool operator>=(const PointerArrayTupleElementWrapper<T>& lhs, const Poin
     return !(lhs < rhs);
 }
 
+template <typename T>
+struct HandleTupleElementWrapper final
+{
+    T handle { };
+};
+
+template <typename T>
+inline bool operator==(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs)
+{
+    return lhs.handle == rhs.handle;
+}
+
+template <typename T>
+inline bool operator!=(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename T>
+inline bool operator<(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs)
+{
+    return lhs.handle < rhs.handle;
+}
+
+template <typename T>
+inline bool operator>(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <typename T>
+inline bool operator<=(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <typename T>
+inline bool operator>=(const HandleTupleElementWrapper<T>& lhs, const HandleTupleElementWrapper<T>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <typename T>
+inline auto make_handle_array_tuple_element(size_t count, const T* pHandles)
+{
+    // NOTE : Non-dispatchable handles are uint64_t on 32-bit builds, wrapping them
+    //  keeps them distinguishable from integral members (see gvk::HashIgnoreHandles).
+    static_assert(sizeof(HandleTupleElementWrapper<T>) == sizeof(T));
+    return ArrayTupleElementWrapper<HandleTupleElementWrapper<T>> { count, (const HandleTupleElementWrapper<T>*)pHandles };
+}
+
 struct StringTupleElementWrapper final
 {
     const char* pStr { nullptr };
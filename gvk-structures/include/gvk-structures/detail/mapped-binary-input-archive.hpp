@@ -0,0 +1,156 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/detail/arena-copy-utilities.hpp"
+
+#include "cereal/archives/binary.hpp"
+#include "cereal/cereal.hpp"
+
+#include <cstdint>
+#include <ios>
+#include <memory>
+
+namespace gvk {
+namespace detail {
+
+// NOTE : MappedBinaryInputArchive reads the output of cereal::BinaryOutputArchive
+//  from memory (typically a memory mapped file).  Arrays of BinaryCerealizable
+//  objects are aliased directly into the mapped memory instead of being copied,
+//  so the memory must be writable (ie. a copy on write mapping) and must outlive
+//  the decerealized structures.  Structures decerealized with
+//  decerealize_structure_arena_copy() keep the mapping alive until released.
+class MappedBinaryInputArchive final
+    : public cereal::InputArchive<MappedBinaryInputArchive, cereal::AllowEmptyClassElision>
+{
+public:
+    MappedBinaryInputArchive(uint8_t* pData, size_t size, std::shared_ptr<const void> spMapping);
+    void loadBinary(void* const pData, std::streamsize size);
+
+    // NOTE : alias() expects the sizeof(size_t) bytes preceding the aliased data
+    //  to have already been read (ie. the array count written by
+    //  cerealize_dynamic_array()).  If the data is misaligned it's moved into
+    //  those bytes so that the returned pointer is aligned.  Returns nullptr if
+    //  the data can't be aliased.
+    void* alias(size_t size, size_t alignment);
+
+    size_t get_offset() const;
+    size_t get_size() const;
+    const std::shared_ptr<const void>& get_mapping() const;
+
+private:
+    uint8_t* mpData { nullptr };
+    size_t mSize { 0 };
+    size_t mOffset { 0 };
+    std::shared_ptr<const void> mspMapping;
+};
+
+// NOTE : MappedArenaCopyAllocator provides storage for a decerealized structure
+//  and all of its nested allocations.  Unlike ArenaCopyAllocator the size isn't
+//  known up front, so the arena is a list of blocks that are all freed when the
+//  arena copy is released.  MappedArenaCopyAllocator installs itself as the
+//  tlpDecerealizationAllocator for its lifetime and frees the arena in its dtor
+//  unless commit() is called, the previous tlpDecerealizationAllocator is
+//  restored in its dtor.  spMapping is kept alive until the arena copy is
+//  released, it may be null when decerealizing from a stream.  Allocation
+//  failures throw cereal::Exception, consistent with read failures.
+class MappedArenaCopyAllocator final
+{
+public:
+    MappedArenaCopyAllocator(std::shared_ptr<const void> spMapping, size_t structureSize);
+    ~MappedArenaCopyAllocator();
+    void* get_structure() const;
+    void commit();
+
+private:
+    static void* VKAPI_PTR allocate(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+    static void VKAPI_PTR free(void* pUserData, void* pMemory);
+
+    VkAllocationCallbacks mAllocationCallbacks { };
+    const VkAllocationCallbacks* mpPreviousDecerealizationAllocator { nullptr };
+    uint8_t* mpArena { nullptr };
+    uint8_t* mpBlock { nullptr };
+    size_t mBlockSize { 0 };
+    size_t mBlockOffset { 0 };
+    bool mCommitted { false };
+
+    MappedArenaCopyAllocator(const MappedArenaCopyAllocator&) = delete;
+    MappedArenaCopyAllocator& operator=(const MappedArenaCopyAllocator&) = delete;
+};
+
+template <typename StructureType>
+inline StructureType* decerealize_structure_arena_copy(MappedBinaryInputArchive& archive)
+{
+    MappedArenaCopyAllocator allocator(archive.get_mapping(), sizeof(StructureType));
+    auto pStructure = new(allocator.get_structure()) StructureType { };
+    archive(*pStructure);
+    allocator.commit();
+    return pStructure;
+}
+
+template <typename StructureType>
+inline StructureType* decerealize_structure_arena_copy(cereal::BinaryInputArchive& archive)
+{
+    MappedArenaCopyAllocator allocator(nullptr, sizeof(StructureType));
+    auto pStructure = new(allocator.get_structure()) StructureType { };
+    archive(*pStructure);
+    allocator.commit();
+    return pStructure;
+}
+
+} // namespace detail
+} // namespace gvk
+
+namespace cereal {
+
+template <typename ObjectType>
+inline typename std::enable_if<std::is_arithmetic<ObjectType>::value, void>::type
+CEREAL_LOAD_FUNCTION_NAME(gvk::detail::MappedBinaryInputArchive& archive, ObjectType& obj)
+{
+    archive.loadBinary(std::addressof(obj), sizeof(obj));
+}
+
+template <typename ObjectType>
+inline void CEREAL_SERIALIZE_FUNCTION_NAME(gvk::detail::MappedBinaryInputArchive& archive, NameValuePair<ObjectType>& obj)
+{
+    archive(obj.value);
+}
+
+template <typename ObjectType>
+inline void CEREAL_SERIALIZE_FUNCTION_NAME(gvk::detail::MappedBinaryInputArchive& archive, SizeTag<ObjectType>& obj)
+{
+    archive(obj.size);
+}
+
+template <typename ObjectType>
+inline void CEREAL_LOAD_FUNCTION_NAME(gvk::detail::MappedBinaryInputArchive& archive, BinaryData<ObjectType>& obj)
+{
+    archive.loadBinary(obj.data, static_cast<std::streamsize>(obj.size));
+}
+
+} // namespace cereal
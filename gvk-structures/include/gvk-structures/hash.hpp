@@ -0,0 +1,67 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-structures/generated/core-structure-hash.hpp"
+#include "gvk-structures/detail/hash-utilities.hpp"
+
+#include <cstddef>
+
+namespace gvk {
+
+/**
+Function object for use with hashed containers, ie. std::unordered_map<>
+    @param <StructureType> The type of structure to hash
+    @param <Flags> Bitmask of gvk::HashFlagBits to use when hashing
+    @note std::hash<> is specialized for all Vulkan structures, Hash<> can be used when HashFlags are required
+*/
+template <typename StructureType, HashFlags Flags = 0>
+struct Hash final
+{
+    inline size_t operator()(const StructureType& obj) const
+    {
+        return (size_t)gvk::hash(obj, 0, Flags);
+    }
+};
+
+/**
+Function object for use with hashed containers, ie. std::unordered_map<>
+    @param <StructureType> The type of structure to compare
+    @param <Flags> Bitmask of gvk::HashFlagBits to use when comparing
+    @note Equal<> should be used with Hash<> when HashFlags are required, ie. with HashIgnoreHandles structures that only differ by handle values are the same key
+*/
+template <typename StructureType, HashFlags Flags = 0>
+struct Equal final
+{
+    inline bool operator()(const StructureType& lhs, const StructureType& rhs) const
+    {
+        return gvk::equal(lhs, rhs, Flags);
+    }
+};
+
+} // namespace gvk
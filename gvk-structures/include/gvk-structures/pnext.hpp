@@ -61,23 +61,42 @@ inline const PNextStructureType* get_pnext_structure(const void* pNext)
     return nullptr;
 }
 
-inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, const std::set<VkStructureType>& structureTypes)
+// NOTE : unlink_pnext_entries() only unlinks entries, it's safe to use on the
+//  pNext chain of an arena copy (ie. the contents of an Auto<> after detach())
+//  because the arena owns every entry and releases them together.
+//  remove_pnext_entries() unlinks entries and destroys them with pAllocator, it
+//  must only be used on pNext chains created by create_pnext_copy() with the same
+//  pAllocator, never on an arena copy.
+inline const void* unlink_pnext_entries(VkBaseOutStructure* pNext, const std::set<VkStructureType>& structureTypes)
 {
     while (pNext) {
         while (pNext->pNext && structureTypes.count(pNext->pNext->sType)) {
             auto pRemove = pNext->pNext;
             pNext->pNext = pRemove->pNext;
             pRemove->pNext = nullptr;
-            detail::destroy_pnext_copy(pRemove, nullptr);
         }
         pNext = pNext->pNext;
     }
     return pNext;
 }
 
-inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, VkStructureType structureType)
+inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, const std::set<VkStructureType>& structureTypes, const VkAllocationCallbacks* pAllocator)
 {
-    return remove_pnext_entries(pNext, std::set<VkStructureType> { structureType });
+    while (pNext) {
+        while (pNext->pNext && structureTypes.count(pNext->pNext->sType)) {
+            auto pRemove = pNext->pNext;
+            pNext->pNext = pRemove->pNext;
+            pRemove->pNext = nullptr;
+            detail::destroy_pnext_copy(pRemove, pAllocator);
+        }
+        pNext = pNext->pNext;
+    }
+    return pNext;
+}
+
+inline const void* remove_pnext_entries(VkBaseOutStructure* pNext, VkStructureType structureType, const VkAllocationCallbacks* pAllocator)
+{
+    return remove_pnext_entries(pNext, std::set<VkStructureType> { structureType }, pAllocator);
 }
 
 } // namespace detail
@@ -0,0 +1,100 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-structures/detail/arena-copy-utilities.hpp"
+
+
+namespace gvk {
+namespace detail {
+
+ArenaCopyAllocator::ArenaCopyAllocator(uint8_t* pData, size_t size)
+    : mpData { pData }
+    , mSize { size }
+{
+    mAllocationCallbacks.pUserData = this;
+    mAllocationCallbacks.pfnAllocation = allocate;
+    mAllocationCallbacks.pfnFree = free;
+}
+
+const VkAllocationCallbacks& ArenaCopyAllocator::get_allocation_callbacks() const
+{
+    return mAllocationCallbacks;
+}
+
+size_t ArenaCopyAllocator::get_allocation_size() const
+{
+    return mAllocationSize;
+}
+
+void* VKAPI_PTR ArenaCopyAllocator::allocate(void* pUserData, size_t size, size_t, VkSystemAllocationScope)
+{
+    assert(pUserData);
+    auto pArenaCopyAllocator = (ArenaCopyAllocator*)pUserData;
+    size = align_copy_allocation_size(size);
+    if (pArenaCopyAllocator->mSize - pArenaCopyAllocator->mAllocationSize < size) {
+        throw std::bad_alloc();
+    }
+    auto pMemory = pArenaCopyAllocator->mpData + pArenaCopyAllocator->mAllocationSize;
+    pArenaCopyAllocator->mAllocationSize += size;
+    return pMemory;
+}
+
+void VKAPI_PTR ArenaCopyAllocator::free(void*, void*)
+{
+}
+
+static ArenaCopyHeader* get_arena_copy_header(const void* pObj)
+{
+    assert(pObj);
+    return (ArenaCopyHeader*)((const uint8_t*)pObj - ArenaCopyStructureOffset);
+}
+
+void retain_arena_copy(const void* pObj)
+{
+    if (pObj) {
+        get_arena_copy_header(pObj)->referenceCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void release_arena_copy(const void* pObj)
+{
+    if (pObj) {
+        auto pHeader = get_arena_copy_header(pObj);
+        if (pHeader->referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            auto allocator = pHeader->allocator;
+            pHeader->~ArenaCopyHeader();
+            allocator.pfnFree(allocator.pUserData, pHeader);
+        }
+    }
+}
+
+uint32_t get_arena_copy_reference_count(const void* pObj)
+{
+    return pObj ? get_arena_copy_header(pObj)->referenceCount.load(std::memory_order_acquire) : 0;
+}
+
+} // namespace detail
+} // namespace gvk
@@ -58,6 +58,15 @@ template <> void destroy_structure_copy<VkExportFenceWin32HandleInfoKHR>(const V
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportFenceWin32HandleInfoKHR>(const VkExportFenceWin32HandleInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkExportMemoryWin32HandleInfoKHR create_structure_copy<VkExportMemoryWin32HandleInfoKHR>(const VkExportMemoryWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -74,6 +83,15 @@ template <> void destroy_structure_copy<VkExportMemoryWin32HandleInfoKHR>(const
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportMemoryWin32HandleInfoKHR>(const VkExportMemoryWin32HandleInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkExportMemoryWin32HandleInfoNV create_structure_copy<VkExportMemoryWin32HandleInfoNV>(const VkExportMemoryWin32HandleInfoNV& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -88,6 +106,14 @@ template <> void destroy_structure_copy<VkExportMemoryWin32HandleInfoNV>(const V
     destroy_dynamic_array_copy(1, obj.pAttributes, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportMemoryWin32HandleInfoNV>(const VkExportMemoryWin32HandleInfoNV& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    return size;
+}
+
 template <> VkExportSemaphoreWin32HandleInfoKHR create_structure_copy<VkExportSemaphoreWin32HandleInfoKHR>(const VkExportSemaphoreWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -104,6 +130,15 @@ template <> void destroy_structure_copy<VkExportSemaphoreWin32HandleInfoKHR>(con
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkExportSemaphoreWin32HandleInfoKHR>(const VkExportSemaphoreWin32HandleInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(1, obj.pAttributes);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkImportFenceWin32HandleInfoKHR create_structure_copy<VkImportFenceWin32HandleInfoKHR>(const VkImportFenceWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -118,6 +153,14 @@ template <> void destroy_structure_copy<VkImportFenceWin32HandleInfoKHR>(const V
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkImportFenceWin32HandleInfoKHR>(const VkImportFenceWin32HandleInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkImportMemoryWin32HandleInfoKHR create_structure_copy<VkImportMemoryWin32HandleInfoKHR>(const VkImportMemoryWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -132,6 +175,14 @@ template <> void destroy_structure_copy<VkImportMemoryWin32HandleInfoKHR>(const
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkImportMemoryWin32HandleInfoKHR>(const VkImportMemoryWin32HandleInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
+
 template <> VkImportMemoryWin32HandleInfoNV create_structure_copy<VkImportMemoryWin32HandleInfoNV>(const VkImportMemoryWin32HandleInfoNV& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -144,6 +195,13 @@ template <> void destroy_structure_copy<VkImportMemoryWin32HandleInfoNV>(const V
     destroy_pnext_copy(obj.pNext, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkImportMemoryWin32HandleInfoNV>(const VkImportMemoryWin32HandleInfoNV& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    return size;
+}
+
 template <> VkImportSemaphoreWin32HandleInfoKHR create_structure_copy<VkImportSemaphoreWin32HandleInfoKHR>(const VkImportSemaphoreWin32HandleInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -157,6 +215,14 @@ template <> void destroy_structure_copy<VkImportSemaphoreWin32HandleInfoKHR>(con
     destroy_pnext_copy(obj.pNext, pAllocator);
     destroy_dynamic_string_copy(obj.name, pAllocator);
 }
+
+template <> size_t get_structure_copy_size<VkImportSemaphoreWin32HandleInfoKHR>(const VkImportSemaphoreWin32HandleInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_string_copy_size(obj.name);
+    return size;
+}
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -250,6 +316,15 @@ template <> void destroy_structure_copy<VkAccelerationStructureBuildGeometryInfo
     destroy_dynamic_pointer_array_copy(obj.geometryCount, obj.ppGeometries, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureBuildGeometryInfoKHR>(const VkAccelerationStructureBuildGeometryInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.geometryCount, obj.pGeometries);
+    size += get_dynamic_pointer_array_copy_size(obj.geometryCount, obj.ppGeometries);
+    return size;
+}
+
 template <> VkAccelerationStructureTrianglesDisplacementMicromapNV create_structure_copy<VkAccelerationStructureTrianglesDisplacementMicromapNV>(const VkAccelerationStructureTrianglesDisplacementMicromapNV& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -266,6 +341,15 @@ template <> void destroy_structure_copy<VkAccelerationStructureTrianglesDisplace
     destroy_dynamic_pointer_array_copy(obj.usageCountsCount, obj.ppUsageCounts, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureTrianglesDisplacementMicromapNV>(const VkAccelerationStructureTrianglesDisplacementMicromapNV& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.usageCountsCount, obj.pUsageCounts);
+    size += get_dynamic_pointer_array_copy_size(obj.usageCountsCount, obj.ppUsageCounts);
+    return size;
+}
+
 template <> VkAccelerationStructureTrianglesOpacityMicromapEXT create_structure_copy<VkAccelerationStructureTrianglesOpacityMicromapEXT>(const VkAccelerationStructureTrianglesOpacityMicromapEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -282,6 +366,15 @@ template <> void destroy_structure_copy<VkAccelerationStructureTrianglesOpacityM
     destroy_dynamic_pointer_array_copy(obj.usageCountsCount, obj.ppUsageCounts, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureTrianglesOpacityMicromapEXT>(const VkAccelerationStructureTrianglesOpacityMicromapEXT& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.usageCountsCount, obj.pUsageCounts);
+    size += get_dynamic_pointer_array_copy_size(obj.usageCountsCount, obj.ppUsageCounts);
+    return size;
+}
+
 template <> VkAccelerationStructureVersionInfoKHR create_structure_copy<VkAccelerationStructureVersionInfoKHR>(const VkAccelerationStructureVersionInfoKHR& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -297,6 +390,13 @@ template <> void destroy_structure_copy<VkAccelerationStructureVersionInfoKHR>(c
     destroy_pnext_copy(obj.pNext, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureVersionInfoKHR>(const VkAccelerationStructureVersionInfoKHR& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    return size;
+}
+
 template <> VkMicromapBuildInfoEXT create_structure_copy<VkMicromapBuildInfoEXT>(const VkMicromapBuildInfoEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -313,6 +413,15 @@ template <> void destroy_structure_copy<VkMicromapBuildInfoEXT>(const VkMicromap
     destroy_dynamic_pointer_array_copy(obj.usageCountsCount, obj.ppUsageCounts, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkMicromapBuildInfoEXT>(const VkMicromapBuildInfoEXT& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.usageCountsCount, obj.pUsageCounts);
+    size += get_dynamic_pointer_array_copy_size(obj.usageCountsCount, obj.ppUsageCounts);
+    return size;
+}
+
 template <> VkMicromapVersionInfoEXT create_structure_copy<VkMicromapVersionInfoEXT>(const VkMicromapVersionInfoEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -328,6 +437,13 @@ template <> void destroy_structure_copy<VkMicromapVersionInfoEXT>(const VkMicrom
     destroy_pnext_copy(obj.pNext, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkMicromapVersionInfoEXT>(const VkMicromapVersionInfoEXT& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    return size;
+}
+
 template <> VkPipelineCacheCreateInfo create_structure_copy<VkPipelineCacheCreateInfo>(const VkPipelineCacheCreateInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -342,6 +458,14 @@ template <> void destroy_structure_copy<VkPipelineCacheCreateInfo>(const VkPipel
     destroy_dynamic_array_copy(obj.initialDataSize, (const uint8_t*)obj.pInitialData, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkPipelineCacheCreateInfo>(const VkPipelineCacheCreateInfo& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.initialDataSize, (const uint8_t*)obj.pInitialData);
+    return size;
+}
+
 template <> VkPipelineMultisampleStateCreateInfo create_structure_copy<VkPipelineMultisampleStateCreateInfo>(const VkPipelineMultisampleStateCreateInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -356,6 +480,14 @@ template <> void destroy_structure_copy<VkPipelineMultisampleStateCreateInfo>(co
     destroy_dynamic_array_copy((obj.rasterizationSamples + 31) / 32, obj.pSampleMask, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkPipelineMultisampleStateCreateInfo>(const VkPipelineMultisampleStateCreateInfo& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size((obj.rasterizationSamples + 31) / 32, obj.pSampleMask);
+    return size;
+}
+
 template <> VkShaderCreateInfoEXT create_structure_copy<VkShaderCreateInfoEXT>(const VkShaderCreateInfoEXT& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -378,6 +510,18 @@ template <> void destroy_structure_copy<VkShaderCreateInfoEXT>(const VkShaderCre
     destroy_dynamic_array_copy(1, obj.pSpecializationInfo, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkShaderCreateInfoEXT>(const VkShaderCreateInfoEXT& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.codeSize, (const uint8_t*)obj.pCode);
+    size += get_dynamic_string_copy_size(obj.pName);
+    size += get_dynamic_array_copy_size(obj.setLayoutCount, obj.pSetLayouts);
+    size += get_dynamic_array_copy_size(obj.pushConstantRangeCount, obj.pPushConstantRanges);
+    size += get_dynamic_array_copy_size(1, obj.pSpecializationInfo);
+    return size;
+}
+
 template <> VkShaderModuleCreateInfo create_structure_copy<VkShaderModuleCreateInfo>(const VkShaderModuleCreateInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -392,6 +536,14 @@ template <> void destroy_structure_copy<VkShaderModuleCreateInfo>(const VkShader
     destroy_dynamic_array_copy(obj.codeSize / sizeof(uint32_t), obj.pCode, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkShaderModuleCreateInfo>(const VkShaderModuleCreateInfo& obj)
+{
+    size_t size = 0;
+    size += get_pnext_copy_size(obj.pNext);
+    size += get_dynamic_array_copy_size(obj.codeSize / sizeof(uint32_t), obj.pCode);
+    return size;
+}
+
 template <> VkSpecializationInfo create_structure_copy<VkSpecializationInfo>(const VkSpecializationInfo& obj, const VkAllocationCallbacks* pAllocator)
 {
     auto result = obj;
@@ -406,6 +558,14 @@ template <> void destroy_structure_copy<VkSpecializationInfo>(const VkSpecializa
     destroy_dynamic_array_copy(obj.dataSize, (const uint8_t*)obj.pData, pAllocator);
 }
 
+template <> size_t get_structure_copy_size<VkSpecializationInfo>(const VkSpecializationInfo& obj)
+{
+    size_t size = 0;
+    size += get_dynamic_array_copy_size(obj.mapEntryCount, obj.pMapEntries);
+    size += get_dynamic_array_copy_size(obj.dataSize, (const uint8_t*)obj.pData);
+    return size;
+}
+
 GVK_STUB_STRUCTURE_COPY_FUNCTIONS(VkTransformMatrixKHR)
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -446,6 +606,25 @@ template <> void destroy_structure_copy<VkAccelerationStructureGeometryDataKHR>(
     }
 }
 
+template <> size_t get_structure_copy_size<VkAccelerationStructureGeometryDataKHR>(const VkAccelerationStructureGeometryDataKHR& obj)
+{
+    size_t size = 0;
+    switch (((VkBaseInStructure&)obj).sType) {
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR: {
+        size += get_structure_copy_size(obj.triangles);
+    } break;
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR: {
+        size += get_structure_copy_size(obj.aabbs);
+    } break;
+    case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR: {
+        size += get_structure_copy_size(obj.instances);
+    } break;
+    default: {
+    } break;
+    }
+    return size;
+}
+
 GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VkAccelerationStructureMotionInstanceDataNV)
 GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VkClearColorValue)
 GVK_DEFINE_DEFAULT_STRUCTURE_COPY_FUNCTIONS(VkClearValue)
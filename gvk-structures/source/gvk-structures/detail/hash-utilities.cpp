@@ -0,0 +1,74 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-structures/detail/hash-utilities.hpp"
+
+#include <cwchar>
+
+namespace gvk {
+namespace detail {
+
+uint64_t hash_bytes(const void* pData, size_t size, uint64_t seed)
+{
+    seed = hash_combine(seed, size);
+    auto pBytes = (const uint8_t*)pData;
+    while (size >= sizeof(uint64_t)) {
+        uint64_t word = 0;
+        memcpy(&word, pBytes, sizeof(word));
+        seed = hash_combine(seed, word);
+        pBytes += sizeof(word);
+        size -= sizeof(word);
+    }
+    if (size) {
+        uint64_t word = 0;
+        memcpy(&word, pBytes, size);
+        seed = hash_combine(seed, word);
+    }
+    return seed;
+}
+
+uint64_t hash_string(const char* pStr, uint64_t seed)
+{
+    return pStr ? hash_bytes(pStr, strlen(pStr), hash_combine(seed, 1)) : hash_combine(seed, 0);
+}
+
+uint64_t hash_string(const wchar_t* pwStr, uint64_t seed)
+{
+    return pwStr ? hash_bytes(pwStr, wcslen(pwStr) * sizeof(wchar_t), hash_combine(seed, 1)) : hash_combine(seed, 0);
+}
+
+uint64_t hash_string_array(size_t count, const char* const* ppStrs, uint64_t seed)
+{
+    count = count && ppStrs ? count : 0;
+    seed = hash_combine(seed, count);
+    for (size_t i = 0; i < count; ++i) {
+        seed = hash_string(ppStrs[i], seed);
+    }
+    return seed;
+}
+
+} // namespace detail
+} // namespace gvk
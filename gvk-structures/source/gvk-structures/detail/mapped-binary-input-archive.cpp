@@ -0,0 +1,190 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-structures/detail/mapped-binary-input-archive.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace gvk {
+namespace detail {
+
+extern thread_local const VkAllocationCallbacks* tlpDecerealizationAllocator;
+
+MappedBinaryInputArchive::MappedBinaryInputArchive(uint8_t* pData, size_t size, std::shared_ptr<const void> spMapping)
+    : cereal::InputArchive<MappedBinaryInputArchive, cereal::AllowEmptyClassElision>(this)
+    , mpData { pData }
+    , mSize { size }
+    , mspMapping { std::move(spMapping) }
+{
+}
+
+void MappedBinaryInputArchive::loadBinary(void* const pData, std::streamsize size)
+{
+    if (mSize < mOffset + (size_t)size) {
+        throw cereal::Exception("Failed to read " + std::to_string(size) + " bytes from mapped memory; " + std::to_string(mSize - mOffset) + " bytes remain");
+    }
+    memcpy(pData, mpData + mOffset, (size_t)size);
+    mOffset += (size_t)size;
+}
+
+void* MappedBinaryInputArchive::alias(size_t size, size_t alignment)
+{
+    if (mSize < mOffset + size) {
+        throw cereal::Exception("Failed to alias " + std::to_string(size) + " bytes from mapped memory; " + std::to_string(mSize - mOffset) + " bytes remain");
+    }
+    auto pData = mpData + mOffset;
+    auto misalignment = (size_t)((uintptr_t)pData % alignment);
+    if (misalignment) {
+        if (sizeof(size_t) < misalignment || mOffset < sizeof(size_t)) {
+            return nullptr;
+        }
+        memmove(pData - misalignment, pData, size);
+        pData -= misalignment;
+    }
+    mOffset += size;
+    return pData;
+}
+
+size_t MappedBinaryInputArchive::get_offset() const
+{
+    return mOffset;
+}
+
+size_t MappedBinaryInputArchive::get_size() const
+{
+    return mSize;
+}
+
+const std::shared_ptr<const void>& MappedBinaryInputArchive::get_mapping() const
+{
+    return mspMapping;
+}
+
+// NOTE : The first block of a mapped arena copy contains the ArenaCopyHeader,
+//  the structure, and a MappedArenaCopyRecord.  The record's address is used as
+//  the arena's VkAllocationCallbacks::pUserData so that the free callback can
+//  release any additional blocks and the reference to the mapping.  Additional
+//  blocks start with a pointer to the next block.
+struct MappedArenaCopyRecord final
+{
+    std::shared_ptr<const void> spMapping;
+    uint8_t* pBlocks { nullptr };
+};
+
+static constexpr size_t MappedArenaCopyBlockSize = 4096;
+
+static void VKAPI_PTR free_mapped_arena_copy(void* pUserData, void* pMemory)
+{
+    assert(pUserData);
+    auto pRecord = (MappedArenaCopyRecord*)pUserData;
+    auto pBlock = pRecord->pBlocks;
+    while (pBlock) {
+        auto pNextBlock = *(uint8_t**)pBlock;
+        std::free(pBlock);
+        pBlock = pNextBlock;
+    }
+    auto spMapping = std::move(pRecord->spMapping);
+    pRecord->~MappedArenaCopyRecord();
+    std::free(pMemory);
+}
+
+MappedArenaCopyAllocator::MappedArenaCopyAllocator(std::shared_ptr<const void> spMapping, size_t structureSize)
+{
+    auto recordOffset = align_copy_allocation_size(ArenaCopyStructureOffset + structureSize);
+    auto dataOffset = align_copy_allocation_size(recordOffset + sizeof(MappedArenaCopyRecord));
+    mBlockSize = std::max(MappedArenaCopyBlockSize, dataOffset);
+    mpArena = (uint8_t*)std::malloc(mBlockSize);
+    if (!mpArena) {
+        throw cereal::Exception("Failed to allocate " + std::to_string(mBlockSize) + " byte arena for decerealization");
+    }
+    mpBlock = mpArena;
+    mBlockOffset = dataOffset;
+    auto pRecord = new(mpArena + recordOffset) MappedArenaCopyRecord;
+    pRecord->spMapping = std::move(spMapping);
+    auto pHeader = new(mpArena) ArenaCopyHeader;
+    pHeader->referenceCount.store(1);
+    pHeader->allocator = { };
+    pHeader->allocator.pUserData = pRecord;
+    pHeader->allocator.pfnFree = free_mapped_arena_copy;
+    mAllocationCallbacks.pUserData = this;
+    mAllocationCallbacks.pfnAllocation = allocate;
+    mAllocationCallbacks.pfnFree = free;
+    mpPreviousDecerealizationAllocator = tlpDecerealizationAllocator;
+    tlpDecerealizationAllocator = &mAllocationCallbacks;
+}
+
+MappedArenaCopyAllocator::~MappedArenaCopyAllocator()
+{
+    tlpDecerealizationAllocator = mpPreviousDecerealizationAllocator;
+    if (!mCommitted) {
+        release_arena_copy(get_structure());
+    }
+}
+
+void* MappedArenaCopyAllocator::get_structure() const
+{
+    return mpArena + ArenaCopyStructureOffset;
+}
+
+void MappedArenaCopyAllocator::commit()
+{
+    mCommitted = true;
+}
+
+void* VKAPI_PTR MappedArenaCopyAllocator::allocate(void* pUserData, size_t size, size_t, VkSystemAllocationScope)
+{
+    assert(pUserData);
+    auto pAllocator = (MappedArenaCopyAllocator*)pUserData;
+    size = align_copy_allocation_size(size);
+    if (pAllocator->mBlockSize < pAllocator->mBlockOffset + size) {
+        auto blockSize = std::max(MappedArenaCopyBlockSize, CopyAllocationAlignment + size);
+        auto pBlock = (uint8_t*)std::malloc(blockSize);
+        if (!pBlock) {
+            throw cereal::Exception("Failed to allocate " + std::to_string(blockSize) + " byte arena block for decerealization");
+        }
+        auto pHeader = (ArenaCopyHeader*)pAllocator->mpArena;
+        auto pRecord = (MappedArenaCopyRecord*)pHeader->allocator.pUserData;
+        *(uint8_t**)pBlock = pRecord->pBlocks;
+        pRecord->pBlocks = pBlock;
+        pAllocator->mpBlock = pBlock;
+        pAllocator->mBlockSize = blockSize;
+        pAllocator->mBlockOffset = CopyAllocationAlignment;
+    }
+    auto pMemory = pAllocator->mpBlock + pAllocator->mBlockOffset;
+    pAllocator->mBlockOffset += size;
+    return pMemory;
+}
+
+void VKAPI_PTR MappedArenaCopyAllocator::free(void*, void*)
+{
+}
+
+} // namespace detail
+} // namespace gvk
@@ -43,26 +43,26 @@ GVK_STUB_TO_STRING_DEFINITION(VkXlibSurfaceCreateInfoKHR)
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 template <> void print<HINSTANCE>(Printer& printer, const HINSTANCE& hInstance)
 {
-    printer.mOstrm << "\"" << (hInstance ? to_hex_string(hInstance) : "NULL") << "\"";
+    printer.mBuffer << "\"" << (hInstance ? to_hex_string(hInstance) : "NULL") << "\"";
 }
 
 template <> void print<HWND>(Printer& printer, const HWND& hWnd)
 {
-    printer.mOstrm << "\"" << (hWnd ? to_hex_string(hWnd) : "NULL") << "\"";
+    printer.mBuffer << "\"" << (hWnd ? to_hex_string(hWnd) : "NULL") << "\"";
 }
 
 template <> void print<LPCWSTR>(Printer& printer, const LPCWSTR& pwStr)
 {
-    printer.mOstrm << "\"";
+    printer.mBuffer << "\"";
     if (pwStr) {
         auto strLen = WideCharToMultiByte(CP_UTF8, 0, pwStr, -1, NULL, 0, NULL, NULL);
         std::string str(strLen, 0);
         WideCharToMultiByte(CP_UTF8, 0, pwStr, -1, str.data(), 0, NULL, NULL);
-        printer.mOstrm << str;
+        printer.mBuffer << str;
     } else {
-        printer.mOstrm << "NULL";
+        printer.mBuffer << "NULL";
     }
-    printer.mOstrm << "\"";
+    printer.mBuffer << "\"";
 }
 
 template <> void print<SECURITY_ATTRIBUTES>(Printer& printer, const SECURITY_ATTRIBUTES& obj)
@@ -288,7 +288,7 @@ void print<VkAccelerationStructureBuildGeometryInfoKHR>(Printer& printer, const
                     if (pGeometry) {
                         print(printer, *pGeometry);
                     } else {
-                        printer.mOstrm << "null";
+                        printer.mBuffer << "null";
                     }
                 }
             );
@@ -325,7 +325,7 @@ void print<VkAccelerationStructureTrianglesDisplacementMicromapNV>(Printer& prin
                     if (pUsageCount) {
                         print(printer, *pUsageCount);
                     } else {
-                        printer.mOstrm << "null";
+                        printer.mBuffer << "null";
                     }
                 }
             );
@@ -354,7 +354,7 @@ void print<VkAccelerationStructureTrianglesOpacityMicromapEXT>(Printer& printer,
                     if (pUsageCount) {
                         print(printer, *pUsageCount);
                     } else {
-                        printer.mOstrm << "null";
+                        printer.mBuffer << "null";
                     }
                 }
             );
@@ -371,7 +371,7 @@ void print<VkAccelerationStructureVersionInfoKHR>(Printer& printer, const VkAcce
         {
             printer.print_field("sType", obj.sType);
             detail::print_pnext(printer, obj.pNext);
-            printer.print_field("pVersionData", obj.pVersionData);
+            printer.print_blob("pVersionData", 2 * VK_UUID_SIZE, obj.pVersionData);
         }
     );
 }
@@ -396,7 +396,7 @@ void print<VkMicromapBuildInfoEXT>(Printer& printer, const VkMicromapBuildInfoEX
                     if (pUsageCount) {
                         print(printer, *pUsageCount);
                     } else {
-                        printer.mOstrm << "null";
+                        printer.mBuffer << "null";
                     }
                 }
             );
@@ -416,7 +416,7 @@ void print<VkMicromapVersionInfoEXT>(Printer& printer, const VkMicromapVersionIn
         {
             printer.print_field("sType", obj.sType);
             detail::print_pnext(printer, obj.pNext);
-            printer.print_field("pVersionData", obj.pVersionData);
+            printer.print_blob("pVersionData", 2 * VK_UUID_SIZE, obj.pVersionData);
         }
     );
 }
@@ -431,7 +431,7 @@ void print<VkPipelineCacheCreateInfo>(Printer& printer, const VkPipelineCacheCre
             detail::print_pnext(printer, obj.pNext);
             printer.print_flags<VkPipelineCacheCreateFlagBits>("flags", obj.flags);
             printer.print_field("initialDataSize", obj.initialDataSize);
-            printer.print_array("pInitialData", obj.initialDataSize, (const uint8_t*)obj.pInitialData);
+            printer.print_blob("pInitialData", obj.initialDataSize, (const uint8_t*)obj.pInitialData);
         }
     );
 }
@@ -468,7 +468,7 @@ void print<VkShaderCreateInfoEXT>(Printer& printer, const VkShaderCreateInfoEXT&
             printer.print_field("nextStage", obj.nextStage);
             printer.print_field("codeType", obj.codeType);
             printer.print_field("codeSize", obj.codeSize);
-            printer.print_array("pCode", obj.codeSize, (const uint8_t*)obj.pCode);
+            printer.print_blob("pCode", obj.codeSize, (const uint8_t*)obj.pCode);
             printer.print_field("pName", obj.pName);
             printer.print_field("setLayoutCount", obj.setLayoutCount);
             printer.print_array("pSetLayouts", obj.setLayoutCount, obj.pSetLayouts);
@@ -489,7 +489,7 @@ void print<VkShaderModuleCreateInfo>(Printer& printer, const VkShaderModuleCreat
             detail::print_pnext(printer, obj.pNext);
             printer.print_field("flags", obj.flags);
             printer.print_field("codeSize", obj.codeSize);
-            printer.print_array("pCode", obj.codeSize / sizeof(uint32_t), obj.pCode);
+            printer.print_blob("pCode", obj.codeSize / sizeof(uint32_t), obj.pCode);
         }
     );
 }
@@ -503,7 +503,7 @@ void print<VkSpecializationInfo>(Printer& printer, const VkSpecializationInfo& o
             printer.print_field("mapEntryCount", obj.mapEntryCount);
             printer.print_array("pMapEntries", obj.mapEntryCount, obj.pMapEntries);
             printer.print_field("dataSize", obj.dataSize);
-            printer.print_array("pData", obj.dataSize, (const uint8_t*)obj.pData);
+            printer.print_blob("pData", obj.dataSize, (const uint8_t*)obj.pData);
         }
     );
 }
@@ -517,14 +517,14 @@ void print<VkTransformMatrixKHR>(Printer& printer, const VkTransformMatrixKHR& o
             printer.print_array("matrix", 3, obj.matrix,
                 [&](auto, auto row)
                 {
-                    printer.mOstrm << "[ ";
+                    printer.mBuffer << "[ ";
                     for (uint32_t i = 0; i < 4; ++i) {
                         if (i) {
-                            printer.mOstrm << ", ";
+                            printer.mBuffer << ", ";
                         }
                         print(printer, row[i]);
                     }
-                    printer.mOstrm << " ]";
+                    printer.mBuffer << " ]";
                 }
             );
         }
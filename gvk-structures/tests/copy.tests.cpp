@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #define _CRT_SECURE_NO_WARNINGS
 
+#include "gvk-structures/auto.hpp"
 #include "gvk-structures/comparison-operators.hpp"
 #include "gvk-structures/copy.hpp"
 #include "gvk-structures/serialization.hpp"
@@ -40,6 +41,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <array>
 #include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
 
 TEST(create_structure_copy, Basic)
 {
@@ -434,3 +438,192 @@ TEST(structure_tests, VkShaderCreateInfoEXT)
     // Validate structure serialization
     gvk::validation::validate_structure_serialization(shaderCreateInfo);
 }
+
+TEST(create_structure_arena_copy, SingleAllocation)
+{
+    VkApplicationInfo applicationInfo { };
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pApplicationName = "Intel GPA";
+    applicationInfo.pEngineName = "gvk";
+    std::array<const char*, 2> enabledLayerNames { "VK_LAYER_KHRONOS_validation", "VK_LAYER_INTEL_gvk_state_tracker" };
+    VkInstanceCreateInfo instanceCreateInfo { };
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    instanceCreateInfo.enabledLayerCount = (uint32_t)enabledLayerNames.size();
+    instanceCreateInfo.ppEnabledLayerNames = enabledLayerNames.data();
+    gvk::validation::Allocator allocator;
+    auto pCopy = gvk::detail::create_structure_arena_copy(instanceCreateInfo, &allocator.get_allocation_callbacks());
+    ASSERT_TRUE(pCopy);
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)1);
+    EXPECT_EQ(instanceCreateInfo, *pCopy);
+    EXPECT_NE(pCopy->pApplicationInfo, instanceCreateInfo.pApplicationInfo);
+    EXPECT_NE(pCopy->ppEnabledLayerNames, instanceCreateInfo.ppEnabledLayerNames);
+    applicationInfo.applicationVersion = 1;
+    EXPECT_NE(instanceCreateInfo, *pCopy);
+    gvk::detail::destroy_structure_arena_copy(pCopy);
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)0);
+}
+
+TEST(create_structure_arena_copy, AllocationFailure)
+{
+    VkApplicationInfo applicationInfo { };
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pApplicationName = "Intel GPA";
+    VkAllocationCallbacks allocationCallbacks { };
+    allocationCallbacks.pfnAllocation = [](void*, size_t, size_t, VkSystemAllocationScope) -> void* { return nullptr; };
+    allocationCallbacks.pfnFree = [](void*, void*) { };
+    EXPECT_THROW(gvk::detail::create_structure_arena_copy(applicationInfo, &allocationCallbacks), std::bad_alloc);
+
+    std::array<uint8_t, 64> arena { };
+    gvk::detail::ArenaCopyAllocator arenaAllocator(arena.data(), arena.size());
+    const auto& arenaAllocationCallbacks = arenaAllocator.get_allocation_callbacks();
+    EXPECT_EQ(arenaAllocationCallbacks.pfnAllocation(arenaAllocationCallbacks.pUserData, 32, 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT), arena.data());
+    EXPECT_THROW(arenaAllocationCallbacks.pfnAllocation(arenaAllocationCallbacks.pUserData, 64, 0, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT), std::bad_alloc);
+    EXPECT_EQ(arenaAllocator.get_allocation_size(), (size_t)32);
+}
+
+TEST(Auto, SharedCopyOnWrite)
+{
+    VkBufferCreateInfo bufferCreateInfo { };
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.size = 262144;
+    gvk::Auto<VkBufferCreateInfo> original = bufferCreateInfo;
+    EXPECT_FALSE(original.is_shared());
+    auto copy = original;
+    EXPECT_TRUE(original.is_shared());
+    EXPECT_TRUE(copy.is_shared());
+    EXPECT_EQ(&*original, &*copy);
+    copy.detach().size = 1048576;
+    EXPECT_FALSE(original.is_shared());
+    EXPECT_FALSE(copy.is_shared());
+    EXPECT_NE(&*original, &*copy);
+    EXPECT_EQ(original->size, (VkDeviceSize)262144);
+    EXPECT_EQ(copy->size, (VkDeviceSize)1048576);
+    gvk::Auto<VkBufferCreateInfo> empty;
+    EXPECT_EQ(*empty, VkBufferCreateInfo { });
+    empty.detach().size = 1;
+    EXPECT_EQ(empty->size, (VkDeviceSize)1);
+}
+
+TEST(create_structure_arena_copy, VkGraphicsPipelineCreateInfo)
+{
+    std::array<uint32_t, 4> specializationData { 1, 2, 3, 4 };
+    std::array<VkSpecializationMapEntry, 4> specializationMapEntries { };
+    for (uint32_t i = 0; i < specializationMapEntries.size(); ++i) {
+        specializationMapEntries[i] = { i, i * (uint32_t)sizeof(uint32_t), sizeof(uint32_t) };
+    }
+    VkSpecializationInfo specializationInfo { };
+    specializationInfo.mapEntryCount = (uint32_t)specializationMapEntries.size();
+    specializationInfo.pMapEntries = specializationMapEntries.data();
+    specializationInfo.dataSize = specializationData.size() * sizeof(uint32_t);
+    specializationInfo.pData = specializationData.data();
+    std::array<VkPipelineShaderStageCreateInfo, 2> shaderStages { };
+    for (auto& shaderStage : shaderStages) {
+        shaderStage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        shaderStage.module = (VkShaderModule)1;
+        shaderStage.pName = "main";
+        shaderStage.pSpecializationInfo = &specializationInfo;
+    }
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    std::array<VkVertexInputBindingDescription, 2> vertexBindings { };
+    std::array<VkVertexInputAttributeDescription, 4> vertexAttributes { };
+    VkPipelineVertexInputStateCreateInfo vertexInputState { };
+    vertexInputState.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputState.vertexBindingDescriptionCount = (uint32_t)vertexBindings.size();
+    vertexInputState.pVertexBindingDescriptions = vertexBindings.data();
+    vertexInputState.vertexAttributeDescriptionCount = (uint32_t)vertexAttributes.size();
+    vertexInputState.pVertexAttributeDescriptions = vertexAttributes.data();
+    VkPipelineInputAssemblyStateCreateInfo inputAssemblyState { };
+    inputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    VkPipelineTessellationStateCreateInfo tessellationState { };
+    tessellationState.sType = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO;
+    VkViewport viewport { 0, 0, 1920, 1080, 0, 1 };
+    VkRect2D scissor { { 0, 0 }, { 1920, 1080 } };
+    VkPipelineViewportStateCreateInfo viewportState { };
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.pViewports = &viewport;
+    viewportState.scissorCount = 1;
+    viewportState.pScissors = &scissor;
+    VkPipelineRasterizationStateCreateInfo rasterizationState { };
+    rasterizationState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    VkSampleMask sampleMask = ~0u;
+    VkPipelineMultisampleStateCreateInfo multisampleState { };
+    multisampleState.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampleState.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    multisampleState.pSampleMask = &sampleMask;
+    VkPipelineDepthStencilStateCreateInfo depthStencilState { };
+    depthStencilState.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    std::array<VkPipelineColorBlendAttachmentState, 4> colorBlendAttachments { };
+    VkPipelineColorBlendStateCreateInfo colorBlendState { };
+    colorBlendState.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlendState.attachmentCount = (uint32_t)colorBlendAttachments.size();
+    colorBlendState.pAttachments = colorBlendAttachments.data();
+    std::array<VkDynamicState, 2> dynamicStates { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamicState { };
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = (uint32_t)dynamicStates.size();
+    dynamicState.pDynamicStates = dynamicStates.data();
+    VkGraphicsPipelineCreateInfo graphicsPipelineCreateInfo { };
+    graphicsPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    graphicsPipelineCreateInfo.stageCount = (uint32_t)shaderStages.size();
+    graphicsPipelineCreateInfo.pStages = shaderStages.data();
+    graphicsPipelineCreateInfo.pVertexInputState = &vertexInputState;
+    graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssemblyState;
+    graphicsPipelineCreateInfo.pTessellationState = &tessellationState;
+    graphicsPipelineCreateInfo.pViewportState = &viewportState;
+    graphicsPipelineCreateInfo.pRasterizationState = &rasterizationState;
+    graphicsPipelineCreateInfo.pMultisampleState = &multisampleState;
+    graphicsPipelineCreateInfo.pDepthStencilState = &depthStencilState;
+    graphicsPipelineCreateInfo.pColorBlendState = &colorBlendState;
+    graphicsPipelineCreateInfo.pDynamicState = &dynamicState;
+    graphicsPipelineCreateInfo.layout = (VkPipelineLayout)1;
+    graphicsPipelineCreateInfo.renderPass = (VkRenderPass)1;
+
+    // Validate that get_structure_copy_size() matches the allocations made by
+    //  create_structure_copy() when each allocation is padded
+    struct AllocationSizeCounter
+    {
+        size_t size { };
+    } allocationSizeCounter;
+    VkAllocationCallbacks countingAllocator { };
+    countingAllocator.pUserData = &allocationSizeCounter;
+    countingAllocator.pfnAllocation = [](void* pUserData, size_t size, size_t, VkSystemAllocationScope)
+    {
+        ((AllocationSizeCounter*)pUserData)->size += gvk::detail::align_copy_allocation_size(size);
+        return malloc(size);
+    };
+    countingAllocator.pfnFree = [](void*, void* pMemory)
+    {
+        free(pMemory);
+    };
+    auto copy = gvk::detail::create_structure_copy(graphicsPipelineCreateInfo, &countingAllocator);
+    EXPECT_EQ(gvk::detail::get_structure_copy_size(graphicsPipelineCreateInfo), allocationSizeCounter.size);
+    EXPECT_EQ(copy, graphicsPipelineCreateInfo);
+
+    // Validate that the arena copy is a single allocation that compares equal
+    gvk::validation::Allocator allocator;
+    auto pArenaCopy = gvk::detail::create_structure_arena_copy(graphicsPipelineCreateInfo, &allocator.get_allocation_callbacks());
+    ASSERT_TRUE(pArenaCopy);
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)1);
+    EXPECT_EQ(*pArenaCopy, graphicsPipelineCreateInfo);
+    EXPECT_NE(pArenaCopy->pStages, graphicsPipelineCreateInfo.pStages);
+    EXPECT_NE(pArenaCopy->pStages[0].pSpecializationInfo, graphicsPipelineCreateInfo.pStages[0].pSpecializationInfo);
+    EXPECT_NE(pArenaCopy->pColorBlendState->pAttachments, graphicsPipelineCreateInfo.pColorBlendState->pAttachments);
+
+    // Validate that Auto<> copies share the arena and outlive the copy they were made from
+    auto pAutoOriginal = std::make_unique<gvk::Auto<VkGraphicsPipelineCreateInfo>>(*pArenaCopy);
+    gvk::detail::destroy_structure_arena_copy(pArenaCopy);
+    EXPECT_EQ(allocator.get_allocation_count(), (size_t)0);
+    auto autoCopy = *pAutoOriginal;
+    EXPECT_TRUE(autoCopy.is_shared());
+    EXPECT_EQ(&*autoCopy, &**pAutoOriginal);
+    pAutoOriginal.reset();
+    EXPECT_FALSE(autoCopy.is_shared());
+    EXPECT_EQ(*autoCopy, copy);
+    multisampleState.rasterizationSamples = VK_SAMPLE_COUNT_4_BIT;
+    EXPECT_NE(*autoCopy, graphicsPipelineCreateInfo);
+    EXPECT_EQ(*autoCopy, copy);
+    gvk::detail::destroy_structure_copy(copy, &countingAllocator);
+}
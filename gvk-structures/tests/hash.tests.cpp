@@ -0,0 +1,330 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-structures/comparison-operators.hpp"
+#include "gvk-structures/defaults.hpp"
+#include "gvk-structures/hash.hpp"
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+#undef None
+#undef Bool
+#endif
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string>
+#include <unordered_map>
+
+/*
+The following tests validate that generated hash functions for Vulkan structures are consistent with the
+generated comparison operators, ie. structures that compare equal must produce equal hashes.
+Test cases cover the following:
+    Basic members
+    Floating point members
+    Union types
+    Dynamic arrays
+    Dynamic strings
+    pNext
+    Structures with pointers to structures
+    Seeds
+    HashIgnoreHandles
+    gvk::equal() with HashIgnoreHandles
+    std::hash<> and gvk::Hash<> with std::unordered_map<>
+    gvk::Hash<> and gvk::Equal<> with HashIgnoreHandles
+
+    (special case members)
+    VkShaderModuleCreateInfo
+*/
+
+TEST(Hash, Basic)
+{
+    VkExtent3D extent3D0{ };
+    extent3D0.width = 256;
+    extent3D0.height = 512;
+    extent3D0.depth = 1024;
+    auto extent3D1 = extent3D0;
+    EXPECT_EQ(gvk::hash(extent3D0), gvk::hash(extent3D1));
+
+    extent3D1.depth = 64;
+    EXPECT_NE(gvk::hash(extent3D0), gvk::hash(extent3D1));
+}
+
+TEST(Hash, FloatingPoint)
+{
+    VkViewport viewport0{ };
+    viewport0.width = 1280;
+    viewport0.height = 720;
+    viewport0.minDepth = 0.0f;
+    auto viewport1 = viewport0;
+    viewport1.minDepth = -0.0f;
+    ASSERT_EQ(viewport0, viewport1);
+    EXPECT_EQ(gvk::hash(viewport0), gvk::hash(viewport1));
+
+    viewport1.maxDepth = 1;
+    EXPECT_NE(gvk::hash(viewport0), gvk::hash(viewport1));
+}
+
+TEST(Hash, Union)
+{
+    VkClearValue clearValue0{ };
+    clearValue0.color.float32[0] = 0.5f;
+    clearValue0.color.float32[3] = 1;
+    auto clearValue1 = clearValue0;
+    EXPECT_EQ(gvk::hash(clearValue0), gvk::hash(clearValue1));
+
+    clearValue1.color.uint32[0] = 255;
+    EXPECT_NE(gvk::hash(clearValue0), gvk::hash(clearValue1));
+}
+
+TEST(Hash, DynamicArray)
+{
+    std::array<VkPushConstantRange, 2> pushConstantRanges0{ };
+    pushConstantRanges0[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushConstantRanges0[0].size = 64;
+    pushConstantRanges0[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    pushConstantRanges0[1].offset = 64;
+    pushConstantRanges0[1].size = 16;
+    auto pushConstantRanges1 = pushConstantRanges0;
+
+    auto pipelineLayoutCreateInfo0 = gvk::get_default<VkPipelineLayoutCreateInfo>();
+    pipelineLayoutCreateInfo0.pushConstantRangeCount = (uint32_t)pushConstantRanges0.size();
+    pipelineLayoutCreateInfo0.pPushConstantRanges = pushConstantRanges0.data();
+    auto pipelineLayoutCreateInfo1 = pipelineLayoutCreateInfo0;
+    pipelineLayoutCreateInfo1.pPushConstantRanges = pushConstantRanges1.data();
+    ASSERT_EQ(pipelineLayoutCreateInfo0, pipelineLayoutCreateInfo1);
+    EXPECT_EQ(gvk::hash(pipelineLayoutCreateInfo0), gvk::hash(pipelineLayoutCreateInfo1));
+
+    pushConstantRanges1[1].size = 32;
+    EXPECT_NE(gvk::hash(pipelineLayoutCreateInfo0), gvk::hash(pipelineLayoutCreateInfo1));
+
+    pipelineLayoutCreateInfo1.pPushConstantRanges = nullptr;
+    pipelineLayoutCreateInfo0.pushConstantRangeCount = 0;
+    pipelineLayoutCreateInfo1.pushConstantRangeCount = 0;
+    ASSERT_EQ(pipelineLayoutCreateInfo0, pipelineLayoutCreateInfo1);
+    EXPECT_EQ(gvk::hash(pipelineLayoutCreateInfo0), gvk::hash(pipelineLayoutCreateInfo1));
+}
+
+TEST(Hash, DynamicString)
+{
+    std::string name0 = "main";
+    std::string name1 = "main";
+    auto shaderStageCreateInfo0 = gvk::get_default<VkPipelineShaderStageCreateInfo>();
+    shaderStageCreateInfo0.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    shaderStageCreateInfo0.pName = name0.c_str();
+    auto shaderStageCreateInfo1 = shaderStageCreateInfo0;
+    shaderStageCreateInfo1.pName = name1.c_str();
+    ASSERT_EQ(shaderStageCreateInfo0, shaderStageCreateInfo1);
+    EXPECT_EQ(gvk::hash(shaderStageCreateInfo0), gvk::hash(shaderStageCreateInfo1));
+
+    name1 = "cs_main";
+    shaderStageCreateInfo1.pName = name1.c_str();
+    EXPECT_NE(gvk::hash(shaderStageCreateInfo0), gvk::hash(shaderStageCreateInfo1));
+}
+
+TEST(Hash, PNext)
+{
+    auto timelineSemaphoreCreateInfo0 = gvk::get_default<VkSemaphoreTypeCreateInfo>();
+    timelineSemaphoreCreateInfo0.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    auto timelineSemaphoreCreateInfo1 = timelineSemaphoreCreateInfo0;
+    auto semaphoreCreateInfo0 = gvk::get_default<VkSemaphoreCreateInfo>();
+    semaphoreCreateInfo0.pNext = &timelineSemaphoreCreateInfo0;
+    auto semaphoreCreateInfo1 = semaphoreCreateInfo0;
+    semaphoreCreateInfo1.pNext = &timelineSemaphoreCreateInfo1;
+    ASSERT_EQ(semaphoreCreateInfo0, semaphoreCreateInfo1);
+    EXPECT_EQ(gvk::hash(semaphoreCreateInfo0), gvk::hash(semaphoreCreateInfo1));
+
+    timelineSemaphoreCreateInfo1.initialValue = 8;
+    EXPECT_NE(gvk::hash(semaphoreCreateInfo0), gvk::hash(semaphoreCreateInfo1));
+
+    semaphoreCreateInfo1.pNext = nullptr;
+    EXPECT_NE(gvk::hash(semaphoreCreateInfo0), gvk::hash(semaphoreCreateInfo1));
+}
+
+TEST(Hash, StructureWithPointerToStructure)
+{
+    auto rasterizationStateCreateInfo0 = gvk::get_default<VkPipelineRasterizationStateCreateInfo>();
+    rasterizationStateCreateInfo0.cullMode = VK_CULL_MODE_BACK_BIT;
+    auto rasterizationStateCreateInfo1 = rasterizationStateCreateInfo0;
+    auto graphicsPipelineCreateInfo0 = gvk::get_default<VkGraphicsPipelineCreateInfo>();
+    graphicsPipelineCreateInfo0.pRasterizationState = &rasterizationStateCreateInfo0;
+    auto graphicsPipelineCreateInfo1 = graphicsPipelineCreateInfo0;
+    graphicsPipelineCreateInfo1.pRasterizationState = &rasterizationStateCreateInfo1;
+    ASSERT_EQ(graphicsPipelineCreateInfo0, graphicsPipelineCreateInfo1);
+    EXPECT_EQ(gvk::hash(graphicsPipelineCreateInfo0), gvk::hash(graphicsPipelineCreateInfo1));
+
+    rasterizationStateCreateInfo1.cullMode = VK_CULL_MODE_FRONT_BIT;
+    EXPECT_NE(gvk::hash(graphicsPipelineCreateInfo0), gvk::hash(graphicsPipelineCreateInfo1));
+}
+
+TEST(Hash, ShaderModuleCreateInfo)
+{
+    std::array<uint32_t, 4> code0{ 0x07230203, 0x00010000, 0x0008000b, 0x00000010 };
+    auto code1 = code0;
+    auto shaderModuleCreateInfo0 = gvk::get_default<VkShaderModuleCreateInfo>();
+    shaderModuleCreateInfo0.codeSize = code0.size() * sizeof(uint32_t);
+    shaderModuleCreateInfo0.pCode = code0.data();
+    auto shaderModuleCreateInfo1 = shaderModuleCreateInfo0;
+    shaderModuleCreateInfo1.pCode = code1.data();
+    ASSERT_EQ(shaderModuleCreateInfo0, shaderModuleCreateInfo1);
+    EXPECT_EQ(gvk::hash(shaderModuleCreateInfo0), gvk::hash(shaderModuleCreateInfo1));
+
+    code1[3] = 0x00000020;
+    EXPECT_NE(gvk::hash(shaderModuleCreateInfo0), gvk::hash(shaderModuleCreateInfo1));
+}
+
+TEST(Hash, Seed)
+{
+    VkExtent2D extent{ 1280, 720 };
+    EXPECT_EQ(gvk::hash(extent, 7), gvk::hash(extent, 7));
+    EXPECT_NE(gvk::hash(extent, 7), gvk::hash(extent, 11));
+}
+
+TEST(Hash, IgnoreHandles)
+{
+    std::array<VkDescriptorSetLayout, 2> setLayouts0{ (VkDescriptorSetLayout)1, (VkDescriptorSetLayout)2 };
+    std::array<VkDescriptorSetLayout, 2> setLayouts1{ (VkDescriptorSetLayout)3, (VkDescriptorSetLayout)4 };
+    auto pipelineLayoutCreateInfo0 = gvk::get_default<VkPipelineLayoutCreateInfo>();
+    pipelineLayoutCreateInfo0.setLayoutCount = (uint32_t)setLayouts0.size();
+    pipelineLayoutCreateInfo0.pSetLayouts = setLayouts0.data();
+    auto pipelineLayoutCreateInfo1 = pipelineLayoutCreateInfo0;
+    pipelineLayoutCreateInfo1.pSetLayouts = setLayouts1.data();
+    EXPECT_NE(gvk::hash(pipelineLayoutCreateInfo0), gvk::hash(pipelineLayoutCreateInfo1));
+    EXPECT_EQ(gvk::hash(pipelineLayoutCreateInfo0, 0, gvk::HashIgnoreHandles), gvk::hash(pipelineLayoutCreateInfo1, 0, gvk::HashIgnoreHandles));
+
+    pipelineLayoutCreateInfo1.setLayoutCount = 1;
+    EXPECT_NE(gvk::hash(pipelineLayoutCreateInfo0, 0, gvk::HashIgnoreHandles), gvk::hash(pipelineLayoutCreateInfo1, 0, gvk::HashIgnoreHandles));
+
+    auto samplerYcbcrConversionInfo0 = gvk::get_default<VkSamplerYcbcrConversionInfo>();
+    samplerYcbcrConversionInfo0.conversion = (VkSamplerYcbcrConversion)1;
+    auto samplerYcbcrConversionInfo1 = samplerYcbcrConversionInfo0;
+    samplerYcbcrConversionInfo1.conversion = (VkSamplerYcbcrConversion)2;
+    auto samplerCreateInfo0 = gvk::get_default<VkSamplerCreateInfo>();
+    samplerCreateInfo0.pNext = &samplerYcbcrConversionInfo0;
+    auto samplerCreateInfo1 = samplerCreateInfo0;
+    samplerCreateInfo1.pNext = &samplerYcbcrConversionInfo1;
+    EXPECT_NE(gvk::hash(samplerCreateInfo0), gvk::hash(samplerCreateInfo1));
+    EXPECT_EQ(gvk::hash(samplerCreateInfo0, 0, gvk::HashIgnoreHandles), gvk::hash(samplerCreateInfo1, 0, gvk::HashIgnoreHandles));
+}
+
+TEST(Hash, IgnoreHandlesManuallyImplemented)
+{
+    auto accelerationStructureBuildGeometryInfo0 = gvk::get_default<VkAccelerationStructureBuildGeometryInfoKHR>();
+    accelerationStructureBuildGeometryInfo0.dstAccelerationStructure = (VkAccelerationStructureKHR)1;
+    auto accelerationStructureBuildGeometryInfo1 = accelerationStructureBuildGeometryInfo0;
+    accelerationStructureBuildGeometryInfo1.dstAccelerationStructure = (VkAccelerationStructureKHR)2;
+    EXPECT_NE(gvk::hash(accelerationStructureBuildGeometryInfo0), gvk::hash(accelerationStructureBuildGeometryInfo1));
+    EXPECT_EQ(gvk::hash(accelerationStructureBuildGeometryInfo0, 0, gvk::HashIgnoreHandles), gvk::hash(accelerationStructureBuildGeometryInfo1, 0, gvk::HashIgnoreHandles));
+
+    std::array<VkDescriptorSetLayout, 2> setLayouts0{ (VkDescriptorSetLayout)1, (VkDescriptorSetLayout)2 };
+    std::array<VkDescriptorSetLayout, 2> setLayouts1{ (VkDescriptorSetLayout)3, (VkDescriptorSetLayout)4 };
+    auto shaderCreateInfo0 = gvk::get_default<VkShaderCreateInfoEXT>();
+    shaderCreateInfo0.setLayoutCount = (uint32_t)setLayouts0.size();
+    shaderCreateInfo0.pSetLayouts = setLayouts0.data();
+    auto shaderCreateInfo1 = shaderCreateInfo0;
+    shaderCreateInfo1.pSetLayouts = setLayouts1.data();
+    EXPECT_NE(gvk::hash(shaderCreateInfo0), gvk::hash(shaderCreateInfo1));
+    EXPECT_EQ(gvk::hash(shaderCreateInfo0, 0, gvk::HashIgnoreHandles), gvk::hash(shaderCreateInfo1, 0, gvk::HashIgnoreHandles));
+}
+
+TEST(Hash, UnorderedMap)
+{
+    auto samplerCreateInfo0 = gvk::get_default<VkSamplerCreateInfo>();
+    samplerCreateInfo0.magFilter = VK_FILTER_LINEAR;
+    samplerCreateInfo0.minFilter = VK_FILTER_LINEAR;
+    auto samplerCreateInfo1 = samplerCreateInfo0;
+    samplerCreateInfo1.maxAnisotropy = 16;
+
+    std::unordered_map<VkSamplerCreateInfo, VkSampler> samplers;
+    samplers[samplerCreateInfo0] = (VkSampler)1;
+    samplers[samplerCreateInfo1] = (VkSampler)2;
+    auto samplerCreateInfo2 = samplerCreateInfo0;
+    EXPECT_EQ(samplers.size(), 2u);
+    EXPECT_EQ(samplers[samplerCreateInfo2], (VkSampler)1);
+
+    std::unordered_map<VkSamplerCreateInfo, VkSampler, gvk::Hash<VkSamplerCreateInfo, gvk::HashIgnoreHandles>> ignoreHandleSamplers;
+    ignoreHandleSamplers[samplerCreateInfo0] = (VkSampler)1;
+    ignoreHandleSamplers[samplerCreateInfo1] = (VkSampler)2;
+    EXPECT_EQ(ignoreHandleSamplers.size(), 2u);
+    EXPECT_EQ(ignoreHandleSamplers[samplerCreateInfo2], (VkSampler)1);
+}
+
+TEST(Hash, EqualIgnoreHandles)
+{
+    std::array<VkDescriptorSetLayout, 2> setLayouts0{ (VkDescriptorSetLayout)1, (VkDescriptorSetLayout)2 };
+    std::array<VkDescriptorSetLayout, 2> setLayouts1{ (VkDescriptorSetLayout)3, (VkDescriptorSetLayout)4 };
+    auto pipelineLayoutCreateInfo0 = gvk::get_default<VkPipelineLayoutCreateInfo>();
+    pipelineLayoutCreateInfo0.setLayoutCount = (uint32_t)setLayouts0.size();
+    pipelineLayoutCreateInfo0.pSetLayouts = setLayouts0.data();
+    auto pipelineLayoutCreateInfo1 = pipelineLayoutCreateInfo0;
+    pipelineLayoutCreateInfo1.pSetLayouts = setLayouts1.data();
+    EXPECT_FALSE(gvk::equal(pipelineLayoutCreateInfo0, pipelineLayoutCreateInfo1));
+    EXPECT_TRUE(gvk::equal(pipelineLayoutCreateInfo0, pipelineLayoutCreateInfo1, gvk::HashIgnoreHandles));
+    EXPECT_EQ(gvk::equal(pipelineLayoutCreateInfo0, pipelineLayoutCreateInfo1), pipelineLayoutCreateInfo0 == pipelineLayoutCreateInfo1);
+
+    pipelineLayoutCreateInfo1.setLayoutCount = 1;
+    EXPECT_FALSE(gvk::equal(pipelineLayoutCreateInfo0, pipelineLayoutCreateInfo1, gvk::HashIgnoreHandles));
+
+    auto samplerYcbcrConversionInfo0 = gvk::get_default<VkSamplerYcbcrConversionInfo>();
+    samplerYcbcrConversionInfo0.conversion = (VkSamplerYcbcrConversion)1;
+    auto samplerYcbcrConversionInfo1 = samplerYcbcrConversionInfo0;
+    samplerYcbcrConversionInfo1.conversion = (VkSamplerYcbcrConversion)2;
+    auto samplerCreateInfo0 = gvk::get_default<VkSamplerCreateInfo>();
+    samplerCreateInfo0.pNext = &samplerYcbcrConversionInfo0;
+    auto samplerCreateInfo1 = samplerCreateInfo0;
+    samplerCreateInfo1.pNext = &samplerYcbcrConversionInfo1;
+    EXPECT_FALSE(gvk::equal(samplerCreateInfo0, samplerCreateInfo1));
+    EXPECT_TRUE(gvk::equal(samplerCreateInfo0, samplerCreateInfo1, gvk::HashIgnoreHandles));
+    samplerCreateInfo1.maxAnisotropy = 16;
+    EXPECT_FALSE(gvk::equal(samplerCreateInfo0, samplerCreateInfo1, gvk::HashIgnoreHandles));
+
+    auto accelerationStructureBuildGeometryInfo0 = gvk::get_default<VkAccelerationStructureBuildGeometryInfoKHR>();
+    accelerationStructureBuildGeometryInfo0.dstAccelerationStructure = (VkAccelerationStructureKHR)1;
+    auto accelerationStructureBuildGeometryInfo1 = accelerationStructureBuildGeometryInfo0;
+    accelerationStructureBuildGeometryInfo1.dstAccelerationStructure = (VkAccelerationStructureKHR)2;
+    EXPECT_FALSE(gvk::equal(accelerationStructureBuildGeometryInfo0, accelerationStructureBuildGeometryInfo1));
+    EXPECT_TRUE(gvk::equal(accelerationStructureBuildGeometryInfo0, accelerationStructureBuildGeometryInfo1, gvk::HashIgnoreHandles));
+}
+
+TEST(Hash, UnorderedMapIgnoreHandles)
+{
+    auto imageViewCreateInfo0 = gvk::get_default<VkImageViewCreateInfo>();
+    imageViewCreateInfo0.image = (VkImage)1;
+    imageViewCreateInfo0.format = VK_FORMAT_R8G8B8A8_UNORM;
+    auto imageViewCreateInfo1 = imageViewCreateInfo0;
+    imageViewCreateInfo1.image = (VkImage)2;
+    auto imageViewCreateInfo2 = imageViewCreateInfo0;
+    imageViewCreateInfo2.format = VK_FORMAT_B8G8R8A8_UNORM;
+
+    using IgnoreHandlesHash = gvk::Hash<VkImageViewCreateInfo, gvk::HashIgnoreHandles>;
+    using IgnoreHandlesEqual = gvk::Equal<VkImageViewCreateInfo, gvk::HashIgnoreHandles>;
+    std::unordered_map<VkImageViewCreateInfo, VkImageView, IgnoreHandlesHash, IgnoreHandlesEqual> imageViews;
+    imageViews[imageViewCreateInfo0] = (VkImageView)1;
+    imageViews[imageViewCreateInfo1] = (VkImageView)2;
+    EXPECT_EQ(imageViews.size(), 1u);
+    EXPECT_EQ(imageViews[imageViewCreateInfo0], (VkImageView)2);
+    imageViews[imageViewCreateInfo2] = (VkImageView)3;
+    EXPECT_EQ(imageViews.size(), 2u);
+}
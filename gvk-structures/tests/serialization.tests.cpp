@@ -27,6 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "gvk-structures/defaults.hpp"
+#include "gvk-structures/detail/mapped-binary-input-archive.hpp"
 #include "gvk-structures/serialization.hpp"
 #include "gvk-structures/to-string.hpp"
 #include "validate-structure-serialization.hpp"
@@ -38,7 +39,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gtest/gtest.h"
 
 #include <array>
+#include <memory>
+#include <numeric>
 #include <sstream>
+#include <vector>
 
 /*
 The following tests validate that generated serialization/deserialization functions work correctly
@@ -57,6 +61,13 @@ Test cases cover the following:
     (special case members)
     VkPipelineMultisampleStateCreateInfo
     VkShaderModuleCreateInfo
+
+    (bulk binary arrays)
+    BinaryCerealizable detection
+    Byte identical output for bulk and per element arrays
+
+    (mapped deserialization)
+    Arrays aliased into mapped memory
 */
 
 TEST(Serialization, Basic)
@@ -258,3 +269,125 @@ TEST(Serialization, VkShaderModuleCreateInfo)
     shaderModuleCreateInfo.pCode = spirv.data();
     gvk::validation::validate_structure_serialization(shaderModuleCreateInfo);
 }
+
+TEST(Serialization, BinaryCerealizable)
+{
+    EXPECT_TRUE(gvk::detail::BinaryCerealizable<uint8_t>::value);
+    EXPECT_TRUE(gvk::detail::BinaryCerealizable<uint32_t>::value);
+    EXPECT_TRUE(gvk::detail::BinaryCerealizable<float>::value);
+    EXPECT_TRUE(gvk::detail::BinaryCerealizable<VkFormat>::value);
+    EXPECT_TRUE(gvk::detail::BinaryCerealizable<VkExtent3D>::value);
+    EXPECT_TRUE(gvk::detail::BinaryCerealizable<VkViewport>::value);
+    EXPECT_TRUE(gvk::detail::BinaryCerealizable<VkImageSubresourceRange>::value);
+    EXPECT_FALSE(gvk::detail::BinaryCerealizable<VkClearValue>::value);
+    EXPECT_FALSE(gvk::detail::BinaryCerealizable<VkBufferCreateInfo>::value);
+    EXPECT_FALSE(gvk::detail::BinaryCerealizable<VkDescriptorBufferInfo>::value);
+}
+
+TEST(Serialization, BinaryCerealizableArrays)
+{
+    std::array<VkViewport, 4> viewports { };
+    for (size_t i = 0; i < viewports.size(); ++i) {
+        viewports[i] = { (float)i, (float)i * 2, 1920, 1080, 0, 1 };
+    }
+    std::stringstream bulkStrStrm(std::ios::binary | std::ios::in | std::ios::out);
+    {
+        cereal::BinaryOutputArchive archive(bulkStrStrm);
+        gvk::detail::cerealize_dynamic_array(archive, viewports.size(), viewports.data());
+    }
+    std::stringstream elementStrStrm(std::ios::binary | std::ios::in | std::ios::out);
+    {
+        cereal::BinaryOutputArchive archive(elementStrStrm);
+        archive(viewports.size());
+        for (const auto& viewport : viewports) {
+            archive(viewport);
+        }
+    }
+    EXPECT_EQ(bulkStrStrm.str(), elementStrStrm.str());
+
+    auto pipelineViewportStateCreateInfo = gvk::get_default<VkPipelineViewportStateCreateInfo>();
+    pipelineViewportStateCreateInfo.viewportCount = (uint32_t)viewports.size();
+    pipelineViewportStateCreateInfo.pViewports = viewports.data();
+    gvk::validation::validate_structure_serialization(pipelineViewportStateCreateInfo);
+
+    std::vector<uint32_t> spirv(1024 * 1024);
+    std::iota(spirv.begin(), spirv.end(), 0);
+    auto shaderModuleCreateInfo = gvk::get_default<VkShaderModuleCreateInfo>();
+    shaderModuleCreateInfo.codeSize = spirv.size() * sizeof(uint32_t);
+    shaderModuleCreateInfo.pCode = spirv.data();
+    gvk::validation::validate_structure_serialization(shaderModuleCreateInfo);
+}
+
+TEST(Serialization, MappedBinaryInputArchive)
+{
+    // NOTE : This test deserializes VkShaderModuleCreateInfo structures from a
+    //  std::istream and from a MappedBinaryInputArchive and validates that the
+    //  mapped structures alias the mapping and keep it alive.
+    const size_t ShaderModuleCount = 64;
+    const size_t CodeWordCount = 4096;
+    std::vector<std::vector<uint32_t>> spirv(ShaderModuleCount);
+    std::stringstream strStrm(std::ios::binary | std::ios::in | std::ios::out);
+    for (size_t i = 0; i < ShaderModuleCount; ++i) {
+        spirv[i].resize(CodeWordCount);
+        std::iota(spirv[i].begin(), spirv[i].end(), (uint32_t)i);
+        auto shaderModuleCreateInfo = gvk::get_default<VkShaderModuleCreateInfo>();
+        shaderModuleCreateInfo.codeSize = CodeWordCount * sizeof(uint32_t);
+        shaderModuleCreateInfo.pCode = spirv[i].data();
+        gvk::serialize(strStrm, shaderModuleCreateInfo);
+    }
+    auto serialized = strStrm.str();
+    auto spMapping = std::make_shared<std::vector<uint8_t>>(serialized.begin(), serialized.end());
+
+    std::vector<gvk::Auto<VkShaderModuleCreateInfo>> deserialized(ShaderModuleCount);
+    for (auto& shaderModuleCreateInfo : deserialized) {
+        gvk::deserialize(strStrm, nullptr, shaderModuleCreateInfo);
+    }
+
+    std::vector<gvk::Auto<VkShaderModuleCreateInfo>> mapped(ShaderModuleCount);
+    {
+        gvk::detail::MappedBinaryInputArchive archive(spMapping->data(), spMapping->size(), spMapping);
+        for (auto& shaderModuleCreateInfo : mapped) {
+            gvk::deserialize(archive, shaderModuleCreateInfo);
+        }
+        EXPECT_EQ(archive.get_offset(), archive.get_size());
+    }
+
+    auto pMappingBegin = (const uint8_t*)spMapping->data();
+    auto pMappingEnd = pMappingBegin + spMapping->size();
+    std::weak_ptr<std::vector<uint8_t>> wpMapping = spMapping;
+    spMapping.reset();
+    EXPECT_FALSE(wpMapping.expired());
+    for (size_t i = 0; i < ShaderModuleCount; ++i) {
+        EXPECT_EQ(*deserialized[i], *mapped[i]);
+        auto pCode = (const uint8_t*)mapped[i]->pCode;
+        EXPECT_TRUE(pMappingBegin <= pCode && pCode < pMappingEnd);
+        EXPECT_FALSE((uintptr_t)pCode % alignof(uint32_t));
+    }
+    mapped.clear();
+    EXPECT_TRUE(wpMapping.expired());
+}
+
+TEST(Serialization, MappedBinaryInputArchiveShaderCreateInfoCodeAlignment)
+{
+    std::vector<uint32_t> spirv(256);
+    std::iota(spirv.begin(), spirv.end(), 0);
+    auto shaderCreateInfo = gvk::get_default<VkShaderCreateInfoEXT>();
+    shaderCreateInfo.codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+    shaderCreateInfo.codeSize = spirv.size() * sizeof(uint32_t);
+    shaderCreateInfo.pCode = spirv.data();
+    shaderCreateInfo.pName = "main";
+
+    // NOTE : Offsetting the serialized structure by each byte in a uint32_t
+    //  ensures pCode lands on every possible misalignment in the mapping
+    for (size_t padding = 0; padding < sizeof(uint32_t); ++padding) {
+        std::stringstream strStrm(std::ios::binary | std::ios::in | std::ios::out);
+        gvk::serialize(strStrm, shaderCreateInfo);
+        auto serialized = std::string(padding, '\0') + strStrm.str();
+        auto spMapping = std::make_shared<std::vector<uint8_t>>(serialized.begin(), serialized.end());
+        gvk::detail::MappedBinaryInputArchive archive(spMapping->data() + padding, spMapping->size() - padding, spMapping);
+        gvk::Auto<VkShaderCreateInfoEXT> mapped;
+        gvk::deserialize(archive, mapped);
+        EXPECT_EQ(*mapped, shaderCreateInfo);
+        EXPECT_FALSE((uintptr_t)mapped->pCode % alignof(uint32_t));
+    }
+}
@@ -24,6 +24,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 *******************************************************************************/
 
+#include "gvk-structures/defaults.hpp"
 #include "gvk-structures/get-stype.hpp"
 #include "gvk-structures/to-string.hpp"
 
@@ -33,6 +34,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #endif
 #include "gtest/gtest.h"
 
+#include <array>
+#include <sstream>
+#include <string>
+#include <vector>
+
 TEST(structure, to_string)
 {
     VkInstanceCreateInfo instanceCreateInfo { };
@@ -261,3 +267,145 @@ TEST(structure, to_string)
 })");
 #endif
 }
+
+TEST(structure, to_string_blob)
+{
+    std::array<uint32_t, 4> code { 0x07230203, 0x00010000, 0, 0 };
+    auto shaderModuleCreateInfo = gvk::get_default<VkShaderModuleCreateInfo>();
+    shaderModuleCreateInfo.codeSize = code.size() * sizeof(uint32_t);
+    shaderModuleCreateInfo.pCode = code.data();
+    auto hash = gvk::to_hex_string(gvk::string::hash(code.data(), shaderModuleCreateInfo.codeSize));
+    EXPECT_EQ(gvk::to_string(shaderModuleCreateInfo, gvk::Printer::EnumIdentifier | gvk::Printer::BlobBase64), R"({"sType":"VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO","pNext":null,"flags":0,"codeSize":16,"pCode":{"count":4,"size":16,"hash":")" + hash + R"(","data":"AwIjBwAAAQAAAAAAAAAAAA=="}})");
+
+    std::array<uint8_t, 6> data { 1, 2, 3, 4, 5, 6 };
+    VkSpecializationInfo specializationInfo { };
+    specializationInfo.dataSize = data.size();
+    specializationInfo.pData = data.data();
+    EXPECT_EQ(gvk::to_string(specializationInfo, 0), R"({"mapEntryCount":0,"pMapEntries":null,"dataSize":6,"pData":[1,2,3,4,5,6]})");
+    gvk::Printer::BlobOptions blobOptions { };
+    blobOptions.truncateCount = 2;
+    gvk::PrinterBuffer buffer;
+    {
+        gvk::Printer printer(buffer, gvk::Printer::BlobTruncate);
+        printer.set_blob_options(blobOptions);
+        gvk::print(printer, specializationInfo);
+    }
+    hash = gvk::to_hex_string(gvk::string::hash(data.data(), data.size()));
+    EXPECT_EQ(buffer.get_string(), R"({"mapEntryCount":0,"pMapEntries":null,"dataSize":6,"pData":{"count":6,"hash":")" + hash + R"(","elements":[1,2]}})");
+}
+
+TEST(structure, PrinterBufferVkWriteDescriptorSets)
+{
+    // NOTE : This test validates that streaming an array of VkWriteDescriptorSet
+    //  structures through a single Printer produces the same output as calling
+    //  to_string() for each structure, including when the PrinterBuffer flushes
+    //  to its target std::ostream in small batches.
+    const size_t WriteCount = 64;
+    const gvk::Printer::Flags Flags = gvk::Printer::EnumIdentifier | gvk::Printer::EnumValue;
+    std::array<VkDescriptorImageInfo, 4> imageInfos { };
+    for (size_t i = 0; i < imageInfos.size(); ++i) {
+        imageInfos[i].sampler = (VkSampler)(i + 1);
+        imageInfos[i].imageView = (VkImageView)(i + 16);
+        imageInfos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
+    std::vector<VkWriteDescriptorSet> writeDescriptorSets(WriteCount, gvk::get_default<VkWriteDescriptorSet>());
+    for (size_t i = 0; i < writeDescriptorSets.size(); ++i) {
+        writeDescriptorSets[i].dstSet = (VkDescriptorSet)(i + 64);
+        writeDescriptorSets[i].dstBinding = (uint32_t)i;
+        writeDescriptorSets[i].descriptorCount = (uint32_t)imageInfos.size();
+        writeDescriptorSets[i].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writeDescriptorSets[i].pImageInfo = imageInfos.data();
+    }
+
+    std::string expected = "{\"writeDescriptorSets\":[";
+    for (size_t i = 0; i < writeDescriptorSets.size(); ++i) {
+        expected += (i ? "," : "") + gvk::to_string(writeDescriptorSets[i], Flags);
+    }
+    expected += "]}";
+
+    auto printWriteDescriptorSets = [&](gvk::Printer& printer)
+    {
+        printer.print_object(
+            [&]()
+            {
+                printer.print_array("writeDescriptorSets", (uint32_t)writeDescriptorSets.size(), writeDescriptorSets.data());
+            }
+        );
+    };
+    gvk::PrinterBuffer buffer;
+    {
+        gvk::Printer printer(buffer, Flags);
+        printWriteDescriptorSets(printer);
+    }
+    EXPECT_EQ(buffer.get_string(), expected);
+    std::stringstream strStrm;
+    {
+        gvk::PrinterBuffer streamBuffer(strStrm, 16);
+        gvk::Printer printer(streamBuffer, Flags);
+        printWriteDescriptorSets(printer);
+    }
+    EXPECT_EQ(strStrm.str(), expected);
+}
+
+TEST(structure, PrinterBufferCmdDump)
+{
+    // NOTE : This test models a CmdTracker dump of a command buffer with a mix of
+    //  small fixed size structures and structures with nested arrays, and
+    //  validates that streamed output matches to_string() for each command.
+    const size_t CmdCount = 64;
+    const gvk::Printer::Flags Flags = gvk::Printer::EnumIdentifier;
+    auto imageMemoryBarrier = gvk::get_default<VkImageMemoryBarrier>();
+    imageMemoryBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    imageMemoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    imageMemoryBarrier.image = (VkImage)64;
+    imageMemoryBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    std::array<VkBufferCopy, 2> bufferCopies { };
+    bufferCopies[0] = { 0, 256, 1024 };
+    bufferCopies[1] = { 1024, 4096, 512 };
+    auto copyBufferInfo = gvk::get_default<VkCopyBufferInfo2>();
+    copyBufferInfo.srcBuffer = (VkBuffer)1;
+    copyBufferInfo.dstBuffer = (VkBuffer)2;
+    std::array<VkBufferCopy2, 2> bufferCopy2s { };
+    for (size_t i = 0; i < bufferCopy2s.size(); ++i) {
+        bufferCopy2s[i] = gvk::get_default<VkBufferCopy2>();
+        bufferCopy2s[i].srcOffset = bufferCopies[i].srcOffset;
+        bufferCopy2s[i].dstOffset = bufferCopies[i].dstOffset;
+        bufferCopy2s[i].size = bufferCopies[i].size;
+    }
+    copyBufferInfo.regionCount = (uint32_t)bufferCopy2s.size();
+    copyBufferInfo.pRegions = bufferCopy2s.data();
+    VkViewport viewport { 0, 0, 1920, 1080, 0, 1 };
+
+    std::string expected = "{";
+    for (size_t i = 0; i < CmdCount; ++i) {
+        expected += i ? "," : "";
+        switch (i % 4) {
+        case 0: expected += "\"vkCmdPipelineBarrier\":" + gvk::to_string(imageMemoryBarrier, Flags); break;
+        case 1: expected += "\"vkCmdCopyBuffer2\":" + gvk::to_string(copyBufferInfo, Flags); break;
+        case 2: expected += "\"vkCmdCopyBuffer\":[" + gvk::to_string(bufferCopies[0], Flags) + "," + gvk::to_string(bufferCopies[1], Flags) + "]"; break;
+        case 3: expected += "\"vkCmdSetViewport\":" + gvk::to_string(viewport, Flags); break;
+        }
+    }
+    expected += "}";
+
+    std::stringstream strStrm;
+    {
+        gvk::Printer printer(strStrm, Flags);
+        printer.print_object(
+            [&]()
+            {
+                for (size_t i = 0; i < CmdCount; ++i) {
+                    switch (i % 4) {
+                    case 0: printer.print_field("vkCmdPipelineBarrier", imageMemoryBarrier); break;
+                    case 1: printer.print_field("vkCmdCopyBuffer2", copyBufferInfo); break;
+                    case 2: printer.print_array("vkCmdCopyBuffer", (uint32_t)bufferCopies.size(), bufferCopies.data()); break;
+                    case 3: printer.print_field("vkCmdSetViewport", viewport); break;
+                    }
+                }
+            }
+        );
+    }
+    EXPECT_EQ(strStrm.str(), expected);
+}
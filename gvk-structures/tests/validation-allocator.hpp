@@ -61,6 +61,11 @@ public:
         return mAllocationCallbacks;
     }
 
+    inline size_t get_allocation_count() const
+    {
+        return mAllocations.size();
+    }
+
     inline static void* validate_allocation(void* pUserData, size_t size, size_t, VkSystemAllocationScope)
     {
         auto pMemory = malloc(size);
@@ -0,0 +1,81 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef VK_LAYER_INTEL_gvk_virtual_swapchain_h
+#define VK_LAYER_INTEL_gvk_virtual_swapchain_h 1
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "vulkan/vulkan.h"
+
+#define VK_LAYER_INTEL_GVK_VIRTUAL_SWAPCHAIN_NAME "VK_LAYER_INTEL_gvk_virtual_swapchain"
+
+typedef enum GvkFrameReadbackFlagBits {
+    GVK_FRAME_READBACK_RAW_BIT = 0x00000001,
+    GVK_FRAME_READBACK_PNG_BIT = 0x00000002,
+    GVK_FRAME_READBACK_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
+} GvkFrameReadbackFlagBits;
+typedef VkFlags GvkFrameReadbackFlags;
+
+typedef struct GvkFrameReadbackData {
+    VkDevice device;
+    VkSwapchainKHR swapchain;
+    uint64_t frameIndex;
+    uint32_t imageIndex;
+    VkFormat format;
+    VkExtent2D extent;
+    uint64_t latency;
+    VkDeviceSize size;
+    const uint8_t* pData;
+} GvkFrameReadbackData;
+
+typedef void(VKAPI_PTR* PFN_gvkProcessFrameReadbackDataCallback)(const GvkFrameReadbackData* pFrameReadbackData);
+
+typedef struct GvkFrameReadbackInfo {
+    GvkFrameReadbackFlags flags;
+    uint32_t frameInterval;
+    uint32_t frameCount;
+    const char* pPath;
+    PFN_gvkProcessFrameReadbackDataCallback pfnProcessFrameReadbackDataCallback;
+} GvkFrameReadbackInfo;
+
+typedef struct GvkFrameReadbackStatistics {
+    uint64_t capturedFrameCount;
+    uint64_t processedFrameCount;
+    uint64_t droppedFrameCount;
+    uint64_t lastLatency;
+    uint64_t averageLatency;
+    uint64_t maxLatency;
+} GvkFrameReadbackStatistics;
+
+typedef void(VKAPI_PTR* PFN_gvkSetFrameReadbackInfo)(VkDevice device, const GvkFrameReadbackInfo* pFrameReadbackInfo);
+typedef void(VKAPI_PTR* PFN_gvkGetFrameReadbackStatistics)(VkDevice device, GvkFrameReadbackStatistics* pFrameReadbackStatistics);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // VK_LAYER_INTEL_gvk_virtual_swapchain_h
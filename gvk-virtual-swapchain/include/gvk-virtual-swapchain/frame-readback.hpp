@@ -0,0 +1,177 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#pragma once
+
+#include "gvk-defines.hpp"
+#include "gvk-handles.hpp"
+#include "VK_LAYER_INTEL_gvk_virtual_swapchain.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gvk {
+namespace virtual_swapchain {
+
+/**
+Provides configuration for frame readback
+    @note FrameReadbackInfo::from_env() populates FrameReadbackInfo from the following environment variables...
+        GVK_VIRTUAL_SWAPCHAIN_READBACK_INTERVAL : Every Nth presented frame is read back, 0 (default) disables readback
+        GVK_VIRTUAL_SWAPCHAIN_READBACK_FRAME_COUNT : The number of frames that may be in flight for readback (default 3)
+        GVK_VIRTUAL_SWAPCHAIN_READBACK_FORMAT : "raw" (default) or "png"
+        GVK_VIRTUAL_SWAPCHAIN_READBACK_PATH : The directory to write frames to (default the current working directory)
+*/
+class FrameReadbackInfo final
+{
+public:
+    static FrameReadbackInfo from_env();
+    FrameReadbackInfo() = default;
+    FrameReadbackInfo(const GvkFrameReadbackInfo& frameReadbackInfo);
+
+    GvkFrameReadbackFlags flags{ GVK_FRAME_READBACK_RAW_BIT };
+    uint32_t frameInterval{ };
+    uint32_t frameCount{ 3 };
+    std::filesystem::path path;
+    PFN_gvkProcessFrameReadbackDataCallback pfnProcessFrameReadbackDataCallback{ };
+};
+
+/**
+Provides thread safe frame readback counters
+    @note Latencies are measured in nanoseconds from vkQueuePresentKHR() to the frame's data being available on the host
+*/
+class FrameReadbackStatistics final
+{
+public:
+    void on_frame_captured();
+    void on_frame_dropped();
+    void on_frame_processed(uint64_t latency);
+    GvkFrameReadbackStatistics get() const;
+
+private:
+    mutable std::mutex mMutex;
+    GvkFrameReadbackStatistics mStatistics{ };
+    uint64_t mTotalLatency{ };
+};
+
+/**
+Copies presented images into a ring of host visible VkBuffers that are processed on a background thread
+    @note If every VkBuffer in the ring is in use when a frame is due for readback, the frame is dropped rather than stalling the presenting thread
+*/
+class FrameReadback final
+{
+public:
+    FrameReadback() = default;
+    ~FrameReadback();
+
+    /**
+    Creates resources for reading back images presented to a given swapchain
+    @param [in] gvkDevice The Device that owns the swapchain
+    @param [in] swapchain The VkSwapchainKHR to read back images from
+    @param [in] swapchainCreateInfo The VkSwapchainCreateInfoKHR used to create the swapchain
+    @param [in] frameReadbackInfo The FrameReadbackInfo to use
+    @param [in] spStatistics The FrameReadbackStatistics to update
+    @return The VkResult
+    */
+    VkResult create(const Device& gvkDevice, VkSwapchainKHR swapchain, const VkSwapchainCreateInfoKHR& swapchainCreateInfo, const FrameReadbackInfo& frameReadbackInfo, const std::shared_ptr<FrameReadbackStatistics>& spStatistics);
+
+    /**
+    Records a readback of a presented image if the current frame is due for readback
+    @param [in] gvkQueue The Queue the image is being presented on
+    @param [in] imageIndex The index of the image being presented
+    @param [in] image The VkImage being presented
+    @param [out] pCommandBuffer The VkCommandBuffer to submit after the image's final layout transition, VK_NULL_HANDLE if the frame isn't being read back
+    @return The VkResult
+        @note The VkImage must be in VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, it's returned to VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+        @note If a VkCommandBuffer is provided, end_frame() must be called after it's submitted
+    */
+    VkResult begin_frame(const Queue& gvkQueue, uint32_t imageIndex, VkImage image, VkCommandBuffer* pCommandBuffer);
+
+    /**
+    Submits a VkFence that's signaled when the readback recorded by the last call to begin_frame() is complete
+    @param [in] gvkQueue The Queue the readback VkCommandBuffer was submitted to
+    @return The VkResult
+    */
+    VkResult end_frame(const Queue& gvkQueue);
+
+    /**
+    Waits for pending readbacks to be processed and destroys this FrameReadback object's resources
+    */
+    void reset();
+
+private:
+    enum class State
+    {
+        Available,
+        Recorded,
+        Pending,
+    };
+
+    class Frame final
+    {
+    public:
+        State state{ State::Available };
+        uint64_t frameIndex{ };
+        uint32_t imageIndex{ };
+        std::chrono::steady_clock::time_point presentTime{ };
+        Buffer buffer;
+        DeviceMemory deviceMemory;
+        const uint8_t* pData{ };
+        Fence fence;
+        uint32_t queueFamilyIndex{ VK_QUEUE_FAMILY_IGNORED };
+        CommandPool commandPool;
+        VkCommandBuffer commandBuffer{ };
+    };
+
+    VkResult record_command_buffer(const Queue& gvkQueue, VkImage image, Frame* pFrame);
+    void process_frames();
+    void process_frame(const Frame& frame);
+
+    Device mGvkDevice;
+    VkSwapchainKHR mVkSwapchain{ };
+    VkFormat mFormat{ };
+    VkExtent2D mExtent{ };
+    VkDeviceSize mFrameSize{ };
+    FrameReadbackInfo mFrameReadbackInfo;
+    std::shared_ptr<FrameReadbackStatistics> mspStatistics;
+    uint64_t mPresentCount{ };
+    Frame* mpRecordedFrame{ };
+    std::vector<Frame> mFrames;
+    std::mutex mMutex;
+    std::condition_variable mConditionVariable;
+    bool mStop{ };
+    std::thread mThread;
+
+    FrameReadback(const FrameReadback&) = delete;
+    FrameReadback& operator=(const FrameReadback&) = delete;
+};
+
+} // namespace virtual_swapchain
+} // namespace gvk
@@ -29,12 +29,18 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-defines.hpp"
 #include "gvk-handles.hpp"
 #include "gvk-layer.hpp"
+#include "gvk-virtual-swapchain/frame-readback.hpp"
 
+#include <array>
+#include <chrono>
+#include <deque>
+#include <memory>
 #include <set>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace gvk {
 namespace virtual_swapchain {
@@ -42,37 +48,142 @@ namespace virtual_swapchain {
 using ActualVkImage = VkImage;
 using VirtualVkImage = VkImage;
 
+/**
+Specifies how a headless swapchain paces vkAcquireNextImageKHR()
+*/
+enum class PresentPacing
+{
+    Unlocked,      //!< Images are made available as soon as their previous present completes
+    FixedInterval, //!< Images are made available no more than once per present interval
+    Fifo,          //!< VK_PRESENT_MODE_FIFO_KHR and VK_PRESENT_MODE_FIFO_RELAXED_KHR swapchains are paced at the present interval, other present modes are unlocked
+};
+
+/**
+Provides configuration for headless presentation
+    @note HeadlessInfo is populated from the following environment variables...
+        GVK_VIRTUAL_SWAPCHAIN_HEADLESS : "true" to enable headless presentation
+        GVK_VIRTUAL_SWAPCHAIN_PRESENT_PACING : "unlocked", "interval", or "fifo" (default)
+        GVK_VIRTUAL_SWAPCHAIN_PRESENT_INTERVAL : The present interval in microseconds (default 16667)
+*/
+class HeadlessInfo final
+{
+public:
+    static HeadlessInfo from_env();
+
+    bool enabled{ };
+    PresentPacing presentPacing{ PresentPacing::Fifo };
+    std::chrono::microseconds presentInterval{ 16667 };
+};
+
+/**
+Provides reusable VkDeviceMemory for virtual VkImages
+    @note Swapchains are commonly recreated every frame while a window is being resized, VirtualImagePool keeps the VkDeviceMemory of destroyed swapchains available so recreated swapchains that fit in it don't need a new allocation
+*/
+class VirtualImagePool final
+{
+public:
+    /**
+    Creates virtual VkImages for a given VkSwapchainCreateInfoKHR and binds them to a single VkDeviceMemory
+    @param [in] gvkDevice The Device to create the virtual VkImages with
+    @param [in] swapchainCreateInfo The VkSwapchainCreateInfoKHR to create virtual VkImages for
+    @param [in] imageCount The number of virtual VkImages to create
+    @param [out] pGvkDeviceMemory The DeviceMemory the virtual VkImages are bound to
+    @param [out] pVirtualVkImages The created virtual VkImages
+    @return The VkResult
+        @note If swapchainCreateInfo.oldSwapchain is valid, newly allocated VkDeviceMemory is given headroom so subsequent recreations that grow the swapchain can reuse it
+    */
+    VkResult create_images(const Device& gvkDevice, const VkSwapchainCreateInfoKHR& swapchainCreateInfo, uint32_t imageCount, DeviceMemory* pGvkDeviceMemory, std::vector<VirtualVkImage>* pVirtualVkImages);
+
+    /**
+    Destroys virtual VkImages and makes the VkDeviceMemory they were bound to available for reuse
+    @param [in,out] pGvkDeviceMemory The DeviceMemory the virtual VkImages are bound to
+    @param [in,out] pVirtualVkImages The virtual VkImages to destroy
+        @note The virtual VkImages must not be in use by the device
+    */
+    void destroy_images(DeviceMemory* pGvkDeviceMemory, std::vector<VirtualVkImage>* pVirtualVkImages);
+
+    /**
+    Releases all VkDeviceMemory held by this VirtualImagePool
+    */
+    void reset();
+
+private:
+    static constexpr uint32_t MaxAvailableAllocationCount = 2;
+    std::vector<DeviceMemory> mAvailableAllocations;
+};
+
 class Swapchain final
 {
 public:
     Swapchain() = default;
     Swapchain(Swapchain&& other);
     Swapchain& operator=(Swapchain&& other);
-    VkResult post_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain);
-    void pre_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator);
+    VkResult post_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain, VirtualImagePool* pVirtualImagePool);
+    void destroy(VirtualImagePool* pVirtualImagePool);
     VkResult post_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages);
-    VkResult pre_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex);
+    VkResult pre_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex, Fence* pCopyFence);
     VkResult post_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex);
     VkResult pre_vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex);
     VkResult post_vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex);
-    void pre_vkQueuePresentKHR(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+    VkResult pre_vkQueuePresentKHR(const Queue& gvkQueue, uint32_t imageIndex, VkCommandBuffer* pCommandBuffer, VkSemaphore* pSemaphore, uint32_t* pActualImageIndex);
+    void on_copies_submitted(uint32_t imageIndex, const Fence& fence);
+    const std::vector<Fence>& get_copy_fences() const;
+    VkImage get_image(uint32_t imageIndex) const;
 
 private:
+    VkResult record_command_buffers(uint32_t queueFamilyIndex, std::pair<CommandPool, std::vector<VkCommandBuffer>>* pCommandResources);
+
     Device mGvkDevice;
     VkSwapchainKHR mVkSwapchain{ };
     VkExtent2D mExtent{ };
     DeviceMemory mGvkDeviceMemory;
     std::vector<ActualVkImage> mActualImages;
-    std::vector<VkImageLayout> mImageLayouts;
+    std::vector<Semaphore> mActualImageSemaphores;
     std::vector<VirtualVkImage> mVirtualVkImages;
+    std::vector<Fence> mVirtualImageCopyFences;
     std::unordered_set<uint32_t> mAvailableVkImages;
     std::unordered_map<uint32_t, uint32_t> mAcquiredVkImages;
     uint32_t mPendingAcquisition{ UINT32_MAX };
+    using QueueFamilyIndex = uint32_t;
+    std::unordered_map<QueueFamilyIndex, std::pair<CommandPool, std::vector<VkCommandBuffer>>> mCommandBuffers;
+    std::vector<Fence> mCopyFences;
 
     Swapchain(const Swapchain&) = delete;
     Swapchain& operator=(const Swapchain&) = delete;
 };
 
+class HeadlessSwapchain final
+{
+public:
+    HeadlessSwapchain() = default;
+    HeadlessSwapchain(HeadlessSwapchain&& other) = default;
+    HeadlessSwapchain& operator=(HeadlessSwapchain&& other) = default;
+    VkResult create(const Device& gvkDevice, const VkSwapchainCreateInfoKHR* pCreateInfo, const HeadlessInfo& headlessInfo, VirtualImagePool* pVirtualImagePool);
+    void destroy(VirtualImagePool* pVirtualImagePool);
+    VkResult get_images(uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const;
+    VkResult acquire_next_image(uint64_t timeout, uint32_t* pImageIndex, VkSemaphore* pPresentSemaphore, std::chrono::steady_clock::time_point* pAvailableTime);
+    VkResult present(const Queue& gvkQueue, uint32_t imageIndex, VkSemaphore* pPresentSemaphore);
+    void cancel_present(uint32_t imageIndex);
+    const Queue& get_queue() const;
+    VkImage get_image(uint32_t imageIndex) const;
+
+private:
+    Device mGvkDevice;
+    Queue mGvkQueue;
+    VkPresentModeKHR mPresentMode{ };
+    std::chrono::nanoseconds mPresentInterval{ };
+    std::chrono::steady_clock::time_point mAvailableTime{ };
+    DeviceMemory mGvkDeviceMemory;
+    std::vector<VirtualVkImage> mVirtualVkImages;
+    std::vector<Semaphore> mPresentSemaphores;
+    std::vector<bool> mPresentsPending;
+    std::deque<uint32_t> mAvailableVkImages;
+    std::unordered_set<uint32_t> mAcquiredVkImages;
+
+    HeadlessSwapchain(const HeadlessSwapchain&) = delete;
+    HeadlessSwapchain& operator=(const HeadlessSwapchain&) = delete;
+};
+
 class Layer final
     : public layer::BasicLayer
 {
@@ -125,18 +236,101 @@ public:
     void post_vkSetLocalDimmingAMD(VkDevice device, VkSwapchainKHR swapchain, VkBool32 localDimmingEnable) override final;
     VkResult pre_vkWaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout, VkResult gvkResult) override final;
     VkResult post_vkWaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout, VkResult gvkResult) override final;
-    VkResult pre_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo, VkResult gvkResult) override final;
-    VkResult post_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo, VkResult gvkResult) override final;
+    VkResult pre_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence, VkResult gvkResult) override final;
+    VkResult post_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence, VkResult gvkResult) override final;
+    VkResult pre_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, VkResult gvkResult) override final;
+    VkResult post_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, VkResult gvkResult) override final;
+    VkResult pre_vkQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult) override final;
+    VkResult post_vkQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult) override final;
+    VkResult pre_vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult) override final;
+    VkResult post_vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult) override final;
+    VkResult pre_vkQueueWaitIdle(VkQueue queue, VkResult gvkResult) override final;
+    VkResult post_vkQueueWaitIdle(VkQueue queue, VkResult gvkResult) override final;
+
+    /**
+    Registers the entry points this layer implements directly rather than through pre_/post_ hooks
+    @param [in] registry The gvk::layer::Registry to register entry points with
+        @note vkQueuePresentKHR() is intercepted so the present can be called down the chain with a copy of the application's VkPresentInfoKHR
+        @note If headless presentation is enabled, VK_KHR_surface queries and VK_KHR_swapchain entry points are replaced with headless implementations
+        @note Headless entry points don't call down the chain, VkSurfaceKHR creation and destruction are left to the loader (VK_EXT_headless_surface doesn't require a window system)
+    */
+    void register_intercepted_entry_points(layer::Registry& registry);
+
+    /**
+    Sets the GvkFrameReadbackInfo for a given VkDevice
+    @param [in] device The VkDevice to set the GvkFrameReadbackInfo for
+    @param [in] pFrameReadbackInfo The GvkFrameReadbackInfo to set, nullptr disables frame readback
+        @note The GvkFrameReadbackInfo is applied to VkSwapchainKHR objects created after this call
+    */
+    static void set_frame_readback_info(VkDevice device, const GvkFrameReadbackInfo* pFrameReadbackInfo);
+
+    /**
+    Gets the GvkFrameReadbackStatistics for a given VkDevice
+    @param [in] device The VkDevice to get the GvkFrameReadbackStatistics for
+    @param [out] pFrameReadbackStatistics The GvkFrameReadbackStatistics for the given VkDevice
+    */
+    static void get_frame_readback_statistics(VkDevice device, GvkFrameReadbackStatistics* pFrameReadbackStatistics);
 
 private:
-    VkResult get_command_buffer(const Queue& gvkQueue, VkCommandBuffer* pCommandBuffer);
+    static constexpr uint32_t FrameCount = 3;
+
+    class FrameFences final
+    {
+    public:
+        VkDevice device{ };
+        uint32_t frameIndex{ };
+        std::array<Fence, FrameCount> fences;
+    };
+
+    class RetiredSwapchain final
+    {
+    public:
+        Device gvkDevice;
+        std::vector<Fence> fences;
+        Swapchain swapchain;
+    };
+
+    class DeviceFrameReadback final
+    {
+    public:
+        FrameReadbackInfo frameReadbackInfo;
+        std::shared_ptr<FrameReadbackStatistics> spStatistics;
+    };
+
+    VkResult submit_frame(const Queue& gvkQueue, const VkSubmitInfo& submitInfo, Fence* pFence = nullptr);
+    std::mutex& get_queue_mutex(VkQueue queue);
+    void get_frame_fences(VkDevice device, std::vector<Fence>* pFences) const;
+    VkResult wait_for_frame_fences(VkDevice device);
+    void destroy_retired_swapchains(VkDevice device, bool force);
+    VkResult create_frame_readback(const Device& gvkDevice, VkSwapchainKHR swapchain, const VkSwapchainCreateInfoKHR& swapchainCreateInfo);
+    VkResult begin_frame_readback(const Queue& gvkQueue, VkSwapchainKHR swapchain, uint32_t imageIndex, VkImage image, std::vector<VkCommandBuffer>* pCommandBuffers, std::vector<FrameReadback*>* pFrameReadbacks);
+
+    static Layer& get_layer();
+    static VkResult VKAPI_CALL intercepted_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo);
+    static VkResult VKAPI_CALL headless_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported);
+    static VkResult VKAPI_CALL headless_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities);
+    static VkResult VKAPI_CALL headless_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats);
+    static VkResult VKAPI_CALL headless_vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes);
+    static VkResult VKAPI_CALL headless_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain);
+    static void VKAPI_CALL headless_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator);
+    static VkResult VKAPI_CALL headless_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages);
+    static VkResult VKAPI_CALL headless_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex);
+    static VkResult VKAPI_CALL headless_vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex);
+    static VkResult VKAPI_CALL headless_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo);
 
     std::mutex mMutex;
     Instance mGvkInstance;
     std::set<Device> mGvkDevices;
     std::unordered_map<VkSwapchainKHR, Swapchain> mSwapchains;
-    using QueueFamilyIndex = uint32_t;
-    std::unordered_map<VkDevice, std::unordered_map<QueueFamilyIndex, std::pair<CommandPool, VkCommandBuffer>>> mCommandBuffers;
+    std::vector<RetiredSwapchain> mRetiredSwapchains;
+    std::unordered_map<VkDevice, VirtualImagePool> mVirtualImagePools;
+    std::unordered_map<VkQueue, FrameFences> mFrameFences;
+    std::unordered_map<VkQueue, std::mutex> mQueueMutexes;
+    HeadlessInfo mHeadlessInfo;
+    uint64_t mHeadlessSwapchainCount{ };
+    std::unordered_map<VkSwapchainKHR, HeadlessSwapchain> mHeadlessSwapchains;
+    std::unordered_map<VkDevice, DeviceFrameReadback> mDeviceFrameReadbacks;
+    std::unordered_map<VkSwapchainKHR, std::unique_ptr<FrameReadback>> mFrameReadbacks;
 };
 
 } // namespace virtual_swapchain
@@ -0,0 +1,416 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-virtual-swapchain/frame-readback.hpp"
+#include "gvk-format-info.hpp"
+#include "gvk-handles/utilities.hpp"
+#include "gvk-string/to-string.hpp"
+#include "gvk-string/utilities.hpp"
+#include "gvk-environment.hpp"
+
+#include "stb/stb_image_write.h"
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace gvk {
+namespace virtual_swapchain {
+
+FrameReadbackInfo FrameReadbackInfo::from_env()
+{
+    FrameReadbackInfo frameReadbackInfo{ };
+    auto frameInterval = get_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_INTERVAL");
+    if (!frameInterval.empty()) {
+        frameReadbackInfo.frameInterval = string::to_number<uint32_t>(frameInterval);
+    }
+    auto frameCount = get_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_FRAME_COUNT");
+    if (!frameCount.empty()) {
+        frameReadbackInfo.frameCount = string::to_number<uint32_t>(frameCount);
+    }
+    if (string::to_lower(get_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_FORMAT")) == "png") {
+        frameReadbackInfo.flags = GVK_FRAME_READBACK_PNG_BIT;
+    }
+    frameReadbackInfo.path = get_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_PATH");
+    return frameReadbackInfo;
+}
+
+FrameReadbackInfo::FrameReadbackInfo(const GvkFrameReadbackInfo& frameReadbackInfo)
+    : flags{ frameReadbackInfo.flags }
+    , frameInterval{ frameReadbackInfo.frameInterval }
+    , frameCount{ frameReadbackInfo.frameCount }
+    , path{ frameReadbackInfo.pPath ? frameReadbackInfo.pPath : std::filesystem::path() }
+    , pfnProcessFrameReadbackDataCallback{ frameReadbackInfo.pfnProcessFrameReadbackDataCallback }
+{
+}
+
+void FrameReadbackStatistics::on_frame_captured()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mStatistics.capturedFrameCount;
+}
+
+void FrameReadbackStatistics::on_frame_dropped()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mStatistics.droppedFrameCount;
+}
+
+void FrameReadbackStatistics::on_frame_processed(uint64_t latency)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mStatistics.processedFrameCount;
+    mTotalLatency += latency;
+    mStatistics.lastLatency = latency;
+    mStatistics.averageLatency = mTotalLatency / mStatistics.processedFrameCount;
+    mStatistics.maxLatency = std::max(mStatistics.maxLatency, latency);
+}
+
+GvkFrameReadbackStatistics FrameReadbackStatistics::get() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStatistics;
+}
+
+FrameReadback::~FrameReadback()
+{
+    reset();
+}
+
+VkResult FrameReadback::create(const Device& gvkDevice, VkSwapchainKHR swapchain, const VkSwapchainCreateInfoKHR& swapchainCreateInfo, const FrameReadbackInfo& frameReadbackInfo, const std::shared_ptr<FrameReadbackStatistics>& spStatistics)
+{
+    assert(gvkDevice);
+    assert(swapchain);
+    assert(frameReadbackInfo.frameInterval);
+    assert(spStatistics);
+    reset();
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        mGvkDevice = gvkDevice;
+        mVkSwapchain = swapchain;
+        mFormat = swapchainCreateInfo.imageFormat;
+        mExtent = swapchainCreateInfo.imageExtent;
+        mFrameSize = get_image_aspect_data_size(mFormat, { mExtent.width, mExtent.height, 1 }, VK_IMAGE_ASPECT_COLOR_BIT);
+        mFrameReadbackInfo = frameReadbackInfo;
+        mspStatistics = spStatistics;
+        if (!mFrameReadbackInfo.pfnProcessFrameReadbackDataCallback) {
+            mFrameReadbackInfo.path /= to_hex_string(mVkSwapchain);
+            std::error_code errorCode;
+            std::filesystem::create_directories(mFrameReadbackInfo.path, errorCode);
+            gvk_result(errorCode ? VK_ERROR_INITIALIZATION_FAILED : VK_SUCCESS);
+        }
+
+        // NOTE : Every Frame gets its own persistently mapped VkBuffer, host
+        //  cached memory is preferred since the background thread reads every
+        //  byte of each Frame.
+        const auto& dispatchTable = mGvkDevice.get<DispatchTable>();
+        mFrames.resize(std::max(mFrameReadbackInfo.frameCount, 1u));
+        for (auto& frame : mFrames) {
+            auto bufferCreateInfo = get_default<VkBufferCreateInfo>();
+            bufferCreateInfo.size = mFrameSize;
+            bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            gvk_result(Buffer::create(mGvkDevice, &bufferCreateInfo, (VkAllocationCallbacks*)nullptr, &frame.buffer));
+            VkMemoryRequirements memoryRequirements{ };
+            dispatchTable.gvkGetBufferMemoryRequirements(mGvkDevice, frame.buffer, &memoryRequirements);
+
+            auto memoryAllocateInfo = get_default<VkMemoryAllocateInfo>();
+            memoryAllocateInfo.allocationSize = memoryRequirements.size;
+            uint32_t memoryTypeCount = 0;
+            auto memoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+            get_compatible_memory_type_indices(mGvkDevice.get<PhysicalDevice>(), memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, nullptr);
+            if (!memoryTypeCount) {
+                memoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+                get_compatible_memory_type_indices(mGvkDevice.get<PhysicalDevice>(), memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, nullptr);
+            }
+            gvk_result(memoryTypeCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+            memoryTypeCount = 1;
+            get_compatible_memory_type_indices(mGvkDevice.get<PhysicalDevice>(), memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, &memoryAllocateInfo.memoryTypeIndex);
+            gvk_result(DeviceMemory::allocate(mGvkDevice, &memoryAllocateInfo, nullptr, &frame.deviceMemory));
+            gvk_result(dispatchTable.gvkBindBufferMemory(mGvkDevice, frame.buffer, frame.deviceMemory, 0));
+            gvk_result(dispatchTable.gvkMapMemory(mGvkDevice, frame.deviceMemory, 0, VK_WHOLE_SIZE, 0, (void**)&frame.pData));
+            gvk_result(Fence::create(mGvkDevice, &get_default<VkFenceCreateInfo>(), nullptr, &frame.fence));
+        }
+        mStop = false;
+        mThread = std::thread(&FrameReadback::process_frames, this);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult FrameReadback::begin_frame(const Queue& gvkQueue, uint32_t imageIndex, VkImage image, VkCommandBuffer* pCommandBuffer)
+{
+    assert(gvkQueue);
+    assert(image);
+    assert(pCommandBuffer);
+    assert(!mpRecordedFrame);
+    *pCommandBuffer = VK_NULL_HANDLE;
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        Frame* pFrame = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto frameIndex = mPresentCount++;
+            if (frameIndex % mFrameReadbackInfo.frameInterval) {
+                return VK_SUCCESS;
+            }
+            auto frameItr = std::find_if(mFrames.begin(), mFrames.end(), [](const Frame& frame) { return frame.state == State::Available; });
+            if (frameItr == mFrames.end()) {
+                mspStatistics->on_frame_dropped();
+                return VK_SUCCESS;
+            }
+            pFrame = &*frameItr;
+            pFrame->state = State::Recorded;
+            pFrame->frameIndex = frameIndex;
+            pFrame->imageIndex = imageIndex;
+            pFrame->presentTime = std::chrono::steady_clock::now();
+        }
+
+        // NOTE : A Frame in State::Recorded is only accessed by the presenting
+        //  thread so it can be recorded without holding mMutex.
+        gvkResult = record_command_buffer(gvkQueue, image, pFrame);
+        if (gvkResult != VK_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            pFrame->state = State::Available;
+        }
+        gvk_result(gvkResult);
+        mpRecordedFrame = pFrame;
+        mspStatistics->on_frame_captured();
+        *pCommandBuffer = pFrame->commandBuffer;
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult FrameReadback::end_frame(const Queue& gvkQueue)
+{
+    assert(gvkQueue);
+    assert(mpRecordedFrame);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : A submission with no batches signals its VkFence once all work
+        //  previously submitted to the VkQueue is complete.
+        auto pFrame = std::exchange(mpRecordedFrame, nullptr);
+        gvkResult = gvkQueue.get<DispatchTable>().gvkQueueSubmit(gvkQueue, 0, nullptr, pFrame->fence);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            pFrame->state = gvkResult == VK_SUCCESS ? State::Pending : State::Available;
+        }
+        gvk_result(gvkResult);
+        mConditionVariable.notify_one();
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void FrameReadback::reset()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mConditionVariable.notify_one();
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+    mFrames.clear();
+    mpRecordedFrame = nullptr;
+    mPresentCount = 0;
+    mspStatistics.reset();
+    mFrameReadbackInfo = { };
+    mFrameSize = 0;
+    mExtent = { };
+    mFormat = { };
+    mVkSwapchain = VK_NULL_HANDLE;
+    mGvkDevice.reset();
+}
+
+VkResult FrameReadback::record_command_buffer(const Queue& gvkQueue, VkImage image, Frame* pFrame)
+{
+    assert(gvkQueue);
+    assert(image);
+    assert(pFrame);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        const auto& dispatchTable = mGvkDevice.get<DispatchTable>();
+        auto queueFamilyIndex = gvkQueue.get<VkDeviceQueueCreateInfo>().queueFamilyIndex;
+        if (pFrame->queueFamilyIndex != queueFamilyIndex) {
+            pFrame->commandPool.reset();
+            auto commandPoolCreateInfo = get_default<VkCommandPoolCreateInfo>();
+            commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndex;
+            gvk_result(CommandPool::create(mGvkDevice, &commandPoolCreateInfo, nullptr, &pFrame->commandPool));
+            auto commandBufferAllocateInfo = get_default<VkCommandBufferAllocateInfo>();
+            commandBufferAllocateInfo.commandPool = pFrame->commandPool;
+            commandBufferAllocateInfo.commandBufferCount = 1;
+            // TODO : Detect layer and automate dispatch table update so gvk::CommandBuffer
+            //  can be allocated in layers
+            gvk_result(dispatchTable.gvkAllocateCommandBuffers(mGvkDevice, &commandBufferAllocateInfo, &pFrame->commandBuffer));
+            *(void**)pFrame->commandBuffer = *(void**)mGvkDevice.get<VkDevice>();
+            pFrame->queueFamilyIndex = queueFamilyIndex;
+        }
+
+        auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
+        commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        gvk_result(dispatchTable.gvkBeginCommandBuffer(pFrame->commandBuffer, &commandBufferBeginInfo));
+
+        // VkImage VK_IMAGE_LAYOUT_PRESENT_SRC_KHR -> VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+        auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
+        imageMemoryBarrier.srcAccessMask = 0;
+        imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageMemoryBarrier.image = image;
+        imageMemoryBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        imageMemoryBarrier.subresourceRange.levelCount = 1;
+        imageMemoryBarrier.subresourceRange.layerCount = 1;
+        dispatchTable.gvkCmdPipelineBarrier(
+            pFrame->commandBuffer,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0,
+            0, nullptr,
+            0, nullptr,
+            1, &imageMemoryBarrier
+        );
+
+        // Copy VkImage -> VkBuffer
+        //  NOTE : Only the first array layer is read back
+        auto bufferImageCopy = get_default<VkBufferImageCopy>();
+        bufferImageCopy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        bufferImageCopy.imageSubresource.layerCount = 1;
+        bufferImageCopy.imageExtent = { mExtent.width, mExtent.height, 1 };
+        dispatchTable.gvkCmdCopyImageToBuffer(pFrame->commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, pFrame->buffer, 1, &bufferImageCopy);
+
+        // VkImage VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL -> VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+        // VkBuffer VK_ACCESS_TRANSFER_WRITE_BIT -> VK_ACCESS_HOST_READ_BIT
+        imageMemoryBarrier.srcAccessMask = 0;
+        imageMemoryBarrier.dstAccessMask = 0;
+        imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        auto bufferMemoryBarrier = get_default<VkBufferMemoryBarrier>();
+        bufferMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        bufferMemoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        bufferMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferMemoryBarrier.buffer = pFrame->buffer;
+        bufferMemoryBarrier.size = VK_WHOLE_SIZE;
+        dispatchTable.gvkCmdPipelineBarrier(
+            pFrame->commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+            0,
+            0, nullptr,
+            1, &bufferMemoryBarrier,
+            1, &imageMemoryBarrier
+        );
+
+        gvk_result(dispatchTable.gvkEndCommandBuffer(pFrame->commandBuffer));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void FrameReadback::process_frames()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        // NOTE : Frames are processed in presentation order, once stopped any
+        //  pending Frames are drained before returning.
+        Frame* pFrame = nullptr;
+        mConditionVariable.wait(lock, [&]() {
+            pFrame = nullptr;
+            for (auto& frame : mFrames) {
+                if (frame.state == State::Pending && (!pFrame || frame.frameIndex < pFrame->frameIndex)) {
+                    pFrame = &frame;
+                }
+            }
+            return pFrame || mStop;
+        });
+        if (!pFrame) {
+            break;
+        }
+        lock.unlock();
+        const auto& dispatchTable = mGvkDevice.get<DispatchTable>();
+        auto vkResult = dispatchTable.gvkWaitForFences(mGvkDevice, 1, &pFrame->fence.get<VkFence>(), VK_TRUE, UINT64_MAX);
+        (void)vkResult;
+        assert(vkResult == VK_SUCCESS);
+        process_frame(*pFrame);
+        dispatchTable.gvkResetFences(mGvkDevice, 1, &pFrame->fence.get<VkFence>());
+        lock.lock();
+        pFrame->state = State::Available;
+    }
+}
+
+void FrameReadback::process_frame(const Frame& frame)
+{
+    auto latency = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - frame.presentTime).count();
+    mspStatistics->on_frame_processed(latency);
+    if (mFrameReadbackInfo.pfnProcessFrameReadbackDataCallback) {
+        GvkFrameReadbackData frameReadbackData{ };
+        frameReadbackData.device = mGvkDevice;
+        frameReadbackData.swapchain = mVkSwapchain;
+        frameReadbackData.frameIndex = frame.frameIndex;
+        frameReadbackData.imageIndex = frame.imageIndex;
+        frameReadbackData.format = mFormat;
+        frameReadbackData.extent = mExtent;
+        frameReadbackData.latency = latency;
+        frameReadbackData.size = mFrameSize;
+        frameReadbackData.pData = frame.pData;
+        mFrameReadbackInfo.pfnProcessFrameReadbackDataCallback(&frameReadbackData);
+        return;
+    }
+
+    auto path = mFrameReadbackInfo.path / std::to_string(frame.frameIndex);
+    if (mFrameReadbackInfo.flags & GVK_FRAME_READBACK_RAW_BIT) {
+        std::ofstream dataFile(path.replace_extension("data"), std::ios::binary);
+        dataFile.write((const char*)frame.pData, (std::streamsize)mFrameSize);
+    }
+    if (mFrameReadbackInfo.flags & GVK_FRAME_READBACK_PNG_BIT) {
+        // NOTE : Only 8 bit UNORM/SRGB RGBA and BGRA formats are written to PNG,
+        //  BGRA formats are swizzled to RGBA.
+        const auto& formatInfo = get_format_info(mFormat);
+        bool pngAble = formatInfo.componentCount == 4 && formatInfo.compressionType == GVK_FORMAT_COMPRESSION_TYPE_NONE;
+        for (uint32_t i = 0; i < formatInfo.componentCount && pngAble; ++i) {
+            const auto& component = formatInfo.pComponents[i];
+            pngAble =
+                component.bits == 8 &&
+                (component.numericFormat == GVK_NUMERIC_FORMAT_UNORM || component.numericFormat == GVK_NUMERIC_FORMAT_SRGB);
+        }
+        if (pngAble) {
+            std::vector<uint8_t> texels;
+            const uint8_t* pTexels = frame.pData;
+            if (formatInfo.pComponents[0].name == GVK_FORMAT_COMPONENT_NAME_B) {
+                texels.assign(frame.pData, frame.pData + mFrameSize);
+                for (size_t i = 0; i + 3 < texels.size(); i += 4) {
+                    std::swap(texels[i], texels[i + 2]);
+                }
+                pTexels = texels.data();
+            }
+            auto stride = mExtent.width * 4;
+            stbi_write_png(path.replace_extension("png").string().c_str(), (int)mExtent.width, (int)mExtent.height, 4, pTexels, (int)stride);
+        }
+    }
+}
+
+} // namespace virtual_swapchain
+} // namespace gvk
@@ -26,12 +26,133 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "gvk-virtual-swapchain/layer.hpp"
 #include "gvk-handles/utilities.hpp"
+#include "gvk-string/utilities.hpp"
+#include "gvk-environment.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <thread>
 #include <utility>
 
 namespace gvk {
 namespace virtual_swapchain {
 
+HeadlessInfo HeadlessInfo::from_env()
+{
+    HeadlessInfo headlessInfo{ };
+    headlessInfo.enabled = string::to_lower(get_env_var("GVK_VIRTUAL_SWAPCHAIN_HEADLESS")) == "true";
+    auto presentPacing = string::to_lower(get_env_var("GVK_VIRTUAL_SWAPCHAIN_PRESENT_PACING"));
+    if (presentPacing == "unlocked") {
+        headlessInfo.presentPacing = PresentPacing::Unlocked;
+    } else if (presentPacing == "interval") {
+        headlessInfo.presentPacing = PresentPacing::FixedInterval;
+    }
+    auto presentInterval = get_env_var("GVK_VIRTUAL_SWAPCHAIN_PRESENT_INTERVAL");
+    if (!presentInterval.empty()) {
+        headlessInfo.presentInterval = std::chrono::microseconds(string::to_number<uint64_t>(presentInterval));
+    }
+    return headlessInfo;
+}
+
+VkResult VirtualImagePool::create_images(const Device& gvkDevice, const VkSwapchainCreateInfoKHR& swapchainCreateInfo, uint32_t imageCount, DeviceMemory* pGvkDeviceMemory, std::vector<VirtualVkImage>* pVirtualVkImages)
+{
+    assert(gvkDevice);
+    assert(imageCount);
+    assert(pGvkDeviceMemory);
+    assert(pVirtualVkImages);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        const auto& dispatchTable = gvkDevice.get<DispatchTable>();
+        auto imageCreateInfo = get_default<VkImageCreateInfo>();
+        imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageCreateInfo.format = swapchainCreateInfo.imageFormat;
+        imageCreateInfo.extent.width = swapchainCreateInfo.imageExtent.width;
+        imageCreateInfo.extent.height = swapchainCreateInfo.imageExtent.height;
+        imageCreateInfo.arrayLayers = swapchainCreateInfo.imageArrayLayers;
+        imageCreateInfo.usage = swapchainCreateInfo.imageUsage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        imageCreateInfo.sharingMode = swapchainCreateInfo.imageSharingMode;
+        imageCreateInfo.queueFamilyIndexCount = swapchainCreateInfo.queueFamilyIndexCount;
+        imageCreateInfo.pQueueFamilyIndices = swapchainCreateInfo.pQueueFamilyIndices;
+        pVirtualVkImages->resize(imageCount);
+        for (uint32_t i = 0; i < imageCount; ++i) {
+            gvk_result(dispatchTable.gvkCreateImage(gvkDevice, &imageCreateInfo, nullptr, &(*pVirtualVkImages)[i]));
+        }
+
+        // NOTE : Each VkImage is bound at an offset aligned to its own
+        //  VkMemoryRequirements, the VkDeviceMemory must satisfy every VkImage's
+        //  memoryTypeBits.
+        std::vector<VkDeviceSize> offsets(imageCount);
+        VkDeviceSize size = 0;
+        uint32_t memoryTypeBits = UINT32_MAX;
+        for (uint32_t i = 0; i < imageCount; ++i) {
+            VkMemoryRequirements memoryRequirements{ };
+            dispatchTable.gvkGetImageMemoryRequirements(gvkDevice, (*pVirtualVkImages)[i], &memoryRequirements);
+            auto alignment = memoryRequirements.alignment ? memoryRequirements.alignment : 1;
+            offsets[i] = (size + alignment - 1) / alignment * alignment;
+            size = offsets[i] + memoryRequirements.size;
+            memoryTypeBits &= memoryRequirements.memoryTypeBits;
+        }
+
+        auto memoryPropertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        uint32_t memoryTypeCount = 0;
+        get_compatible_memory_type_indices(gvkDevice.get<PhysicalDevice>(), memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, nullptr);
+        gvk_result(memoryTypeCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        memoryTypeCount = 1;
+        uint32_t memoryTypeIndex = 0;
+        get_compatible_memory_type_indices(gvkDevice.get<PhysicalDevice>(), memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, &memoryTypeIndex);
+
+        // NOTE : The smallest available VkDeviceMemory that fits is reused, if
+        //  none fit a new VkDeviceMemory is allocated.  When a swapchain is being
+        //  recreated from an oldSwapchain it's likely that it's being resized, so
+        //  new allocations get headroom for the next recreation to fit in.
+        auto reuseItr = mAvailableAllocations.end();
+        for (auto itr = mAvailableAllocations.begin(); itr != mAvailableAllocations.end(); ++itr) {
+            const auto& memoryAllocateInfo = itr->get<VkMemoryAllocateInfo>();
+            if (memoryAllocateInfo.memoryTypeIndex == memoryTypeIndex &&
+                size <= memoryAllocateInfo.allocationSize &&
+                (reuseItr == mAvailableAllocations.end() || memoryAllocateInfo.allocationSize < reuseItr->get<VkMemoryAllocateInfo>().allocationSize)) {
+                reuseItr = itr;
+            }
+        }
+        if (reuseItr != mAvailableAllocations.end()) {
+            *pGvkDeviceMemory = *reuseItr;
+            mAvailableAllocations.erase(reuseItr);
+        } else {
+            auto memoryAllocateInfo = get_default<VkMemoryAllocateInfo>();
+            memoryAllocateInfo.allocationSize = swapchainCreateInfo.oldSwapchain ? size + size / 4 : size;
+            memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+            gvk_result(DeviceMemory::allocate(gvkDevice, &memoryAllocateInfo, nullptr, pGvkDeviceMemory));
+        }
+
+        for (uint32_t i = 0; i < imageCount; ++i) {
+            gvk_result(dispatchTable.gvkBindImageMemory(gvkDevice, (*pVirtualVkImages)[i], *pGvkDeviceMemory, offsets[i]));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void VirtualImagePool::destroy_images(DeviceMemory* pGvkDeviceMemory, std::vector<VirtualVkImage>* pVirtualVkImages)
+{
+    assert(pGvkDeviceMemory);
+    assert(pVirtualVkImages);
+    if (*pGvkDeviceMemory) {
+        Device gvkDevice = pGvkDeviceMemory->get<Device>();
+        for (auto virtualImage : *pVirtualVkImages) {
+            gvkDevice.get<DispatchTable>().gvkDestroyImage(gvkDevice, virtualImage, nullptr);
+        }
+        mAvailableAllocations.push_back(*pGvkDeviceMemory);
+        if (MaxAvailableAllocationCount < mAvailableAllocations.size()) {
+            mAvailableAllocations.erase(mAvailableAllocations.begin());
+        }
+    }
+    pGvkDeviceMemory->reset();
+    pVirtualVkImages->clear();
+}
+
+void VirtualImagePool::reset()
+{
+    mAvailableAllocations.clear();
+}
+
 Swapchain::Swapchain(Swapchain&& other)
 {
     *this = std::move(other);
@@ -45,22 +166,26 @@ Swapchain& Swapchain::operator=(Swapchain&& other)
         mExtent = std::move(other.mExtent);
         mGvkDeviceMemory = std::move(other.mGvkDeviceMemory);
         mActualImages = std::move(other.mActualImages);
-        mImageLayouts = std::move(other.mImageLayouts);
+        mActualImageSemaphores = std::move(other.mActualImageSemaphores);
         mVirtualVkImages = std::move(other.mVirtualVkImages);
+        mVirtualImageCopyFences = std::move(other.mVirtualImageCopyFences);
         mAvailableVkImages = std::move(other.mAvailableVkImages);
         mAcquiredVkImages = std::move(other.mAcquiredVkImages);
         mPendingAcquisition = std::exchange(other.mPendingAcquisition, UINT32_MAX);
+        mCommandBuffers = std::move(other.mCommandBuffers);
+        mCopyFences = std::move(other.mCopyFences);
     }
     return *this;
 }
 
-VkResult Swapchain::post_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+VkResult Swapchain::post_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain, VirtualImagePool* pVirtualImagePool)
 {
     (void)pAllocator;
     assert(device);
     assert(pCreateInfo);
     assert(pSwapchain);
     assert(*pSwapchain);
+    assert(pVirtualImagePool);
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         mGvkDevice = device;
         mVkSwapchain = *pSwapchain;
@@ -70,69 +195,40 @@ VkResult Swapchain::post_vkCreateSwapchainKHR(VkDevice device, const VkSwapchain
         gvk_result(mGvkDevice.get<DispatchTable>().gvkGetSwapchainImagesKHR(device, mVkSwapchain, &imageCount, nullptr));
         mActualImages.resize(imageCount);
         gvk_result(mGvkDevice.get<DispatchTable>().gvkGetSwapchainImagesKHR(device, mVkSwapchain, &imageCount, mActualImages.data()));
-        mImageLayouts.resize(imageCount);
 
-        auto imageCreateInfo = get_default<VkImageCreateInfo>();
-        imageCreateInfo.imageType = VK_IMAGE_TYPE_2D;
-        imageCreateInfo.format = pCreateInfo->imageFormat;
-        imageCreateInfo.extent.width = pCreateInfo->imageExtent.width;
-        imageCreateInfo.extent.height = pCreateInfo->imageExtent.height;
-        imageCreateInfo.arrayLayers = pCreateInfo->imageArrayLayers;
-        imageCreateInfo.usage = pCreateInfo->imageUsage | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
-        imageCreateInfo.sharingMode = pCreateInfo->imageSharingMode;
-        imageCreateInfo.queueFamilyIndexCount = pCreateInfo->queueFamilyIndexCount;
-        imageCreateInfo.pQueueFamilyIndices = pCreateInfo->pQueueFamilyIndices;
-        mVirtualVkImages.resize(imageCount);
-        for (uint32_t i = 0; i < imageCount; ++i) {
-            gvk_result(mGvkDevice.get<DispatchTable>().gvkCreateImage(device, &imageCreateInfo, nullptr, &mVirtualVkImages[i]));
-            mAvailableVkImages.insert(i);
+        // NOTE : Each actual VkImage gets its own VkSemaphore for the present to
+        //  wait on.  An actual VkImage can't be reacquired until its previous
+        //  present has completed, so its VkSemaphore is never signaled while a
+        //  wait on it is still pending.
+        mActualImageSemaphores.resize(imageCount);
+        for (auto& actualImageSemaphore : mActualImageSemaphores) {
+            gvk_result(Semaphore::create(mGvkDevice, &get_default<VkSemaphoreCreateInfo>(), nullptr, &actualImageSemaphore));
         }
 
-        VkMemoryRequirements memoryRequirements{ };
-        mGvkDevice.get<DispatchTable>().gvkGetImageMemoryRequirements(device, mVirtualVkImages[0], &memoryRequirements);
-
-        auto memoryPropertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-        uint32_t memoryTypeCount = 0;
-        get_compatible_memory_type_indices(mGvkDevice.get<PhysicalDevice>(), memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, nullptr);
-        gvk_result(memoryTypeCount ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
-        memoryTypeCount = 1;
-        uint32_t memoryTypeIndex = 0;
-        get_compatible_memory_type_indices(mGvkDevice.get<PhysicalDevice>(), memoryRequirements.memoryTypeBits, memoryPropertyFlags, &memoryTypeCount, &memoryTypeIndex);
-
-        auto memoryAllocateInfo = get_default<VkMemoryAllocateInfo>();
-        auto padding = memoryRequirements.size % (memoryRequirements.alignment ? memoryRequirements.alignment : 1);
-        memoryAllocateInfo.allocationSize = memoryRequirements.size * imageCount + padding * (imageCount - 1);
-        memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
-        gvk_result(DeviceMemory::allocate(mGvkDevice, &memoryAllocateInfo, nullptr, &mGvkDeviceMemory));
-
-        VkDeviceSize offset = 0;
-        for (uint32_t i = 0; i < imageCount && gvkResult == VK_SUCCESS; ++i) {
-            gvk_result(mGvkDevice.get<DispatchTable>().gvkBindImageMemory(device, mVirtualVkImages[i], mGvkDeviceMemory, offset));
-            offset += memoryRequirements.size + padding;
+        gvk_result(pVirtualImagePool->create_images(mGvkDevice, *pCreateInfo, imageCount, &mGvkDeviceMemory, &mVirtualVkImages));
+        mVirtualImageCopyFences.resize(imageCount);
+        for (uint32_t i = 0; i < imageCount; ++i) {
+            mAvailableVkImages.insert(i);
         }
     } gvk_result_scope_end;
     return gvkResult;
 }
 
-void Swapchain::pre_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+void Swapchain::destroy(VirtualImagePool* pVirtualImagePool)
 {
-    if (swapchain) {
-        assert(mGvkDevice);
-        assert(mGvkDevice == device);
-        for (auto virtualImage : mVirtualVkImages) {
-            mGvkDevice.get<DispatchTable>().gvkDestroyImage(device, virtualImage, pAllocator);
-        }
-        mGvkDevice.reset();
-        mVkSwapchain = VK_NULL_HANDLE;
-        mExtent = { };
-        mGvkDeviceMemory.reset();
-        mActualImages.clear();
-        mImageLayouts.clear();
-        mVirtualVkImages.clear();
-        mAvailableVkImages.clear();
-        mAcquiredVkImages.clear();
-        mPendingAcquisition = UINT32_MAX;
-    }
+    assert(pVirtualImagePool);
+    pVirtualImagePool->destroy_images(&mGvkDeviceMemory, &mVirtualVkImages);
+    mCommandBuffers.clear();
+    mGvkDevice.reset();
+    mVkSwapchain = VK_NULL_HANDLE;
+    mExtent = { };
+    mActualImages.clear();
+    mActualImageSemaphores.clear();
+    mVirtualImageCopyFences.clear();
+    mAvailableVkImages.clear();
+    mAcquiredVkImages.clear();
+    mPendingAcquisition = UINT32_MAX;
+    mCopyFences.clear();
 }
 
 VkResult Swapchain::post_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
@@ -145,16 +241,33 @@ VkResult Swapchain::post_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR
     return VK_SUCCESS;
 }
 
-VkResult Swapchain::pre_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+VkResult Swapchain::pre_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex, Fence* pCopyFence)
 {
-    (void)device;
     (void)swapchain;
     (void)timeout;
     (void)semaphore;
     (void)fence;
-    assert(pImageIndex);
-    assert(*pImageIndex < mVirtualVkImages.size());
-    mPendingAcquisition = *pImageIndex;
+    (void)pImageIndex;
+    assert(pCopyFence);
+    assert(!mAvailableVkImages.empty());
+
+    // NOTE : A virtual VkImage is made available when its present is recorded,
+    //  but its copy (and frame readback) may still be executing.  A virtual
+    //  VkImage whose copy Fence has signaled is preferred, otherwise the caller
+    //  has to wait on the returned copy Fence before the virtual VkImage is handed
+    //  back to the application.
+    const auto& dispatchTable = mGvkDevice.get<DispatchTable>();
+    auto isCopyComplete = [&](uint32_t imageIndex)
+    {
+        const auto& copyFence = mVirtualImageCopyFences[imageIndex];
+        return !copyFence || dispatchTable.gvkGetFenceStatus(device, copyFence) == VK_SUCCESS;
+    };
+    auto itr = std::find_if(mAvailableVkImages.begin(), mAvailableVkImages.end(), isCopyComplete);
+    if (itr == mAvailableVkImages.end()) {
+        itr = mAvailableVkImages.begin();
+        *pCopyFence = mVirtualImageCopyFences[*itr];
+    }
+    mPendingAcquisition = *itr;
     return VK_SUCCESS;
 }
 
@@ -196,89 +309,315 @@ VkResult Swapchain::post_vkAcquireNextImage2KHR(VkDevice device, const VkAcquire
     return VK_ERROR_UNKNOWN;
 }
 
-void Swapchain::pre_vkQueuePresentKHR(VkCommandBuffer commandBuffer, uint32_t imageIndex)
-{
-    assert(commandBuffer);
-
-    auto actualImage = mActualImages[imageIndex];
-    auto itr = mAcquiredVkImages.find(imageIndex);
-    assert(itr != mAcquiredVkImages.end());
-    assert(itr->second < mVirtualVkImages.size());
-    auto virtualImage = mVirtualVkImages[itr->second];
-
-    // Actual VkImage VK_IMAGE_LAYOUT_UNDEFINED/VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL -> VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-    // Virtual VkImage VK_IMAGE_LAYOUT_PRESENT_SRC_KHR -> VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
-    std::array<VkImageMemoryBarrier, 2> imageMemoryBarriers{ };
-    auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
-    imageMemoryBarrier.srcAccessMask = 0;
-    imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-    imageMemoryBarrier.oldLayout = mImageLayouts[imageIndex];
-    imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-    imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    imageMemoryBarrier.image = actualImage;
-    imageMemoryBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    imageMemoryBarrier.subresourceRange.baseMipLevel = 0;
-    imageMemoryBarrier.subresourceRange.levelCount = 1;
-    imageMemoryBarrier.subresourceRange.baseArrayLayer = 0;
-    imageMemoryBarrier.subresourceRange.layerCount = 1;
-    imageMemoryBarriers[0] = imageMemoryBarrier;
-    imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-    imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-    imageMemoryBarrier.image = virtualImage;
-    imageMemoryBarriers[1] = imageMemoryBarrier;
-    mGvkDevice.get<DispatchTable>().gvkCmdPipelineBarrier(
-        commandBuffer,
-        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-        VK_PIPELINE_STAGE_TRANSFER_BIT,
-        0,
-        0, nullptr,
-        0, nullptr,
-        (uint32_t)imageMemoryBarriers.size(),
-        imageMemoryBarriers.data()
-    );
-
-    // Copy virtual VkImage -> actual VkImage
-    auto imageCopy = get_default<VkImageCopy>();
-    imageCopy.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    imageCopy.srcSubresource.layerCount = 1;
-    imageCopy.dstSubresource = imageCopy.srcSubresource;
-    imageCopy.extent.width = mExtent.width;
-    imageCopy.extent.height = mExtent.height;
-    imageCopy.extent.depth = 1;
-    mGvkDevice.get<DispatchTable>().gvkCmdCopyImage(
-        commandBuffer,
-        virtualImage,
-        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-        actualImage,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        1,
-        &imageCopy
-    );
-
-    // Actual VkImage VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL -> VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
-    // Virtual VkImage VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL -> VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
-    std::swap(imageMemoryBarriers[0].srcAccessMask, imageMemoryBarriers[0].dstAccessMask);
-    std::swap(imageMemoryBarriers[0].oldLayout, imageMemoryBarriers[0].newLayout);
-    imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-    mImageLayouts[imageIndex] = imageMemoryBarriers[0].newLayout;
-    std::swap(imageMemoryBarriers[1].srcAccessMask, imageMemoryBarriers[1].dstAccessMask);
-    std::swap(imageMemoryBarriers[1].oldLayout, imageMemoryBarriers[1].newLayout);
-    mGvkDevice.get<DispatchTable>().gvkCmdPipelineBarrier(
-        commandBuffer,
-        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-        VK_PIPELINE_STAGE_TRANSFER_BIT,
-        0,
-        0, nullptr,
-        0, nullptr,
-        (uint32_t)imageMemoryBarriers.size(),
-        imageMemoryBarriers.data()
-    );
-
-    auto inserted = mAvailableVkImages.insert(itr->first).second;
+VkResult Swapchain::pre_vkQueuePresentKHR(const Queue& gvkQueue, uint32_t imageIndex, VkCommandBuffer* pCommandBuffer, VkSemaphore* pSemaphore, uint32_t* pActualImageIndex)
+{
+    assert(gvkQueue);
+    assert(pCommandBuffer);
+    assert(pSemaphore);
+    assert(pActualImageIndex);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        auto itr = mAcquiredVkImages.find(imageIndex);
+        assert(itr != mAcquiredVkImages.end());
+        assert(itr->first < mVirtualVkImages.size());
+        assert(itr->second < mActualImages.size());
+        auto queueFamilyIndex = gvkQueue.get<VkDeviceQueueCreateInfo>().queueFamilyIndex;
+        auto& commandResources = mCommandBuffers[queueFamilyIndex];
+        if (!commandResources.first) {
+            gvk_result(record_command_buffers(queueFamilyIndex, &commandResources));
+        }
+        *pCommandBuffer = commandResources.second[itr->first * mActualImages.size() + itr->second];
+        *pSemaphore = mActualImageSemaphores[itr->second];
+        *pActualImageIndex = itr->second;
+        auto inserted = mAvailableVkImages.insert(itr->first).second;
+        (void)inserted;
+        assert(inserted);
+        mAcquiredVkImages.erase(itr);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void Swapchain::on_copies_submitted(uint32_t imageIndex, const Fence& fence)
+{
+    // NOTE : Frame Fences are reused, each is only tracked once
+    assert(imageIndex < mVirtualImageCopyFences.size());
+    assert(fence);
+    mVirtualImageCopyFences[imageIndex] = fence;
+    if (std::find(mCopyFences.begin(), mCopyFences.end(), fence) == mCopyFences.end()) {
+        mCopyFences.push_back(fence);
+    }
+}
+
+const std::vector<Fence>& Swapchain::get_copy_fences() const
+{
+    return mCopyFences;
+}
+
+VkImage Swapchain::get_image(uint32_t imageIndex) const
+{
+    assert(imageIndex < mVirtualVkImages.size());
+    return mVirtualVkImages[imageIndex];
+}
+
+VkResult Swapchain::record_command_buffers(uint32_t queueFamilyIndex, std::pair<CommandPool, std::vector<VkCommandBuffer>>* pCommandResources)
+{
+    assert(pCommandResources);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        const auto& dispatchTable = mGvkDevice.get<DispatchTable>();
+        auto commandPoolCreateInfo = get_default<VkCommandPoolCreateInfo>();
+        commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndex;
+        gvk_result(CommandPool::create(mGvkDevice, &commandPoolCreateInfo, nullptr, &pCommandResources->first));
+
+        // NOTE : One VkCommandBuffer is recorded for every virtual/actual VkImage
+        //  pair, indexed by [virtual * actualImageCount + actual].  These are
+        //  recorded once per queue family and resubmitted on every present.
+        auto commandBufferAllocateInfo = get_default<VkCommandBufferAllocateInfo>();
+        commandBufferAllocateInfo.commandPool = pCommandResources->first;
+        commandBufferAllocateInfo.commandBufferCount = (uint32_t)(mVirtualVkImages.size() * mActualImages.size());
+        pCommandResources->second.resize(commandBufferAllocateInfo.commandBufferCount);
+        // TODO : Detect layer and automate dispatch table update so gvk::CommandBuffer
+        //  can be allocated in layers
+        gvk_result(dispatchTable.gvkAllocateCommandBuffers(mGvkDevice, &commandBufferAllocateInfo, pCommandResources->second.data()));
+        for (auto commandBuffer : pCommandResources->second) {
+            *(void**)commandBuffer = *(void**)mGvkDevice.get<VkDevice>();
+        }
+
+        for (size_t virtualImageIndex = 0; virtualImageIndex < mVirtualVkImages.size(); ++virtualImageIndex) {
+            for (size_t actualImageIndex = 0; actualImageIndex < mActualImages.size(); ++actualImageIndex) {
+                auto commandBuffer = pCommandResources->second[virtualImageIndex * mActualImages.size() + actualImageIndex];
+
+                // NOTE : VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT allows a pair to
+                //  be presented again while its previous submission is still pending,
+                //  the actual VkImage can't be written by both because it has to be
+                //  reacquired in between.
+                auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
+                commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+                gvk_result(dispatchTable.gvkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo));
+
+                // Actual VkImage VK_IMAGE_LAYOUT_UNDEFINED -> VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+                // Virtual VkImage VK_IMAGE_LAYOUT_PRESENT_SRC_KHR -> VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+                //  NOTE : The actual VkImage is completely overwritten so its contents
+                //  don't need to be preserved, this keeps the recorded layouts static.
+                std::array<VkImageMemoryBarrier, 2> imageMemoryBarriers{ };
+                auto imageMemoryBarrier = get_default<VkImageMemoryBarrier>();
+                imageMemoryBarrier.srcAccessMask = 0;
+                imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                imageMemoryBarrier.image = mActualImages[actualImageIndex];
+                imageMemoryBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                imageMemoryBarrier.subresourceRange.baseMipLevel = 0;
+                imageMemoryBarrier.subresourceRange.levelCount = 1;
+                imageMemoryBarrier.subresourceRange.baseArrayLayer = 0;
+                imageMemoryBarrier.subresourceRange.layerCount = 1;
+                imageMemoryBarriers[0] = imageMemoryBarrier;
+                imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+                imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                imageMemoryBarrier.image = mVirtualVkImages[virtualImageIndex];
+                imageMemoryBarriers[1] = imageMemoryBarrier;
+                dispatchTable.gvkCmdPipelineBarrier(
+                    commandBuffer,
+                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                    VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    0,
+                    0, nullptr,
+                    0, nullptr,
+                    (uint32_t)imageMemoryBarriers.size(),
+                    imageMemoryBarriers.data()
+                );
+
+                // Copy virtual VkImage -> actual VkImage
+                auto imageCopy = get_default<VkImageCopy>();
+                imageCopy.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                imageCopy.srcSubresource.layerCount = 1;
+                imageCopy.dstSubresource = imageCopy.srcSubresource;
+                imageCopy.extent.width = mExtent.width;
+                imageCopy.extent.height = mExtent.height;
+                imageCopy.extent.depth = 1;
+                dispatchTable.gvkCmdCopyImage(
+                    commandBuffer,
+                    mVirtualVkImages[virtualImageIndex],
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                    mActualImages[actualImageIndex],
+                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                    1,
+                    &imageCopy
+                );
+
+                // Actual VkImage VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL -> VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+                // Virtual VkImage VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL -> VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+                //  NOTE : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT makes the transitions
+                //  available to any later command on the VkQueue, BOTTOM_OF_PIPE
+                //  wouldn't chain with the application's next barrier.
+                imageMemoryBarriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                imageMemoryBarriers[0].dstAccessMask = 0;
+                imageMemoryBarriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                imageMemoryBarriers[0].newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+                imageMemoryBarriers[1].srcAccessMask = 0;
+                imageMemoryBarriers[1].dstAccessMask = 0;
+                imageMemoryBarriers[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                imageMemoryBarriers[1].newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+                dispatchTable.gvkCmdPipelineBarrier(
+                    commandBuffer,
+                    VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                    0,
+                    0, nullptr,
+                    0, nullptr,
+                    (uint32_t)imageMemoryBarriers.size(),
+                    imageMemoryBarriers.data()
+                );
+
+                gvk_result(dispatchTable.gvkEndCommandBuffer(commandBuffer));
+            }
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult HeadlessSwapchain::create(const Device& gvkDevice, const VkSwapchainCreateInfoKHR* pCreateInfo, const HeadlessInfo& headlessInfo, VirtualImagePool* pVirtualImagePool)
+{
+    assert(gvkDevice);
+    assert(pCreateInfo);
+    assert(pVirtualImagePool);
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        mGvkDevice = gvkDevice;
+        mPresentMode = pCreateInfo->presentMode;
+        auto paced =
+            headlessInfo.presentPacing == PresentPacing::FixedInterval || (
+                headlessInfo.presentPacing == PresentPacing::Fifo && (
+                    mPresentMode == VK_PRESENT_MODE_FIFO_KHR ||
+                    mPresentMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR
+                )
+            );
+        mPresentInterval = paced ? headlessInfo.presentInterval : std::chrono::nanoseconds{ };
+        auto imageCount = std::max(pCreateInfo->minImageCount, 1u);
+        gvk_result(pVirtualImagePool->create_images(mGvkDevice, *pCreateInfo, imageCount, &mGvkDeviceMemory, &mVirtualVkImages));
+
+        // NOTE : Each VkImage gets a VkSemaphore that's signaled when its present
+        //  completes and waited on when it's next acquired.  Presents and
+        //  acquisitions of a given VkImage strictly alternate so each VkSemaphore
+        //  always has a wait pending before it's signaled again.
+        mPresentSemaphores.resize(imageCount);
+        for (auto& presentSemaphore : mPresentSemaphores) {
+            gvk_result(Semaphore::create(mGvkDevice, &get_default<VkSemaphoreCreateInfo>(), nullptr, &presentSemaphore));
+        }
+        mPresentsPending.resize(imageCount, false);
+        for (uint32_t i = 0; i < imageCount; ++i) {
+            mAvailableVkImages.push_back(i);
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void HeadlessSwapchain::destroy(VirtualImagePool* pVirtualImagePool)
+{
+    assert(pVirtualImagePool);
+    pVirtualImagePool->destroy_images(&mGvkDeviceMemory, &mVirtualVkImages);
+    mGvkDevice.reset();
+    mGvkQueue.reset();
+    mPresentMode = { };
+    mPresentInterval = { };
+    mAvailableTime = { };
+    mPresentSemaphores.clear();
+    mPresentsPending.clear();
+    mAvailableVkImages.clear();
+    mAcquiredVkImages.clear();
+}
+
+VkResult HeadlessSwapchain::get_images(uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const
+{
+    assert(pSwapchainImageCount);
+    auto imageCount = (uint32_t)mVirtualVkImages.size();
+    if (!pSwapchainImages) {
+        *pSwapchainImageCount = imageCount;
+        return VK_SUCCESS;
+    }
+    auto count = std::min(*pSwapchainImageCount, imageCount);
+    memcpy(pSwapchainImages, mVirtualVkImages.data(), count * sizeof(VkImage));
+    *pSwapchainImageCount = count;
+    return count < imageCount ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+VkResult HeadlessSwapchain::acquire_next_image(uint64_t timeout, uint32_t* pImageIndex, VkSemaphore* pPresentSemaphore, std::chrono::steady_clock::time_point* pAvailableTime)
+{
+    assert(pImageIndex);
+    assert(pPresentSemaphore);
+    assert(pAvailableTime);
+
+    // NOTE : VkImages are only made available by presents, if every VkImage is
+    //  acquired no amount of waiting will make one available.
+    if (mAvailableVkImages.empty()) {
+        return timeout ? VK_TIMEOUT : VK_NOT_READY;
+    }
+
+    // NOTE : When paced, a VkImage is made available no sooner than one present
+    //  interval after the previous acquisition, if that's further out than the
+    //  given timeout the acquisition fails without consuming a VkImage.
+    auto now = std::chrono::steady_clock::now();
+    auto availableTime = std::max(now, mAvailableTime);
+    if ((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(availableTime - now).count() > timeout) {
+        return timeout ? VK_TIMEOUT : VK_NOT_READY;
+    }
+    mAvailableTime = availableTime + mPresentInterval;
+    *pAvailableTime = availableTime;
+
+    // NOTE : VkImages are acquired in the order they were presented, the least
+    //  recently presented VkImage is the most likely to have finished presenting.
+    auto imageIndex = mAvailableVkImages.front();
+    mAvailableVkImages.pop_front();
+    auto inserted = mAcquiredVkImages.insert(imageIndex).second;
     (void)inserted;
     assert(inserted);
-    mAcquiredVkImages.erase(itr);
+    *pPresentSemaphore = mPresentsPending[imageIndex] ? mPresentSemaphores[imageIndex].get<VkSemaphore>() : VK_NULL_HANDLE;
+    mPresentsPending[imageIndex] = false;
+    *pImageIndex = imageIndex;
+    return VK_SUCCESS;
+}
+
+VkResult HeadlessSwapchain::present(const Queue& gvkQueue, uint32_t imageIndex, VkSemaphore* pPresentSemaphore)
+{
+    assert(gvkQueue);
+    assert(pPresentSemaphore);
+    auto erased = mAcquiredVkImages.erase(imageIndex);
+    (void)erased;
+    assert(erased && "VK_LAYER_INTEL_gvk_virtual_swapchain vkQueuePresentKHR() called with a VkImage that hasn't been acquired");
+    if (!erased) {
+        return VK_ERROR_OUT_OF_DATE_KHR;
+    }
+    mGvkQueue = gvkQueue;
+    mAvailableVkImages.push_back(imageIndex);
+    mPresentsPending[imageIndex] = true;
+    *pPresentSemaphore = mPresentSemaphores[imageIndex];
+    return VK_SUCCESS;
+}
+
+void HeadlessSwapchain::cancel_present(uint32_t imageIndex)
+{
+    // NOTE : If the submission that signals a VkImage's present VkSemaphore fails,
+    //  the VkSemaphore will never be signaled so the VkImage's next acquisition
+    //  mustn't wait on it.
+    assert(imageIndex < mPresentsPending.size());
+    mPresentsPending[imageIndex] = false;
+}
+
+const Queue& HeadlessSwapchain::get_queue() const
+{
+    // NOTE : vkAcquireNextImageKHR() doesn't provide a VkQueue so acquisitions
+    //  are submitted to the VkQueue this swapchain was last presented on.  The
+    //  application may be using that VkQueue from another thread, so headless
+    //  submissions are serialized with the application's by the Layer's VkQueue
+    //  mutexes.  Before the first present the device's first VkQueue is used.
+    assert(mGvkDevice);
+    return mGvkQueue ? mGvkQueue : mGvkDevice.get<QueueFamilies>()[0].queues[0];
+}
+
+VkImage HeadlessSwapchain::get_image(uint32_t imageIndex) const
+{
+    assert(imageIndex < mVirtualVkImages.size());
+    return mVirtualVkImages[imageIndex];
 }
 
 VkResult Layer::post_vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance, VkResult gvkResult)
@@ -316,6 +655,10 @@ VkResult Layer::post_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDev
             auto inserted = mGvkDevices.insert(gvkDevice).second;
             (void)inserted;
             assert(inserted);
+            mVirtualImagePools[*pDevice];
+            auto& deviceFrameReadback = mDeviceFrameReadbacks[*pDevice];
+            deviceFrameReadback.frameReadbackInfo = FrameReadbackInfo::from_env();
+            deviceFrameReadback.spStatistics = std::make_shared<FrameReadbackStatistics>();
         }
     }
     return gvkResult;
@@ -325,11 +668,19 @@ void Layer::pre_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pA
 {
     (void)pAllocator;
     if (device) {
+        wait_for_frame_fences(device);
         std::lock_guard<std::mutex> lock(mMutex);
-        auto erased = mCommandBuffers.erase(device);
-        (void)erased;
-        assert(erased);
-        erased = mGvkDevices.erase(device);
+        destroy_retired_swapchains(device, true);
+        mVirtualImagePools.erase(device);
+        for (auto itr = mFrameFences.begin(); itr != mFrameFences.end();) {
+            if (!itr->second.device || itr->second.device == device) {
+                itr = mFrameFences.erase(itr);
+            } else {
+                ++itr;
+            }
+        }
+        mDeviceFrameReadbacks.erase(device);
+        auto erased = mGvkDevices.erase(device);
         (void)erased;
         assert(erased);
     }
@@ -380,10 +731,20 @@ VkResult Layer::post_vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNext
 VkResult Layer::pre_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex, VkResult gvkResult)
 {
     if (gvkResult == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto itr = mSwapchains.find(swapchain);
-        assert(itr != mSwapchains.end());
-        gvkResult = itr->second.pre_vkAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+        Fence copyFence;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto itr = mSwapchains.find(swapchain);
+            assert(itr != mSwapchains.end());
+            gvkResult = itr->second.pre_vkAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, &copyFence);
+        }
+
+        // NOTE : The virtual VkImage mustn't be rendered to while its previous
+        //  copy and frame readback are reading it.  Access to a VkSwapchainKHR is
+        //  externally synchronized so the wait doesn't need to hold mMutex.
+        if (gvkResult == VK_SUCCESS && copyFence) {
+            gvkResult = copyFence.get<Device>().get<DispatchTable>().gvkWaitForFences(device, 1, &copyFence.get<VkFence>(), VK_TRUE, UINT64_MAX);
+        }
     }
     return gvkResult;
 }
@@ -436,21 +797,62 @@ VkResult Layer::post_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCrea
     if (vkResult == VK_SUCCESS) {
         std::lock_guard<std::mutex> lock(mMutex);
         assert(!mSwapchains.count(*pSwapchain));
-        vkResult = mSwapchains[*pSwapchain].post_vkCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+        destroy_retired_swapchains(device, false);
+        vkResult = mSwapchains[*pSwapchain].post_vkCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, &mVirtualImagePools[device]);
+        if (vkResult == VK_SUCCESS) {
+            vkResult = create_frame_readback(device, *pSwapchain, *pCreateInfo);
+        }
     }
     return vkResult;
 }
 
 void Layer::pre_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
 {
-    (void)device;
     (void)pAllocator;
     if (swapchain) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto itr = mSwapchains.find(swapchain);
-        assert(itr != mSwapchains.end());
-        itr->second.pre_vkDestroySwapchainKHR(device, swapchain, pAllocator);
-        mSwapchains.erase(itr);
+        // NOTE : The actual VkImages are destroyed with the VkSwapchainKHR as soon
+        //  as this returns, so copies into them have to complete first.  Only the
+        //  copies' own Fences are waited on, other swapchains' copies and the
+        //  application's work are unaffected.
+        std::unique_ptr<FrameReadback> upFrameReadback;
+        std::vector<Fence> copyFences;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto frameReadbackItr = mFrameReadbacks.find(swapchain);
+            if (frameReadbackItr != mFrameReadbacks.end()) {
+                upFrameReadback = std::move(frameReadbackItr->second);
+                mFrameReadbacks.erase(frameReadbackItr);
+            }
+            auto itr = mSwapchains.find(swapchain);
+            assert(itr != mSwapchains.end());
+            copyFences = itr->second.get_copy_fences();
+        }
+        if (!copyFences.empty()) {
+            std::vector<VkFence> fences(copyFences.begin(), copyFences.end());
+            copyFences[0].get<Device>().get<DispatchTable>().gvkWaitForFences(device, (uint32_t)fences.size(), fences.data(), VK_TRUE, UINT64_MAX);
+        }
+
+        // NOTE : The virtual VkImages' VkDeviceMemory and the copy VkCommandBuffers
+        //  are recycled once the frame Fences that are currently pending have
+        //  signaled, this keeps recreating a swapchain from an oldSwapchain and
+        //  then destroying the oldSwapchain from stalling on unrelated work.
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto itr = mSwapchains.find(swapchain);
+            assert(itr != mSwapchains.end());
+            RetiredSwapchain retiredSwapchain;
+            retiredSwapchain.gvkDevice = device;
+            get_frame_fences(device, &retiredSwapchain.fences);
+            retiredSwapchain.swapchain = std::move(itr->second);
+            mSwapchains.erase(itr);
+            mRetiredSwapchains.push_back(std::move(retiredSwapchain));
+            destroy_retired_swapchains(device, false);
+        }
+
+        // NOTE : FrameReadback waits for its pending frames to be processed when
+        //  it's destroyed, that's done without holding mMutex so presents to other
+        //  swapchains aren't blocked.
+        upFrameReadback.reset();
     }
 }
 
@@ -714,72 +1116,615 @@ VkResult Layer::post_vkWaitForPresentKHR(VkDevice device, VkSwapchainKHR swapcha
     return gvkResult;
 }
 
-VkResult Layer::pre_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo, VkResult vkResult)
+// NOTE : When headless, acquisitions submit to a VkQueue the application didn't
+//  provide, so the application's use of each VkQueue is serialized with the
+//  layer's by a per VkQueue mutex that's locked in pre_ hooks and unlocked in
+//  post_ hooks.
+VkResult Layer::pre_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence, VkResult gvkResult)
 {
-    if (vkResult == VK_SUCCESS) {
-        gvk_result_scope_begin(vkResult) {
-            Queue gvkQueue = queue;
-            Device gvkDevice = gvkQueue.get<VkDevice>();
-            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
-            gvk_result(get_command_buffer(queue, &commandBuffer));
-            auto commandBufferBeginInfo = get_default<VkCommandBufferBeginInfo>();
-            commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            gvk_result(gvkDevice.get<DispatchTable>().gvkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo));
-            for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto swapchainItr = mSwapchains.find(pPresentInfo->pSwapchains[i]);
-                assert(swapchainItr != mSwapchains.end());
-                swapchainItr->second.pre_vkQueuePresentKHR(commandBuffer, pPresentInfo->pImageIndices[i]);
-            }
-            gvk_result(gvkDevice.get<DispatchTable>().gvkEndCommandBuffer(commandBuffer));
-            // TODO : Hook up app's VkSemaphores
-            auto submitInfo = get_default<VkSubmitInfo>();
-            submitInfo.commandBufferCount = 1;
-            submitInfo.pCommandBuffers = &commandBuffer;
-            gvk_result(gvkDevice.get<DispatchTable>().gvkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE));
-        } gvk_result_scope_end;
+    (void)bindInfoCount;
+    (void)pBindInfo;
+    (void)fence;
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).lock();
     }
-    return vkResult;
+    return gvkResult;
 }
 
-VkResult Layer::post_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo, VkResult gvkResult)
+VkResult Layer::post_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence, VkResult gvkResult)
 {
-    (void)queue;
-    (void)pPresentInfo;
-    // NOOP :
+    (void)bindInfoCount;
+    (void)pBindInfo;
+    (void)fence;
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).unlock();
+    }
+    return gvkResult;
+}
+
+VkResult Layer::pre_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, VkResult gvkResult)
+{
+    (void)submitCount;
+    (void)pSubmits;
+    (void)fence;
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).lock();
+    }
+    return gvkResult;
+}
+
+VkResult Layer::post_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, VkResult gvkResult)
+{
+    (void)submitCount;
+    (void)pSubmits;
+    (void)fence;
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).unlock();
+    }
+    return gvkResult;
+}
+
+VkResult Layer::pre_vkQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult)
+{
+    (void)submitCount;
+    (void)pSubmits;
+    (void)fence;
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).lock();
+    }
+    return gvkResult;
+}
+
+VkResult Layer::post_vkQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult)
+{
+    (void)submitCount;
+    (void)pSubmits;
+    (void)fence;
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).unlock();
+    }
+    return gvkResult;
+}
+
+VkResult Layer::pre_vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult)
+{
+    return pre_vkQueueSubmit2(queue, submitCount, pSubmits, fence, gvkResult);
+}
+
+VkResult Layer::post_vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, VkResult gvkResult)
+{
+    return post_vkQueueSubmit2(queue, submitCount, pSubmits, fence, gvkResult);
+}
+
+VkResult Layer::pre_vkQueueWaitIdle(VkQueue queue, VkResult gvkResult)
+{
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).lock();
+    }
+    return gvkResult;
+}
+
+VkResult Layer::post_vkQueueWaitIdle(VkQueue queue, VkResult gvkResult)
+{
+    if (mHeadlessInfo.enabled) {
+        get_queue_mutex(queue).unlock();
+    }
     return gvkResult;
 }
 
-VkResult Layer::get_command_buffer(const Queue& gvkQueue, VkCommandBuffer* pCommandBuffer)
+std::mutex& Layer::get_queue_mutex(VkQueue queue)
+{
+    // NOTE : std::unordered_map nodes are stable so the returned std::mutex can be
+    //  used after mMutex is released.
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mQueueMutexes[queue];
+}
+
+VkResult Layer::submit_frame(const Queue& gvkQueue, const VkSubmitInfo& submitInfo, Fence* pFence)
 {
     assert(gvkQueue);
-    assert(pCommandBuffer);
-    *pCommandBuffer = VK_NULL_HANDLE;
     gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
         Device gvkDevice = gvkQueue.get<VkDevice>();
         assert(gvkDevice);
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto& commandResources = mCommandBuffers[gvkDevice][gvkQueue.get<VkDeviceQueueCreateInfo>().queueFamilyIndex];
-        assert(!commandResources.first == !commandResources.second);
-        if (!commandResources.first) {
-            auto commandPoolCreateInfo = get_default<VkCommandPoolCreateInfo>();
-            commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-            commandPoolCreateInfo.queueFamilyIndex = gvkQueue.get<VkDeviceQueueCreateInfo>().queueFamilyIndex;
-            gvk_result(CommandPool::create(gvkDevice, &commandPoolCreateInfo, nullptr, &commandResources.first));
-            auto commandBufferAllocateInfo = get_default<VkCommandBufferAllocateInfo>();
-            commandBufferAllocateInfo.commandPool = commandResources.first;
-            commandBufferAllocateInfo.commandBufferCount = 1;
-            // TODO : Detect layer and automate dispatch table update so gvk::CommandBuffer
-            //  can be allocated in layers
-            gvk_result(gvkDevice.get<DispatchTable>().gvkAllocateCommandBuffers(gvkDevice, &commandBufferAllocateInfo, &commandResources.second));
-            *(void**)commandResources.second = *(void**)gvkDevice.get<VkDevice>();
-        }
-        *pCommandBuffer = commandResources.second;
-        gvk_result(*pCommandBuffer ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED);
+        FrameFences* pFrameFences = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            pFrameFences = &mFrameFences[gvkQueue];
+        }
+
+        // NOTE : Access to a VkQueue is externally synchronized so this VkQueue's
+        //  FrameFences can be used without holding mMutex.  Waiting on the oldest
+        //  Fence bounds the number of submissions in flight to FrameCount.
+        pFrameFences->device = gvkDevice;
+        auto& fence = pFrameFences->fences[pFrameFences->frameIndex];
+        pFrameFences->frameIndex = (pFrameFences->frameIndex + 1) % FrameCount;
+        const auto& dispatchTable = gvkDevice.get<DispatchTable>();
+        if (!fence) {
+            gvk_result(Fence::create(gvkDevice, &get_default<VkFenceCreateInfo>(), nullptr, &fence));
+        } else {
+            gvk_result(dispatchTable.gvkWaitForFences(gvkDevice, 1, &fence.get<VkFence>(), VK_TRUE, UINT64_MAX));
+            gvkResult = dispatchTable.gvkResetFences(gvkDevice, 1, &fence.get<VkFence>());
+        }
+        if (gvkResult == VK_SUCCESS) {
+            gvkResult = dispatchTable.gvkQueueSubmit(gvkQueue, 1, &submitInfo, fence);
+        }
+
+        // NOTE : A Fence that was reset but never submitted will never be signaled,
+        //  it's released so waits on this slot don't block forever and the next
+        //  submission using this slot creates a new Fence.
+        if (gvkResult != VK_SUCCESS) {
+            fence.reset();
+        } else if (pFence) {
+            *pFence = fence;
+        }
     } gvk_result_scope_end;
     return gvkResult;
 }
 
+void Layer::get_frame_fences(VkDevice device, std::vector<Fence>* pFences) const
+{
+    // NOTE : Called with mMutex held
+    assert(pFences);
+    for (const auto& frameFencesItr : mFrameFences) {
+        for (const auto& fence : frameFencesItr.second.fences) {
+            if (fence && fence.get<VkDevice>() == device) {
+                pFences->push_back(fence);
+            }
+        }
+    }
+}
+
+VkResult Layer::wait_for_frame_fences(VkDevice device)
+{
+    gvk_result_scope_begin(VK_SUCCESS) {
+        std::vector<Fence> gvkFences;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            get_frame_fences(device, &gvkFences);
+        }
+        if (!gvkFences.empty()) {
+            std::vector<VkFence> fences(gvkFences.begin(), gvkFences.end());
+            gvk_result(gvkFences[0].get<Device>().get<DispatchTable>().gvkWaitForFences(device, (uint32_t)fences.size(), fences.data(), VK_TRUE, UINT64_MAX));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void Layer::destroy_retired_swapchains(VkDevice device, bool force)
+{
+    // NOTE : Called with mMutex held.  A frame Fence may have been reset and
+    //  resubmitted since the swapchain was retired, in that case its new work
+    //  completes after the work the swapchain was waiting on so the check is
+    //  conservative.
+    for (auto itr = mRetiredSwapchains.begin(); itr != mRetiredSwapchains.end();) {
+        if (itr->gvkDevice.get<VkDevice>() != device) {
+            ++itr;
+            continue;
+        }
+        auto& fences = itr->fences;
+        const auto& dispatchTable = itr->gvkDevice.get<DispatchTable>();
+        auto pendingItr = std::find_if(fences.begin(), fences.end(), [&](const Fence& fence) { return dispatchTable.gvkGetFenceStatus(device, fence) != VK_SUCCESS; });
+        fences.erase(fences.begin(), pendingItr);
+        if (fences.empty() || force) {
+            itr->swapchain.destroy(&mVirtualImagePools[device]);
+            itr = mRetiredSwapchains.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
+VkResult Layer::create_frame_readback(const Device& gvkDevice, VkSwapchainKHR swapchain, const VkSwapchainCreateInfoKHR& swapchainCreateInfo)
+{
+    // NOTE : Called with mMutex held
+    gvk_result_scope_begin(VK_SUCCESS) {
+        auto itr = mDeviceFrameReadbacks.find(gvkDevice.get<VkDevice>());
+        assert(itr != mDeviceFrameReadbacks.end());
+        const auto& deviceFrameReadback = itr->second;
+        if (deviceFrameReadback.frameReadbackInfo.frameInterval) {
+            auto upFrameReadback = std::make_unique<FrameReadback>();
+            gvk_result(upFrameReadback->create(gvkDevice, swapchain, swapchainCreateInfo, deviceFrameReadback.frameReadbackInfo, deviceFrameReadback.spStatistics));
+            mFrameReadbacks[swapchain] = std::move(upFrameReadback);
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult Layer::begin_frame_readback(const Queue& gvkQueue, VkSwapchainKHR swapchain, uint32_t imageIndex, VkImage image, std::vector<VkCommandBuffer>* pCommandBuffers, std::vector<FrameReadback*>* pFrameReadbacks)
+{
+    // NOTE : Called with mMutex held
+    assert(pCommandBuffers);
+    assert(pFrameReadbacks);
+    gvk_result_scope_begin(VK_SUCCESS) {
+        auto itr = mFrameReadbacks.find(swapchain);
+        if (itr != mFrameReadbacks.end()) {
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            gvk_result(itr->second->begin_frame(gvkQueue, imageIndex, image, &commandBuffer));
+            if (commandBuffer) {
+                pCommandBuffers->push_back(commandBuffer);
+                pFrameReadbacks->push_back(itr->second.get());
+            }
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void Layer::set_frame_readback_info(VkDevice device, const GvkFrameReadbackInfo* pFrameReadbackInfo)
+{
+    auto& thisLayer = get_layer();
+    std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+    auto itr = thisLayer.mDeviceFrameReadbacks.find(device);
+    if (itr == thisLayer.mDeviceFrameReadbacks.end()) {
+        return;
+    }
+    itr->second.frameReadbackInfo = pFrameReadbackInfo ? FrameReadbackInfo(*pFrameReadbackInfo) : FrameReadbackInfo();
+}
+
+void Layer::get_frame_readback_statistics(VkDevice device, GvkFrameReadbackStatistics* pFrameReadbackStatistics)
+{
+    assert(pFrameReadbackStatistics);
+    auto& thisLayer = get_layer();
+    std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+    auto itr = thisLayer.mDeviceFrameReadbacks.find(device);
+    *pFrameReadbackStatistics = itr != thisLayer.mDeviceFrameReadbacks.end() ? itr->second.spStatistics->get() : GvkFrameReadbackStatistics{ };
+}
+
+void Layer::register_intercepted_entry_points(layer::Registry& registry)
+{
+    mHeadlessInfo = HeadlessInfo::from_env();
+    auto& interceptedEntryPoints = registry.interceptedEntryPoints;
+    if (!mHeadlessInfo.enabled) {
+        interceptedEntryPoints["vkQueuePresentKHR"] = (PFN_vkVoidFunction)intercepted_vkQueuePresentKHR;
+    } else {
+        interceptedEntryPoints["vkGetPhysicalDeviceSurfaceSupportKHR"] = (PFN_vkVoidFunction)headless_vkGetPhysicalDeviceSurfaceSupportKHR;
+        interceptedEntryPoints["vkGetPhysicalDeviceSurfaceCapabilitiesKHR"] = (PFN_vkVoidFunction)headless_vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+        interceptedEntryPoints["vkGetPhysicalDeviceSurfaceFormatsKHR"] = (PFN_vkVoidFunction)headless_vkGetPhysicalDeviceSurfaceFormatsKHR;
+        interceptedEntryPoints["vkGetPhysicalDeviceSurfacePresentModesKHR"] = (PFN_vkVoidFunction)headless_vkGetPhysicalDeviceSurfacePresentModesKHR;
+        interceptedEntryPoints["vkCreateSwapchainKHR"] = (PFN_vkVoidFunction)headless_vkCreateSwapchainKHR;
+        interceptedEntryPoints["vkDestroySwapchainKHR"] = (PFN_vkVoidFunction)headless_vkDestroySwapchainKHR;
+        interceptedEntryPoints["vkGetSwapchainImagesKHR"] = (PFN_vkVoidFunction)headless_vkGetSwapchainImagesKHR;
+        interceptedEntryPoints["vkAcquireNextImageKHR"] = (PFN_vkVoidFunction)headless_vkAcquireNextImageKHR;
+        interceptedEntryPoints["vkAcquireNextImage2KHR"] = (PFN_vkVoidFunction)headless_vkAcquireNextImage2KHR;
+        interceptedEntryPoints["vkQueuePresentKHR"] = (PFN_vkVoidFunction)headless_vkQueuePresentKHR;
+    }
+}
+
+Layer& Layer::get_layer()
+{
+    // NOTE : on_load() registers a single virtual_swapchain::Layer
+    auto& layers = layer::Registry::get().layers;
+    assert(!layers.empty() && layers.front());
+    return static_cast<Layer&>(*layers.front());
+}
+
+VkResult VKAPI_CALL Layer::intercepted_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+    assert(queue);
+    assert(pPresentInfo);
+    auto& thisLayer = get_layer();
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        Queue gvkQueue = queue;
+        Device gvkDevice = gvkQueue.get<VkDevice>();
+        std::vector<VkCommandBuffer> commandBuffers(pPresentInfo->swapchainCount);
+        std::vector<VkSemaphore> waitSemaphores(pPresentInfo->swapchainCount);
+        std::vector<uint32_t> imageIndices(pPresentInfo->swapchainCount);
+        std::vector<VkCommandBuffer> frameReadbackCommandBuffers;
+        std::vector<FrameReadback*> frameReadbacks;
+        {
+            std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+            if (!thisLayer.mRetiredSwapchains.empty()) {
+                thisLayer.destroy_retired_swapchains(gvkDevice, false);
+            }
+            for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
+                auto swapchainItr = thisLayer.mSwapchains.find(pPresentInfo->pSwapchains[i]);
+                assert(swapchainItr != thisLayer.mSwapchains.end());
+                auto imageIndex = pPresentInfo->pImageIndices[i];
+                gvk_result(swapchainItr->second.pre_vkQueuePresentKHR(gvkQueue, imageIndex, &commandBuffers[i], &waitSemaphores[i], &imageIndices[i]));
+                gvk_result(thisLayer.begin_frame_readback(gvkQueue, pPresentInfo->pSwapchains[i], imageIndex, swapchainItr->second.get_image(imageIndex), &frameReadbackCommandBuffers, &frameReadbacks));
+            }
+        }
+        commandBuffers.insert(commandBuffers.end(), frameReadbackCommandBuffers.begin(), frameReadbackCommandBuffers.end());
+
+        // NOTE : The copies wait on the application's present VkSemaphores and
+        //  signal a VkSemaphore per actual VkImage, the present is then called down
+        //  the chain with a copy of the application's VkPresentInfoKHR that waits
+        //  on those VkSemaphores and presents the actual VkImage indices.  Frame
+        //  readbacks are recorded after the copies in the same batch, so the batch's
+        //  Fence is recorded for each presented virtual VkImage and waited on before
+        //  that virtual VkImage is acquired again.
+        std::vector<VkPipelineStageFlags> waitDstStageMasks(pPresentInfo->waitSemaphoreCount, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        auto submitInfo = get_default<VkSubmitInfo>();
+        submitInfo.waitSemaphoreCount = pPresentInfo->waitSemaphoreCount;
+        submitInfo.pWaitSemaphores = pPresentInfo->pWaitSemaphores;
+        submitInfo.pWaitDstStageMask = waitDstStageMasks.data();
+        submitInfo.commandBufferCount = (uint32_t)commandBuffers.size();
+        submitInfo.pCommandBuffers = commandBuffers.data();
+        submitInfo.signalSemaphoreCount = (uint32_t)waitSemaphores.size();
+        submitInfo.pSignalSemaphores = waitSemaphores.data();
+        Fence copyFence;
+        gvk_result(thisLayer.submit_frame(gvkQueue, submitInfo, &copyFence));
+        {
+            std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+            for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
+                auto swapchainItr = thisLayer.mSwapchains.find(pPresentInfo->pSwapchains[i]);
+                if (swapchainItr != thisLayer.mSwapchains.end()) {
+                    swapchainItr->second.on_copies_submitted(pPresentInfo->pImageIndices[i], copyFence);
+                }
+            }
+        }
+        for (auto pFrameReadback : frameReadbacks) {
+            gvk_result(pFrameReadback->end_frame(gvkQueue));
+        }
+
+        auto layerPresentInfo = *pPresentInfo;
+        layerPresentInfo.waitSemaphoreCount = (uint32_t)waitSemaphores.size();
+        layerPresentInfo.pWaitSemaphores = waitSemaphores.data();
+        layerPresentInfo.pImageIndices = imageIndices.data();
+        gvkResult = gvkQueue.get<DispatchTable>().gvkQueuePresentKHR(queue, &layerPresentInfo);
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult VKAPI_CALL Layer::headless_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported)
+{
+    (void)physicalDevice;
+    (void)queueFamilyIndex;
+    (void)surface;
+    assert(pSupported);
+    *pSupported = VK_TRUE;
+    return VK_SUCCESS;
+}
+
+VkResult VKAPI_CALL Layer::headless_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+    (void)surface;
+    assert(pSurfaceCapabilities);
+    VkPhysicalDeviceProperties physicalDeviceProperties{ };
+    layer::Registry::get().get_instance_dispatch_table(physicalDevice).gvkGetPhysicalDeviceProperties(physicalDevice, &physicalDeviceProperties);
+
+    // NOTE : A currentExtent of { 0xFFFFFFFF, 0xFFFFFFFF } indicates that the
+    //  swapchain's imageExtent determines the surface size.
+    *pSurfaceCapabilities = { };
+    pSurfaceCapabilities->minImageCount = 2;
+    pSurfaceCapabilities->maxImageCount = 8;
+    pSurfaceCapabilities->currentExtent = { UINT32_MAX, UINT32_MAX };
+    pSurfaceCapabilities->minImageExtent = { 1, 1 };
+    pSurfaceCapabilities->maxImageExtent = { physicalDeviceProperties.limits.maxImageDimension2D, physicalDeviceProperties.limits.maxImageDimension2D };
+    pSurfaceCapabilities->maxImageArrayLayers = 1;
+    pSurfaceCapabilities->supportedTransforms = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    pSurfaceCapabilities->currentTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    pSurfaceCapabilities->supportedCompositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    pSurfaceCapabilities->supportedUsageFlags =
+        VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+        VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+        VK_IMAGE_USAGE_SAMPLED_BIT |
+        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    return VK_SUCCESS;
+}
+
+VkResult VKAPI_CALL Layer::headless_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats)
+{
+    (void)surface;
+    assert(pSurfaceFormatCount);
+    static const std::array<VkFormat, 4> scFormats {
+        VK_FORMAT_B8G8R8A8_UNORM,
+        VK_FORMAT_B8G8R8A8_SRGB,
+        VK_FORMAT_R8G8B8A8_UNORM,
+        VK_FORMAT_R8G8B8A8_SRGB,
+    };
+    const auto& dispatchTable = layer::Registry::get().get_instance_dispatch_table(physicalDevice);
+    std::vector<VkSurfaceFormatKHR> surfaceFormats;
+    for (auto format : scFormats) {
+        VkFormatProperties formatProperties{ };
+        dispatchTable.gvkGetPhysicalDeviceFormatProperties(physicalDevice, format, &formatProperties);
+        if (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT) {
+            surfaceFormats.push_back({ format, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR });
+        }
+    }
+    if (!pSurfaceFormats) {
+        *pSurfaceFormatCount = (uint32_t)surfaceFormats.size();
+        return VK_SUCCESS;
+    }
+    auto count = std::min(*pSurfaceFormatCount, (uint32_t)surfaceFormats.size());
+    std::copy_n(surfaceFormats.begin(), count, pSurfaceFormats);
+    *pSurfaceFormatCount = count;
+    return count < surfaceFormats.size() ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+VkResult VKAPI_CALL Layer::headless_vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes)
+{
+    (void)physicalDevice;
+    (void)surface;
+    assert(pPresentModeCount);
+    static const std::array<VkPresentModeKHR, 4> scPresentModes {
+        VK_PRESENT_MODE_FIFO_KHR,
+        VK_PRESENT_MODE_FIFO_RELAXED_KHR,
+        VK_PRESENT_MODE_MAILBOX_KHR,
+        VK_PRESENT_MODE_IMMEDIATE_KHR,
+    };
+    if (!pPresentModes) {
+        *pPresentModeCount = (uint32_t)scPresentModes.size();
+        return VK_SUCCESS;
+    }
+    auto count = std::min(*pPresentModeCount, (uint32_t)scPresentModes.size());
+    std::copy_n(scPresentModes.begin(), count, pPresentModes);
+    *pPresentModeCount = count;
+    return count < scPresentModes.size() ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+VkResult VKAPI_CALL Layer::headless_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain)
+{
+    (void)pAllocator;
+    assert(device);
+    assert(pCreateInfo);
+    assert(pSwapchain);
+    auto& thisLayer = get_layer();
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        // NOTE : Headless VkSwapchainKHR handles are never seen by the ICD so they
+        //  only need to be unique within this layer.
+        HeadlessSwapchain headlessSwapchain;
+        std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+        gvk_result(headlessSwapchain.create(Device(device), pCreateInfo, thisLayer.mHeadlessInfo, &thisLayer.mVirtualImagePools[device]));
+        *pSwapchain = (VkSwapchainKHR)(uintptr_t)++thisLayer.mHeadlessSwapchainCount;
+        thisLayer.mHeadlessSwapchains[*pSwapchain] = std::move(headlessSwapchain);
+        gvk_result(thisLayer.create_frame_readback(device, *pSwapchain, *pCreateInfo));
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+void VKAPI_CALL Layer::headless_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator)
+{
+    (void)pAllocator;
+    if (swapchain) {
+        // NOTE : Acquisitions and presents are tracked with the same frame Fences
+        //  as present copies, they have to complete before this swapchain's
+        //  VkImages and VkSemaphores are destroyed.
+        auto& thisLayer = get_layer();
+        thisLayer.wait_for_frame_fences(device);
+        std::unique_ptr<FrameReadback> upFrameReadback;
+        {
+            std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+            auto frameReadbackItr = thisLayer.mFrameReadbacks.find(swapchain);
+            if (frameReadbackItr != thisLayer.mFrameReadbacks.end()) {
+                upFrameReadback = std::move(frameReadbackItr->second);
+                thisLayer.mFrameReadbacks.erase(frameReadbackItr);
+            }
+            auto itr = thisLayer.mHeadlessSwapchains.find(swapchain);
+            assert(itr != thisLayer.mHeadlessSwapchains.end());
+            itr->second.destroy(&thisLayer.mVirtualImagePools[device]);
+            thisLayer.mHeadlessSwapchains.erase(itr);
+        }
+        upFrameReadback.reset();
+    }
+}
+
+VkResult VKAPI_CALL Layer::headless_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages)
+{
+    (void)device;
+    auto& thisLayer = get_layer();
+    std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+    auto itr = thisLayer.mHeadlessSwapchains.find(swapchain);
+    assert(itr != thisLayer.mHeadlessSwapchains.end());
+    return itr->second.get_images(pSwapchainImageCount, pSwapchainImages);
+}
+
+VkResult VKAPI_CALL Layer::headless_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex)
+{
+    (void)device;
+    assert(pImageIndex);
+    auto& thisLayer = get_layer();
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        VkSemaphore presentSemaphore = VK_NULL_HANDLE;
+        std::chrono::steady_clock::time_point availableTime{ };
+        Queue gvkQueue;
+        {
+            std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+            auto itr = thisLayer.mHeadlessSwapchains.find(swapchain);
+            assert(itr != thisLayer.mHeadlessSwapchains.end());
+            gvkResult = itr->second.acquire_next_image(timeout, pImageIndex, &presentSemaphore, &availableTime);
+            if (gvkResult != VK_SUCCESS) {
+                return gvkResult;
+            }
+            gvkQueue = itr->second.get_queue();
+        }
+
+        // NOTE : Access to a VkSwapchainKHR is externally synchronized so pacing
+        //  doesn't need to hold mMutex.
+        std::this_thread::sleep_until(availableTime);
+        std::lock_guard<std::mutex> queueLock(thisLayer.get_queue_mutex(gvkQueue));
+
+        // NOTE : The acquired VkImage is available once its previous present has
+        //  completed.  The application's VkSemaphore is signaled by a submission
+        //  that waits on the present, the application's VkFence is signaled by an
+        //  empty submission after it, which signals once all prior work on the
+        //  VkQueue is complete.
+        const auto& dispatchTable = gvkQueue.get<DispatchTable>();
+        if (presentSemaphore || semaphore) {
+            VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            auto submitInfo = get_default<VkSubmitInfo>();
+            submitInfo.waitSemaphoreCount = presentSemaphore ? 1 : 0;
+            submitInfo.pWaitSemaphores = &presentSemaphore;
+            submitInfo.pWaitDstStageMask = &waitDstStageMask;
+            submitInfo.signalSemaphoreCount = semaphore ? 1 : 0;
+            submitInfo.pSignalSemaphores = &semaphore;
+            gvk_result(thisLayer.submit_frame(gvkQueue, submitInfo));
+        }
+        if (fence) {
+            gvk_result(dispatchTable.gvkQueueSubmit(gvkQueue, 0, nullptr, fence));
+        }
+    } gvk_result_scope_end;
+    return gvkResult;
+}
+
+VkResult VKAPI_CALL Layer::headless_vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex)
+{
+    assert(pAcquireInfo);
+    return headless_vkAcquireNextImageKHR(device, pAcquireInfo->swapchain, pAcquireInfo->timeout, pAcquireInfo->semaphore, pAcquireInfo->fence, pImageIndex);
+}
+
+VkResult VKAPI_CALL Layer::headless_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo)
+{
+    assert(queue);
+    assert(pPresentInfo);
+    auto& thisLayer = get_layer();
+    std::vector<std::pair<VkSwapchainKHR, uint32_t>> pendingPresents;
+    bool submitted = false;
+    gvk_result_scope_begin(VK_ERROR_INITIALIZATION_FAILED) {
+        Queue gvkQueue = queue;
+        std::vector<VkSemaphore> presentSemaphores(pPresentInfo->swapchainCount);
+        std::vector<VkCommandBuffer> commandBuffers;
+        std::vector<FrameReadback*> frameReadbacks;
+        {
+            std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+            for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
+                auto itr = thisLayer.mHeadlessSwapchains.find(pPresentInfo->pSwapchains[i]);
+                assert(itr != thisLayer.mHeadlessSwapchains.end());
+                auto vkResult = itr->second.present(gvkQueue, pPresentInfo->pImageIndices[i], &presentSemaphores[i]);
+                if (pPresentInfo->pResults) {
+                    pPresentInfo->pResults[i] = vkResult;
+                }
+                gvk_result(vkResult);
+                auto imageIndex = pPresentInfo->pImageIndices[i];
+                pendingPresents.emplace_back(pPresentInfo->pSwapchains[i], imageIndex);
+                gvk_result(thisLayer.begin_frame_readback(gvkQueue, pPresentInfo->pSwapchains[i], imageIndex, itr->second.get_image(imageIndex), &commandBuffers, &frameReadbacks));
+            }
+        }
+
+        // NOTE : A headless present completes when the application's present
+        //  VkSemaphores are signaled, that's forwarded to each presented VkImage's
+        //  VkSemaphore for its next acquisition to wait on.  Frame readbacks are
+        //  recorded in the same batch so they complete before the next acquisition.
+        std::vector<VkPipelineStageFlags> waitDstStageMasks(pPresentInfo->waitSemaphoreCount, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        auto submitInfo = get_default<VkSubmitInfo>();
+        submitInfo.waitSemaphoreCount = pPresentInfo->waitSemaphoreCount;
+        submitInfo.pWaitSemaphores = pPresentInfo->pWaitSemaphores;
+        submitInfo.pWaitDstStageMask = waitDstStageMasks.data();
+        submitInfo.commandBufferCount = (uint32_t)commandBuffers.size();
+        submitInfo.pCommandBuffers = commandBuffers.data();
+        submitInfo.signalSemaphoreCount = (uint32_t)presentSemaphores.size();
+        submitInfo.pSignalSemaphores = presentSemaphores.data();
+        std::lock_guard<std::mutex> queueLock(thisLayer.get_queue_mutex(gvkQueue));
+        gvk_result(thisLayer.submit_frame(gvkQueue, submitInfo));
+        submitted = true;
+        for (auto pFrameReadback : frameReadbacks) {
+            gvk_result(pFrameReadback->end_frame(gvkQueue));
+        }
+    } gvk_result_scope_end;
+
+    // NOTE : If the present VkSemaphores weren't submitted for signaling, the
+    //  presented VkImages' next acquisitions mustn't wait on them.
+    if (gvkResult != VK_SUCCESS && !submitted) {
+        std::lock_guard<std::mutex> lock(thisLayer.mMutex);
+        for (const auto& pendingPresent : pendingPresents) {
+            auto itr = thisLayer.mHeadlessSwapchains.find(pendingPresent.first);
+            if (itr != thisLayer.mHeadlessSwapchains.end()) {
+                itr->second.cancel_present(pendingPresent.second);
+            }
+        }
+    }
+    return gvkResult;
+}
+
 } // namespace virtual_swapchain
 } // namespace gvk
 
@@ -788,7 +1733,9 @@ namespace layer {
 
 void on_load(Registry& registry)
 {
-    registry.layers.push_back(std::make_unique<virtual_swapchain::Layer>());
+    auto upLayer = std::make_unique<virtual_swapchain::Layer>();
+    upLayer->register_intercepted_entry_points(registry);
+    registry.layers.push_back(std::move(upLayer));
 }
 
 } // namespace layer
@@ -796,6 +1743,16 @@ void on_load(Registry& registry)
 
 extern "C" {
 
+void VKAPI_CALL gvkSetFrameReadbackInfo(VkDevice device, const GvkFrameReadbackInfo* pFrameReadbackInfo)
+{
+    gvk::virtual_swapchain::Layer::set_frame_readback_info(device, pFrameReadbackInfo);
+}
+
+void VKAPI_CALL gvkGetFrameReadbackStatistics(VkDevice device, GvkFrameReadbackStatistics* pFrameReadbackStatistics)
+{
+    gvk::virtual_swapchain::Layer::get_frame_readback_statistics(device, pFrameReadbackStatistics);
+}
+
 VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVersion(VkNegotiateLayerInterface* pNegotiateLayerInterface)
 {
     assert(pNegotiateLayerInterface);
@@ -0,0 +1,131 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+
+#include "gvk-virtual-swapchain/frame-readback.hpp"
+#include "gvk-environment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gvk {
+namespace virtual_swapchain {
+
+static void set_frame_readback_env_vars(const std::string& interval, const std::string& frameCount, const std::string& format, const std::string& path)
+{
+    set_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_INTERVAL", interval);
+    set_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_FRAME_COUNT", frameCount);
+    set_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_FORMAT", format);
+    set_env_var("GVK_VIRTUAL_SWAPCHAIN_READBACK_PATH", path);
+}
+
+TEST(FrameReadbackInfo, FromEnvDefaults)
+{
+    set_frame_readback_env_vars(std::string(), std::string(), std::string(), std::string());
+    auto frameReadbackInfo = FrameReadbackInfo::from_env();
+    EXPECT_EQ(frameReadbackInfo.flags, (GvkFrameReadbackFlags)GVK_FRAME_READBACK_RAW_BIT);
+    EXPECT_EQ(frameReadbackInfo.frameInterval, 0u);
+    EXPECT_EQ(frameReadbackInfo.frameCount, 3u);
+    EXPECT_TRUE(frameReadbackInfo.path.empty());
+    EXPECT_EQ(frameReadbackInfo.pfnProcessFrameReadbackDataCallback, nullptr);
+}
+
+TEST(FrameReadbackInfo, FromEnv)
+{
+    set_frame_readback_env_vars("4", "6", "PNG", "frames");
+    auto frameReadbackInfo = FrameReadbackInfo::from_env();
+    EXPECT_EQ(frameReadbackInfo.flags, (GvkFrameReadbackFlags)GVK_FRAME_READBACK_PNG_BIT);
+    EXPECT_EQ(frameReadbackInfo.frameInterval, 4u);
+    EXPECT_EQ(frameReadbackInfo.frameCount, 6u);
+    EXPECT_EQ(frameReadbackInfo.path, std::filesystem::path("frames"));
+
+    // NOTE : Unrecognized formats fall back to raw
+    set_frame_readback_env_vars("1", std::string(), "bmp", std::string());
+    frameReadbackInfo = FrameReadbackInfo::from_env();
+    EXPECT_EQ(frameReadbackInfo.flags, (GvkFrameReadbackFlags)GVK_FRAME_READBACK_RAW_BIT);
+    EXPECT_EQ(frameReadbackInfo.frameInterval, 1u);
+    EXPECT_EQ(frameReadbackInfo.frameCount, 3u);
+    set_frame_readback_env_vars(std::string(), std::string(), std::string(), std::string());
+}
+
+TEST(FrameReadbackStatistics, Counters)
+{
+    FrameReadbackStatistics frameReadbackStatistics;
+    auto statistics = frameReadbackStatistics.get();
+    EXPECT_EQ(statistics.capturedFrameCount, 0u);
+    EXPECT_EQ(statistics.processedFrameCount, 0u);
+    EXPECT_EQ(statistics.droppedFrameCount, 0u);
+    EXPECT_EQ(statistics.lastLatency, 0u);
+    EXPECT_EQ(statistics.averageLatency, 0u);
+    EXPECT_EQ(statistics.maxLatency, 0u);
+
+    frameReadbackStatistics.on_frame_captured();
+    frameReadbackStatistics.on_frame_captured();
+    frameReadbackStatistics.on_frame_captured();
+    frameReadbackStatistics.on_frame_dropped();
+    frameReadbackStatistics.on_frame_processed(300);
+    frameReadbackStatistics.on_frame_processed(100);
+    statistics = frameReadbackStatistics.get();
+    EXPECT_EQ(statistics.capturedFrameCount, 3u);
+    EXPECT_EQ(statistics.processedFrameCount, 2u);
+    EXPECT_EQ(statistics.droppedFrameCount, 1u);
+    EXPECT_EQ(statistics.lastLatency, 100u);
+    EXPECT_EQ(statistics.averageLatency, 200u);
+    EXPECT_EQ(statistics.maxLatency, 300u);
+}
+
+TEST(FrameReadbackStatistics, MultithreadedCounters)
+{
+    FrameReadbackStatistics frameReadbackStatistics;
+    std::vector<std::thread> threads(4);
+    for (auto& thread : threads) {
+        thread = std::thread(
+            [&]()
+            {
+                for (uint64_t i = 0; i < 1000; ++i) {
+                    frameReadbackStatistics.on_frame_captured();
+                    frameReadbackStatistics.on_frame_processed(i);
+                }
+            }
+        );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto statistics = frameReadbackStatistics.get();
+    EXPECT_EQ(statistics.capturedFrameCount, 4000u);
+    EXPECT_EQ(statistics.processedFrameCount, 4000u);
+    EXPECT_EQ(statistics.droppedFrameCount, 0u);
+    EXPECT_EQ(statistics.averageLatency, 499u);
+    EXPECT_EQ(statistics.maxLatency, 999u);
+}
+
+} // namespace virtual_swapchain
+} // namespace gvk
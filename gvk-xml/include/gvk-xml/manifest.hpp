@@ -38,7 +38,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "gvk-xml/structure.hpp"
 
 #include <array>
+#include <filesystem>
+#include <istream>
 #include <map>
+#include <ostream>
 #include <set>
 #include <string>
 
@@ -67,5 +70,15 @@ public:
 
 std::set<std::string> get_commands_referencing_type(const Manifest& manifest, const std::string& typeName);
 
+void serialize(std::ostream& ostrm, const Manifest& manifest);
+void deserialize(std::istream& istrm, Manifest& manifest);
+
+// NOTE : load_manifest() parses the vk.xml at xmlFilePath and writes the resulting
+//  Manifest to a binary cache file in cacheDirectory named by the hash of the
+//  vk.xml contents and api.  Subsequent calls with the same vk.xml and api load
+//  the cached Manifest instead of parsing.  If cacheDirectory is empty the vk.xml
+//  is always parsed.  Returns false if the vk.xml can't be read or parsed.
+bool load_manifest(const std::filesystem::path& xmlFilePath, const std::filesystem::path& cacheDirectory, Manifest& manifest, const std::string& api = "vulkan");
+
 } // namespace xml
 } // namespace gvk
@@ -0,0 +1,230 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-xml/manifest.hpp"
+#include "gvk-string/to-string.hpp"
+#include "gvk-string/utilities.hpp"
+
+#include "cereal/archives/binary.hpp"
+#include "cereal/types/array.hpp"
+#include "cereal/types/map.hpp"
+#include "cereal/types/set.hpp"
+#include "cereal/types/string.hpp"
+#include "cereal/types/vector.hpp"
+
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace gvk {
+namespace xml {
+
+// NOTE : ManifestCacheVersion is combined with the vk.xml hash to name cached
+//  Manifest files, it must be incremented when the members of any gvk::xml type
+//  or the way vk.xml is processed into a Manifest changes.
+static constexpr uint32_t ManifestCacheVersion = 1;
+
+template <typename ArchiveType>
+static void serialize_api_element(ArchiveType& archive, ApiElement& obj)
+{
+    archive(obj.apis, obj.name, obj.vendor, obj.alias, obj.extension, obj.compileGuards, obj.userData);
+}
+
+template <typename ArchiveType>
+static void serialize_feature(ArchiveType& archive, Feature& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.number, obj.types, obj.enumerations, obj.commands);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Platform& obj)
+{
+    serialize_api_element(archive, obj);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Parameter& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.type, obj.unqualifiedType, obj.length, obj.altLength, obj.selector, obj.limitType, obj.values, obj.dimensionCount, obj.bitField, obj.flags);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Handle& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.isDispatchable, obj.vkObjectType, obj.parents, obj.children, obj.createInfos, obj.createCommands, obj.destroyCommands);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Enumerator& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.value, obj.bitPos, obj.offset, obj.direction, obj.extends, obj.extensionNumber);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Enumeration& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.isBitmask, obj.enumerators);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Structure& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.isUnion, obj.vkStructureType, obj.members);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Command& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.type, obj.target, obj.returnType, obj.successCodes, obj.errorCodes, obj.parameters);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Plane& obj)
+{
+    archive(obj.index, obj.widthDivisor, obj.heightDivisor, obj.compatible);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Component& obj)
+{
+    archive(obj.name, obj.bits, obj.numericFormat, obj.planeIndex);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Format& obj)
+{
+    serialize_api_element(archive, obj);
+    archive(obj.classes, obj.blockSize, obj.texelsPerBlock, obj.chroma, obj.packed, obj.blockExtent, obj.compressionType, obj.spirvImageFormat, obj.components, obj.planes);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Feature& obj)
+{
+    serialize_feature(archive, obj);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Extension& obj)
+{
+    serialize_feature(archive, obj);
+    archive(obj.type, obj.platform, obj.deprecatedBy, obj.obsoletedBy, obj.promotedTo);
+}
+
+template <typename ArchiveType>
+void serialize(ArchiveType& archive, Manifest& obj)
+{
+    archive(
+        obj.constants,
+        obj.platforms,
+        obj.vendors,
+        obj.handles,
+        obj.enumerations,
+        obj.structures,
+        obj.commands,
+        obj.formats,
+        obj.features,
+        obj.extensions,
+        obj.vkObjectTypes,
+        obj.vkStructureTypes
+    );
+}
+
+void serialize(std::ostream& ostrm, const Manifest& manifest)
+{
+    cereal::BinaryOutputArchive archive(ostrm);
+    archive(manifest);
+}
+
+void deserialize(std::istream& istrm, Manifest& manifest)
+{
+    cereal::BinaryInputArchive archive(istrm);
+    archive(manifest);
+}
+
+bool load_manifest(const std::filesystem::path& xmlFilePath, const std::filesystem::path& cacheDirectory, Manifest& manifest, const std::string& api)
+{
+    std::ifstream xmlFile(xmlFilePath, std::ios::binary);
+    if (!xmlFile.is_open()) {
+        return false;
+    }
+    std::vector<char> xml((std::istreambuf_iterator<char>(xmlFile)), std::istreambuf_iterator<char>());
+    std::filesystem::path cachePath;
+    if (!cacheDirectory.empty()) {
+        auto key = api + "/" + std::to_string(ManifestCacheVersion) + "/" + to_hex_string(string::hash(xml.data(), xml.size()));
+        cachePath = cacheDirectory / ("gvk-xml-manifest-" + to_hex_string(string::hash(key.data(), key.size())) + ".bin");
+        std::ifstream cacheFile(cachePath, std::ios::binary);
+        if (cacheFile.is_open()) {
+            // NOTE : A cache file that fails to load (ie. truncated by an interrupted
+            //  build) falls through to parsing the vk.xml and rewriting the cache.
+            try {
+                Manifest cachedManifest;
+                deserialize(cacheFile, cachedManifest);
+                manifest = std::move(cachedManifest);
+                return true;
+            } catch (const std::exception&) {
+            }
+        }
+    }
+    tinyxml2::XMLDocument xmlDocument;
+    if (xmlDocument.Parse(xml.data(), xml.size()) != tinyxml2::XML_SUCCESS) {
+        return false;
+    }
+    manifest = Manifest(xmlDocument, api);
+    if (!cachePath.empty()) {
+        // NOTE : Generators run in parallel and may race to write the same cache file,
+        //  each writes a uniquely named temporary file then renames it into place so
+        //  a partially written cache file is never observed.
+        std::error_code errorCode;
+        std::filesystem::create_directories(cacheDirectory, errorCode);
+        auto tempPath = cachePath;
+        tempPath += "." + std::to_string(std::random_device { }()) + ".tmp";
+        {
+            std::ofstream tempFile(tempPath, std::ios::binary);
+            if (tempFile.is_open()) {
+                serialize(tempFile, manifest);
+            }
+        }
+        std::filesystem::rename(tempPath, cachePath, errorCode);
+        if (errorCode) {
+            std::filesystem::remove(tempPath, errorCode);
+        }
+    }
+    return true;
+}
+
+} // namespace xml
+} // namespace gvk
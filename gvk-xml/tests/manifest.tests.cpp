@@ -0,0 +1,155 @@
+
+/*******************************************************************************
+
+MIT License
+
+Copyright (c) Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to use,
+copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the
+Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*******************************************************************************/
+
+#include "gvk-xml.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <tuple>
+
+static auto tie_api_element(const gvk::xml::ApiElement& apiElement)
+{
+    return std::tie(apiElement.apis, apiElement.name, apiElement.vendor, apiElement.alias, apiElement.extension, apiElement.compileGuards, apiElement.userData);
+}
+
+static bool equal(const gvk::xml::Parameter& lhs, const gvk::xml::Parameter& rhs)
+{
+    return
+        tie_api_element(lhs) == tie_api_element(rhs) &&
+        std::tie(lhs.type, lhs.unqualifiedType, lhs.length, lhs.altLength, lhs.selector, lhs.limitType, lhs.values, lhs.dimensionCount, lhs.bitField, lhs.flags) ==
+        std::tie(rhs.type, rhs.unqualifiedType, rhs.length, rhs.altLength, rhs.selector, rhs.limitType, rhs.values, rhs.dimensionCount, rhs.bitField, rhs.flags);
+}
+
+static bool equal(const gvk::xml::Enumerator& lhs, const gvk::xml::Enumerator& rhs)
+{
+    return
+        tie_api_element(lhs) == tie_api_element(rhs) &&
+        std::tie(lhs.value, lhs.bitPos, lhs.offset, lhs.direction, lhs.extends, lhs.extensionNumber) ==
+        std::tie(rhs.value, rhs.bitPos, rhs.offset, rhs.direction, rhs.extends, rhs.extensionNumber);
+}
+
+template <typename RangeType>
+static bool equal_ranges(const RangeType& lhs, const RangeType& rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const auto& lhsElement, const auto& rhsElement) { return equal(lhsElement, rhsElement); });
+}
+
+static bool equal(const gvk::xml::Handle& lhs, const gvk::xml::Handle& rhs)
+{
+    return
+        tie_api_element(lhs) == tie_api_element(rhs) &&
+        std::tie(lhs.isDispatchable, lhs.vkObjectType, lhs.parents, lhs.children, lhs.createInfos, lhs.createCommands, lhs.destroyCommands) ==
+        std::tie(rhs.isDispatchable, rhs.vkObjectType, rhs.parents, rhs.children, rhs.createInfos, rhs.createCommands, rhs.destroyCommands);
+}
+
+static bool equal(const gvk::xml::Structure& lhs, const gvk::xml::Structure& rhs)
+{
+    return
+        tie_api_element(lhs) == tie_api_element(rhs) &&
+        std::tie(lhs.isUnion, lhs.vkStructureType) == std::tie(rhs.isUnion, rhs.vkStructureType) &&
+        equal_ranges(lhs.members, rhs.members);
+}
+
+static bool equal(const gvk::xml::Enumeration& lhs, const gvk::xml::Enumeration& rhs)
+{
+    return
+        tie_api_element(lhs) == tie_api_element(rhs) &&
+        lhs.isBitmask == rhs.isBitmask &&
+        equal_ranges(lhs.enumerators, rhs.enumerators);
+}
+
+static bool equal(const gvk::xml::Command& lhs, const gvk::xml::Command& rhs)
+{
+    return
+        tie_api_element(lhs) == tie_api_element(rhs) &&
+        std::tie(lhs.type, lhs.target, lhs.returnType, lhs.successCodes, lhs.errorCodes) ==
+        std::tie(rhs.type, rhs.target, rhs.returnType, rhs.successCodes, rhs.errorCodes) &&
+        equal_ranges(lhs.parameters, rhs.parameters);
+}
+
+template <typename ApiElementType>
+static void expect_equal(const std::map<std::string, ApiElementType>& lhs, const std::map<std::string, ApiElementType>& rhs)
+{
+    ASSERT_EQ(lhs.size(), rhs.size());
+    for (auto lhsItr = lhs.begin(), rhsItr = rhs.begin(); lhsItr != lhs.end(); ++lhsItr, ++rhsItr) {
+        ASSERT_EQ(lhsItr->first, rhsItr->first);
+        EXPECT_TRUE(equal(lhsItr->second, rhsItr->second)) << lhsItr->first;
+    }
+}
+
+static void expect_equal(const gvk::xml::Manifest& lhs, const gvk::xml::Manifest& rhs)
+{
+    EXPECT_EQ(lhs.vendors, rhs.vendors);
+    EXPECT_EQ(lhs.vkObjectTypes, rhs.vkObjectTypes);
+    EXPECT_EQ(lhs.vkStructureTypes, rhs.vkStructureTypes);
+    expect_equal(lhs.handles, rhs.handles);
+    expect_equal(lhs.enumerations, rhs.enumerations);
+    expect_equal(lhs.structures, rhs.structures);
+    expect_equal(lhs.commands, rhs.commands);
+}
+
+TEST(Manifest, load_manifest)
+{
+    auto cacheDirectory = std::filesystem::temp_directory_path() / "gvk-xml.tests.load_manifest";
+    std::filesystem::remove_all(cacheDirectory);
+
+    gvk::xml::Manifest parsedManifest;
+    ASSERT_TRUE(gvk::xml::load_manifest(GVK_XML_FILE_PATH, cacheDirectory, parsedManifest));
+    ASSERT_FALSE(parsedManifest.handles.empty());
+    ASSERT_FALSE(parsedManifest.structures.empty());
+    ASSERT_FALSE(parsedManifest.commands.empty());
+
+    gvk::xml::Manifest cachedManifest;
+    ASSERT_TRUE(gvk::xml::load_manifest(GVK_XML_FILE_PATH, cacheDirectory, cachedManifest));
+    expect_equal(parsedManifest, cachedManifest);
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+TEST(Manifest, load_manifest_invalid_cache)
+{
+    auto cacheDirectory = std::filesystem::temp_directory_path() / "gvk-xml.tests.load_manifest_invalid_cache";
+    std::filesystem::remove_all(cacheDirectory);
+    gvk::xml::Manifest parsedManifest;
+    ASSERT_TRUE(gvk::xml::load_manifest(GVK_XML_FILE_PATH, cacheDirectory, parsedManifest));
+
+    // Truncate the cache file, load_manifest() should fall back to parsing vk.xml
+    //  and rewrite the cache file
+    for (const auto& directoryEntry : std::filesystem::directory_iterator(cacheDirectory)) {
+        std::filesystem::resize_file(directoryEntry.path(), std::filesystem::file_size(directoryEntry.path()) / 2);
+    }
+    gvk::xml::Manifest truncatedCacheManifest;
+    ASSERT_TRUE(gvk::xml::load_manifest(GVK_XML_FILE_PATH, cacheDirectory, truncatedCacheManifest));
+    expect_equal(parsedManifest, truncatedCacheManifest);
+
+    gvk::xml::Manifest cachedManifest;
+    ASSERT_TRUE(gvk::xml::load_manifest(GVK_XML_FILE_PATH, cacheDirectory, cachedManifest));
+    expect_equal(parsedManifest, cachedManifest);
+    std::filesystem::remove_all(cacheDirectory);
+}
@@ -521,9 +521,9 @@ int main(int, const char*[])
                 auto extent = wsiManager.get_swapchain().get<VkSwapchainCreateInfoKHR>().imageExtent;
                 camera.set_aspect_ratio(extent.width, extent.height);
 
-                // Get VkFences from the WsiManager.  The gvk::gui::Renderer will wait on these
-                //  VkFences to ensure that it doesn't destroy any resources that are still in
-                //  use by the WsiManager
+                // Get VkFences from the WsiManager.  The gvk::gui::Renderer uses the number of
+                //  VkFences to determine how many frames may be in flight so that it doesn't
+                //  overwrite or destroy any resources that are still in use by the WsiManager
                 const auto& vkFences = wsiManager.get_vk_fences();
 
                 // If the gvk::gui::Renderer is enabled, update values based on gui interaction